@@ -5,6 +5,7 @@
 #include <napi.h>
 
 #include <condition_variable>
+#include <exception>
 #include <mutex>
 #include <queue>
 #include <string>
@@ -31,6 +32,8 @@ private:
                           Napi::Object infer_data,
                           Napi::Object user_data,
                           Napi::Promise::Deferred deferred);
+    /** @brief Runs user callback for all the requests completed since the previous call, on the main event loop. */
+    void dispatch_completed(Napi::Env env, Napi::Function user_callback);
     void set_tsfn(Napi::Env env, Napi::Function callback);
     void release();
 
@@ -43,6 +46,9 @@ private:
     std::queue<size_t> m_idle_handles;
     std::queue<std::tuple<Napi::ObjectReference, Napi::ObjectReference, Napi::Promise::Deferred>> m_awaiting_requests;
 
+    // requests completed on inference threads and waiting for dispatch_completed()
+    std::vector<std::pair<size_t, std::exception_ptr>> m_completed;
+
     std::mutex m_mutex;
     Napi::ThreadSafeFunction m_tsfn;
 };
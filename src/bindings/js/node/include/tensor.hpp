@@ -51,6 +51,14 @@ public:
      */
     Napi::Value get_data(const Napi::CallbackInfo& info);
 
+    /**
+     * @brief Creates a TypedArray sharing memory with the tensor, without copying the data.
+     * The returned TypedArray keeps the tensor's memory alive.
+     * @param info Contains information about the environment in which to create the Napi::TypedArray instance.
+     * @return Napi::TypedArray viewing the tensor data.
+     */
+    Napi::Value get_data_view(const Napi::CallbackInfo& info);
+
     /**
      * @brief Setter that fills underlaying Tensor's memory by copying data from TypedArray.
      * @throw Exception if data's size from TypedArray does not match the size of the tensor's data.
@@ -88,4 +96,6 @@ public:
 
 private:
     ov::Tensor _tensor;
+    // TypedArray wrapped by the tensor, it's referenced to prevent garbage collection of the shared memory
+    Napi::Reference<Napi::TypedArray> _data_source;
 };
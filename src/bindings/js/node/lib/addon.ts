@@ -500,6 +500,17 @@ export interface Tensor {
    * element type, e.g. Float32Array corresponds to float32.
    */
   getData(): SupportedTypedArray;
+  /**
+   * It gets tensor data without copying it.
+   * @remarks
+   * The returned TypedArray shares memory with the tensor, so any change
+   * of the TypedArray is reflected in the tensor and vice versa.
+   * The TypedArray keeps the tensor memory alive. It's not supported for
+   * string tensors.
+   * @returns A subclass of TypedArray corresponding to the tensor
+   * element type, e.g. Float32Array corresponds to float32.
+   */
+  getDataView(): SupportedTypedArray;
   /**
    * It gets the tensor shape.
    */
@@ -744,6 +755,7 @@ export interface AsyncInferQueue {
    * input name and value is a tensor or an array with tensors.
    * @param userData User data that will be passed to the callback.
    * @returns A Promise that can be used to track the callback completion.
+   * It's rejected if the inference or the callback fails.
    */
   startAsync(
     inputData: { [inputName: string]: Tensor } | Tensor[],
@@ -106,38 +106,19 @@ void AsyncInferQueue::set_custom_callbacks(const Napi::CallbackInfo& info) {
         set_tsfn(info.Env(), info[0].As<Napi::Function>());
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
             m_requests[handle].set_callback([this, handle](std::exception_ptr exception_ptr) {
-                try {
-                    if (exception_ptr) {
-                        std::rethrow_exception(exception_ptr);
-                    }
-                    auto ov_callback = [this, handle](Napi::Env env, Napi::Function user_callback) {
-                        Napi::Object js_ir = InferRequestWrap::wrap(env, m_requests[handle]);
-                        const auto promise = m_user_ids[handle].second;
-                        try {
-                            auto user_data =
-                                m_user_ids[handle].first.Value().ToString().Utf8Value() == UNDEFINED_USER_DATA
-                                    ? env.Undefined()
-                                    : m_user_ids[handle].first.Value();
-                            user_callback.Call({env.Null(), js_ir, user_data});  // CVS-170804
-                            promise.Resolve(user_data);
-                            // returns before the promise's .then() is completed
-                        } catch (Napi::Error& e) {
-                            promise.Reject(Napi::Error::New(env, e.Message()).Value());
-                        }
-                        // Start async inference on the next request or add idle handle to queue
-                        if (std::lock_guard<std::mutex> lock(m_mutex); m_awaiting_requests.size() > 0) {
-                            const auto& [infer_data, user_data, promise] = m_awaiting_requests.front();
-                            start_async_impl(handle, infer_data.Value(), user_data.Value(), promise);
-                            m_awaiting_requests.pop();
-                        } else {
-                            m_idle_handles.push(handle);
-                        }
-                    };
-                    // The ov_callback will execute when the main event loop will be free
-                    napi_status status = m_tsfn.BlockingCall(ov_callback);
+                bool schedule_dispatch = false;
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    schedule_dispatch = m_completed.empty();
+                    m_completed.emplace_back(handle, exception_ptr);
+                }
+                // Only the first completion schedules a call, requests completed before the main event loop
+                // runs it are handled by the same call. The inference thread is never blocked.
+                if (schedule_dispatch) {
+                    napi_status status = m_tsfn.NonBlockingCall([this](Napi::Env env, Napi::Function user_callback) {
+                        dispatch_completed(env, user_callback);
+                    });
                     OPENVINO_ASSERT(status == napi_ok, "Failed to call user callback.");
-                } catch (const std::exception& e) {
-                    OPENVINO_THROW(e.what());
                 }
             });
         }
@@ -146,6 +127,56 @@ void AsyncInferQueue::set_custom_callbacks(const Napi::CallbackInfo& info) {
     }
 }
 
+void AsyncInferQueue::dispatch_completed(Napi::Env env, Napi::Function user_callback) {
+    std::vector<std::pair<size_t, std::exception_ptr>> completed;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        completed.swap(m_completed);
+    }
+    for (const auto& [handle, exception_ptr] : completed) {
+        Napi::Object js_ir = InferRequestWrap::wrap(env, m_requests[handle]);
+        const auto promise = m_user_ids[handle].second;
+        auto user_data = m_user_ids[handle].first.Value().ToString().Utf8Value() == UNDEFINED_USER_DATA
+                             ? env.Undefined()
+                             : m_user_ids[handle].first.Value();
+        try {
+            if (exception_ptr) {
+                std::string message;
+                try {
+                    std::rethrow_exception(exception_ptr);
+                } catch (const std::exception& e) {
+                    message = e.what();
+                }
+                const auto error = Napi::Error::New(env, message).Value();
+                user_callback.Call({error, js_ir, user_data});
+                promise.Reject(error);
+            } else {
+                user_callback.Call({env.Null(), js_ir, user_data});  // CVS-170804
+                promise.Resolve(user_data);
+                // returns before the promise's .then() is completed
+            }
+        } catch (Napi::Error& e) {
+            promise.Reject(Napi::Error::New(env, e.Message()).Value());
+        }
+        // Start async inference on the next request or add idle handle to queue
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_awaiting_requests.empty()) {
+            m_idle_handles.push(handle);
+            continue;
+        }
+        auto [infer_data, next_user_data, next_promise] = std::move(m_awaiting_requests.front());
+        m_awaiting_requests.pop();
+        lock.unlock();
+        try {
+            start_async_impl(handle, infer_data.Value(), next_user_data.Value(), next_promise);
+        } catch (const std::exception& e) {
+            next_promise.Reject(Napi::Error::New(env, e.what()).Value());
+            lock.lock();
+            m_idle_handles.push(handle);
+        }
+    }
+}
+
 void AsyncInferQueue::start_async_impl(const size_t handle,
                                        Napi::Object infer_data,
                                        Napi::Object user_data,
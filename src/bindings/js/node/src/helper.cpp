@@ -362,13 +362,11 @@ ov::Tensor cast_to_tensor(const Napi::TypedArray& typed_array,
                           const ov::Shape& shape,
                           const ov::element::Type_t& type) {
     /* The difference between TypedArray::ArrayBuffer::Data() and e.g. Float32Array::Data() is byteOffset
-    because the TypedArray may have a non-zero `ByteOffset()` into the `ArrayBuffer`. */
-    if (typed_array.ByteOffset() != 0) {
-        OPENVINO_THROW("TypedArray.byteOffset has to be equal to zero.");
-    }
-    auto array_buffer = typed_array.ArrayBuffer();
-    auto tensor = ov::Tensor(type, shape, array_buffer.Data());
-    if (tensor.get_byte_size() != array_buffer.ByteLength()) {
+    because the TypedArray may have a non-zero `ByteOffset()` into the `ArrayBuffer`.
+    Tensor wraps only the view's part of the buffer, so views of a larger buffer are shared without a copy. */
+    auto data = static_cast<uint8_t*>(typed_array.ArrayBuffer().Data()) + typed_array.ByteOffset();
+    auto tensor = ov::Tensor(type, shape, data);
+    if (tensor.get_byte_size() != typed_array.ByteLength()) {
         OPENVINO_THROW("Memory allocated using shape and element::type mismatch passed data's size");
     }
     return tensor;
@@ -38,6 +38,7 @@ TensorWrap::TensorWrap(const Napi::CallbackInfo& info) : Napi::ObjectWrap<Tensor
                 this->_tensor = ov::Tensor(type, shape);
             } else if (info.Length() == 3 && info[2].IsTypedArray()) {
                 this->_tensor = cast_to_tensor(info[2].As<Napi::TypedArray>(), shape, type);
+                this->_data_source = Napi::Persistent(info[2].As<Napi::TypedArray>());
             } else {
                 OPENVINO_THROW("Third argument of a tensor must be TypedArray.");
             }
@@ -54,6 +55,7 @@ Napi::Function TensorWrap::get_class(Napi::Env env) {
                        "TensorWrap",
                        {InstanceAccessor<&TensorWrap::get_data, &TensorWrap::set_data>("data"),
                         InstanceMethod("getData", &TensorWrap::get_data),
+                        InstanceMethod("getDataView", &TensorWrap::get_data_view),
                         InstanceMethod("getShape", &TensorWrap::get_shape),
                         InstanceMethod("getElementType", &TensorWrap::get_element_type),
                         InstanceMethod("getSize", &TensorWrap::get_size),
@@ -69,6 +71,7 @@ ov::Tensor TensorWrap::get_tensor() const {
 
 void TensorWrap::set_tensor(const ov::Tensor& tensor) {
     _tensor = tensor;
+    _data_source.Reset();
 }
 
 Napi::Object TensorWrap::wrap(Napi::Env env, ov::Tensor tensor) {
@@ -157,6 +160,78 @@ Napi::Value TensorWrap::get_data(const Napi::CallbackInfo& info) {
     }
 }
 
+namespace {
+template <typename T>
+Napi::Value make_typed_array(Napi::Env env, const Napi::ArrayBuffer& buffer, size_t byte_offset, size_t size) {
+    return Napi::TypedArrayOf<T>::New(env, size, buffer, byte_offset);
+}
+
+Napi::Value make_typed_array(Napi::Env env,
+                             const ov::element::Type& type,
+                             const Napi::ArrayBuffer& buffer,
+                             size_t byte_offset,
+                             size_t size) {
+    switch (type) {
+    case ov::element::Type_t::i8:
+        return make_typed_array<int8_t>(env, buffer, byte_offset, size);
+    case ov::element::Type_t::u8:
+        return make_typed_array<uint8_t>(env, buffer, byte_offset, size);
+    case ov::element::Type_t::i16:
+        return make_typed_array<int16_t>(env, buffer, byte_offset, size);
+    case ov::element::Type_t::u16:
+        return make_typed_array<uint16_t>(env, buffer, byte_offset, size);
+    case ov::element::Type_t::i32:
+        return make_typed_array<int32_t>(env, buffer, byte_offset, size);
+    case ov::element::Type_t::u32:
+        return make_typed_array<uint32_t>(env, buffer, byte_offset, size);
+    case ov::element::Type_t::f32:
+        return make_typed_array<float>(env, buffer, byte_offset, size);
+    case ov::element::Type_t::f64:
+        return make_typed_array<double>(env, buffer, byte_offset, size);
+    case ov::element::Type_t::i64:
+        return make_typed_array<int64_t>(env, buffer, byte_offset, size);
+    case ov::element::Type_t::u64:
+        return make_typed_array<uint64_t>(env, buffer, byte_offset, size);
+    default:
+        OPENVINO_THROW("Tensor of ", type, " type can't be viewed as TypedArray.");
+    }
+}
+}  // namespace
+
+Napi::Value TensorWrap::get_data_view(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    if (info.Length() > 0) {
+        reportError(env, "getDataView() does not accept any arguments.");
+        return env.Undefined();
+    }
+    try {
+        const auto type = _tensor.get_element_type();
+        OPENVINO_ASSERT(_tensor.is_continuous(), "Only continuous tensor can be viewed as TypedArray.");
+        if (!_data_source.IsEmpty()) {
+            // The tensor wraps memory of JS TypedArray, a new view of the same ArrayBuffer is created.
+            const auto source = _data_source.Value();
+            const auto buffer = source.ArrayBuffer();
+            const auto byte_offset = static_cast<uint8_t*>(_tensor.data()) - static_cast<uint8_t*>(buffer.Data());
+            return make_typed_array(env, type, buffer, static_cast<size_t>(byte_offset), _tensor.get_size());
+        }
+        // The ArrayBuffer owns a copy of ov::Tensor which keeps the memory alive until the buffer is collected.
+        auto owner = std::make_unique<ov::Tensor>(_tensor);
+        const auto buffer = Napi::ArrayBuffer::New(
+            env,
+            owner->data(),
+            owner->get_byte_size(),
+            [](Napi::Env /*env*/, void* /*data*/, ov::Tensor* tensor) {
+                delete tensor;
+            },
+            owner.get());
+        owner.release();
+        return make_typed_array(env, type, buffer, 0, _tensor.get_size());
+    } catch (const std::exception& e) {
+        reportError(env, e.what());
+        return env.Undefined();
+    }
+}
+
 void TensorWrap::set_data(const Napi::CallbackInfo& info, const Napi::Value& value) {
     try {
         if (value.IsTypedArray()) {
@@ -166,7 +241,8 @@ void TensorWrap::set_data(const Napi::CallbackInfo& info, const Napi::Value& val
                 OPENVINO_THROW("Passed array must have the same size as the Tensor!");
             }
             const auto napi_type = buf.TypedArrayType();
-            std::memcpy(_tensor.data(get_ov_type(napi_type)), buf.ArrayBuffer().Data(), _tensor.get_byte_size());
+            const auto src = static_cast<uint8_t*>(buf.ArrayBuffer().Data()) + buf.ByteOffset();
+            std::memcpy(_tensor.data(get_ov_type(napi_type)), src, _tensor.get_byte_size());
         } else if (value.IsArray()) {
             fill_tensor_from_strings(_tensor, value.As<Napi::Array>());
         } else {
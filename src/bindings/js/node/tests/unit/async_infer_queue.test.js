@@ -7,6 +7,60 @@ const { addon: ov } = require("../..");
 const { describe, it, before } = require("node:test");
 const { testModels, generateImage } = require("../utils.js");
 
+// data [?] reshaped by the shape given as the second input
+const reshapeModelXml = `<?xml version="1.0"?>
+<net name="reshape_model" version="11">
+  <layers>
+  <layer id="0" name="data" type="Parameter" version="opset1">
+    <data shape="?" element_type="f32" />
+    <output>
+    <port id="0" precision="FP32" names="data">
+      <dim>-1</dim>
+    </port>
+    </output>
+  </layer>
+  <layer id="1" name="shape" type="Parameter" version="opset1">
+    <data shape="2" element_type="i64" />
+    <output>
+    <port id="0" precision="I64" names="shape">
+      <dim>2</dim>
+    </port>
+    </output>
+  </layer>
+  <layer id="2" name="reshape" type="Reshape" version="opset1">
+    <data special_zero="false" />
+    <input>
+    <port id="0" precision="FP32">
+      <dim>-1</dim>
+    </port>
+    <port id="1" precision="I64">
+      <dim>2</dim>
+    </port>
+    </input>
+    <output>
+    <port id="2" precision="FP32">
+      <dim>-1</dim>
+      <dim>-1</dim>
+    </port>
+    </output>
+  </layer>
+  <layer id="3" name="Result_4" type="Result" version="opset1">
+    <input>
+    <port id="0" precision="FP32">
+      <dim>-1</dim>
+      <dim>-1</dim>
+    </port>
+    </input>
+  </layer>
+  </layers>
+  <edges>
+  <edge from-layer="0" from-port="0" to-layer="2" to-port="0" />
+  <edge from-layer="1" from-port="0" to-layer="2" to-port="1" />
+  <edge from-layer="2" from-port="2" to-layer="3" to-port="0" />
+  </edges>
+  <rt_info />
+</net>`;
+
 describe("Tests for AsyncInferQueue.", () => {
   const jobs = 8;
   const numRequest = 4;
@@ -217,4 +271,59 @@ describe("Tests for AsyncInferQueue.", () => {
     });
     inferQueue.release();
   });
+
+  it("Test requests completed before the event loop runs", async () => {
+    const inferQueue = new ov.AsyncInferQueue(compiledModel, numRequest);
+    const calls = Array.from({ length: jobs }, () => 0);
+    inferQueue.setCallback((err, request, jobId) => {
+      assert.strictEqual(err, null);
+      calls[jobId]++;
+      const inputAt0 = request.getInputTensor().data[0];
+      assert.strictEqual(inputAt0, jobId);
+      assert.strictEqual(request.getOutputTensor().data[0], inputAt0);
+    });
+
+    const promises = [];
+    for (let i = 0; i < jobs; i++) {
+      const img = generateImage();
+      img[0] = i;
+      promises.push(inferQueue.startAsync({ data: img }, i));
+    }
+    // keep the main event loop busy, so the started requests complete before their completions are dispatched
+    const blockedUntil = Date.now() + 200;
+    while (Date.now() < blockedUntil);
+
+    const results = await Promise.all(promises);
+    assert.deepStrictEqual(results, [...Array(jobs).keys()]);
+    assert.deepStrictEqual(calls, Array(jobs).fill(1));
+    inferQueue.release();
+  });
+
+  it("Test failed inference calls callback with error and rejects promise", async () => {
+    const model = core.readModelSync(new TextEncoder().encode(reshapeModelXml));
+    const reshapeCompiledModel = core.compileModelSync(model, "CPU");
+    const inferQueue = new ov.AsyncInferQueue(reshapeCompiledModel, numRequest);
+    const errors = [];
+    inferQueue.setCallback((err, request, jobId) => {
+      assert.ok(request instanceof ov.InferRequest);
+      errors[jobId] = err;
+    });
+
+    const data = new ov.Tensor(ov.element.f32, [3], new Float32Array([1, 2, 3]));
+    // 3 elements can't be reshaped to [2, 2], so the inference fails on the shape inference
+    const badShape = new ov.Tensor(ov.element.i64, [2], new BigInt64Array([2n, 2n]));
+    const goodShape = new ov.Tensor(ov.element.i64, [2], new BigInt64Array([1n, 3n]));
+    const failed = inferQueue.startAsync({ data, shape: badShape }, 0);
+    const succeeded = inferQueue.startAsync({ data, shape: goodShape }, 1);
+
+    await assert.rejects(failed, (err) => {
+      assert.ok(err instanceof Error);
+      assert.strictEqual(err, errors[0]);
+      return true;
+    });
+    assert.strictEqual(await succeeded, 1);
+    assert.ok(errors[0] instanceof Error);
+    assert.strictEqual(errors[1], null);
+    inferQueue.release();
+  });
 });
@@ -68,7 +68,7 @@ describe("ov.InferRequest tests", () => {
       const inputMessagePairs = [
         ["string", "Cannot create a tensor from the passed Napi::Value."],
         [tensorData.slice(-10), /Memory allocated using shape and element::type mismatch/],
-        [new Float32Array(buffer, 4), "TypedArray.byteOffset has to be equal to zero."],
+        [new Float32Array(buffer, 4), /Memory allocated using shape and element::type mismatch/],
         [{}, /Invalid argument/], // Test for object that is not Tensor
       ];
 
@@ -88,6 +88,41 @@ describe("ov.Tensor tests", () => {
         message: "getData() does not accept any arguments.",
       });
     });
+    it("getDataView shares memory with the source TypedArray", () => {
+      const source = Float32Array.from(data);
+      const tensor = new ov.Tensor(ov.element.f32, shape, source);
+      const view = tensor.getDataView();
+      assert.ok(view instanceof Float32Array);
+      assert.strictEqual(view.buffer, source.buffer);
+      view[0] = -1;
+      assert.strictEqual(source[0], -1);
+    });
+
+    it("getDataView shares memory allocated by the tensor", () => {
+      const tensor = new ov.Tensor(ov.element.i32, [2, 3]);
+      tensor.data = Int32Array.from([1, 2, 3, 4, 5, 6]);
+      const view = tensor.getDataView();
+      assert.ok(view instanceof Int32Array);
+      view[5] = 42;
+      assert.deepStrictEqual(tensor.getData(), Int32Array.from([1, 2, 3, 4, 5, 42]));
+    });
+
+    it("getDataView throws for string tensor", () => {
+      const tensor = new ov.Tensor(["a", "b"]);
+      assert.throws(() => tensor.getDataView(), /can't be viewed as TypedArray/);
+    });
+
+    it("Tensor wraps TypedArray with non-zero byteOffset", () => {
+      const buffer = new Float32Array(elemNum + 4);
+      const subarray = buffer.subarray(4);
+      subarray.set(data);
+      const tensor = new ov.Tensor(ov.element.f32, shape, subarray);
+      assert.deepStrictEqual(tensor.data, data);
+      subarray[0] = -1;
+      assert.strictEqual(tensor.getDataView()[0], -1);
+      assert.strictEqual(tensor.getDataView().byteOffset, 16);
+    });
+
     it("test tensor.data setter - different element type throws", () => {
       const float64Data = Float64Array.from([1, 2, 3]);
       const tensor = new ov.Tensor(ov.element.f32, [1, 3]);
@@ -574,6 +574,26 @@ class AsyncInferQueue(AsyncInferQueueBase):
             userdata,
         )
 
+    def completed(self) -> Iterator[tuple[InferRequest, Any]]:
+        """Iterates over InferRequests completed so far, available only in the polling mode.
+
+        Completed requests are consumed in the calling thread without invoking Python
+        callbacks from the inference threads. Each request is returned to the pool once
+        the consumer proceeds to the next item, so its results have to be used or copied
+        before that. Iteration stops when there are no more completed requests.
+
+        :return: a generator that yields pairs of completed InferRequest and its userdata.
+        :rtype: collections.abc.Iterator[tuple[openvino.InferRequest, Any]]
+        """
+        while True:
+            idx = self._pop_completed()
+            if idx is None:
+                return
+            try:
+                yield self[idx], super().userdata[idx]
+            finally:
+                self._release(idx)
+
 
 class Core(CoreBase):
     """Core class represents OpenVINO runtime Core entity.
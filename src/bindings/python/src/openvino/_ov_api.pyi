@@ -60,6 +60,19 @@ class AsyncInferQueue(openvino._pyopenvino.AsyncInferQueue):
                 :return: a generator that yields InferRequests.
                 :rtype: collections.abc.Iterable[openvino.InferRequest]
                 
+        """
+    def completed(self) -> collections.abc.Iterator[tuple[InferRequest, typing.Any]]:
+        """
+        Iterates over InferRequests completed so far, available only in the polling mode.
+        
+                Completed requests are consumed in the calling thread without invoking Python
+                callbacks from the inference threads. Each request is returned to the pool once
+                the consumer proceeds to the next item, so its results have to be used or copied
+                before that. Iteration stops when there are no more completed requests.
+        
+                :return: a generator that yields pairs of completed InferRequest and its userdata.
+                :rtype: collections.abc.Iterator[tuple[openvino.InferRequest, Any]]
+                
         """
     def start_async(self, inputs: typing.Any = None, userdata: typing.Any = None, share_inputs: bool = False) -> None:
         """
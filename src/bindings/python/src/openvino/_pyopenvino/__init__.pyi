@@ -28,7 +28,7 @@ class AsyncInferQueue:
                 :return: InferRequests from the pool with given id.
                 :rtype: openvino.InferRequest
         """
-    def __init__(self, model: CompiledModel, jobs: typing.SupportsInt = 0) -> None:
+    def __init__(self, model: CompiledModel, jobs: typing.SupportsInt = 0, polling: bool = False) -> None:
         """
                         Creates AsyncInferQueue.
         
@@ -37,6 +37,9 @@ class AsyncInferQueue:
                         :param jobs: Number of InferRequests objects in a pool. If 0, jobs number
                         will be set automatically to the optimal number. Default: 0
                         :type jobs: int
+                        :param polling: If True, completed requests are not passed to a callback
+                        and have to be consumed with `completed()` instead. Default: False
+                        :type polling: bool
                         :rtype: openvino.AsyncInferQueue
         """
     def __iter__(self) -> collections.abc.Iterator[InferRequest]:
@@ -49,6 +52,25 @@ class AsyncInferQueue:
         """
     def __repr__(self) -> str:
         ...
+    def _pop_completed(self) -> typing.Any:
+        """
+                    Returns id of the next completed InferRequest or None if there is no such request.
+                    The request is not returned to the pool until `_release` is called.
+                    Available only in the polling mode.
+        
+                    GIL is released while running this function.
+        
+                    :rtype: Optional[int]
+        """
+    def _release(self, id: typing.SupportsInt) -> None:
+        """
+                    Returns completed InferRequest obtained by `_pop_completed` to the pool.
+        
+                    GIL is released while running this function.
+        
+                    :param id: InferRequest id
+                    :type id: int
+        """
     def get_idle_request_id(self) -> int:
         """
                     Returns next free id of InferRequest from queue's pool.
@@ -1729,6 +1751,20 @@ class InferRequest:
                                     Total size of tensors needs to match with input's size.
                     :type tensors: list[openvino.Tensor]
         """
+    def set_output_arrays(self, outputs: dict) -> None:
+        """
+                    Binds numpy arrays as output tensors of InferRequest.
+        
+                    Results of every following inference are written directly into the bound arrays,
+                    which are also returned by `infer` and `results` instead of new arrays.
+                    It allows to avoid allocation of results on every inference call.
+                    Bound arrays stay alive until they're unbound by passing `None`.
+        
+                    :param outputs: Arrays to bind. Key is index, name or port of the output.
+                                    Array must be writeable, C contiguous or padded row-major,
+                                    and have the same type and shape as the output.
+                    :type outputs: dict[Union[int, str, openvino.ConstOutput], Optional[numpy.ndarray]]
+        """
     @typing.overload
     def set_output_tensor(self, index: typing.SupportsInt, tensor: Tensor) -> None:
         """
@@ -4564,10 +4600,45 @@ class Tensor:
     """
     openvino.Tensor holding either copy of memory or shared host memory.
     """
+    @staticmethod
+    def from_dlpack(source: typing.Any) -> typing.Any:
+        """
+                    Creates Tensor sharing memory with an object implementing DLPack protocol, e.g.
+                    numpy.ndarray or torch.Tensor, or with an unused DLPack capsule.
+                    Any action performed on the source memory will be reflected on this Tensor's memory!
+        
+                    Source data must be located in host memory and have row-major layout, possibly padded.
+        
+                    :param source: Object implementing `__dlpack__` method or DLPack capsule.
+                    :type source: Any
+                    :rtype: openvino.Tensor
+        """
     def __copy__(self) -> Tensor:
         ...
     def __deepcopy__(self, arg0: dict) -> Tensor:
         ...
+    def __dlpack__(self, stream: typing.Any = None, *, max_version: typing.Any = None, dl_device: typing.Any = None, copy: typing.Any = None) -> typing.Any:
+        """
+                    Exports Tensor as a DLPack capsule, the capsule shares memory with the Tensor.
+                    Allows zero-copy exchange with frameworks supporting DLPack, e.g. `numpy.from_dlpack(tensor)`
+                    or `torch.from_dlpack(tensor)`.
+        
+                    :param stream: Must be None, as Tensor is located in host memory.
+                    :type stream: Optional[int]
+                    :param max_version: Maximum DLPack version supported by the consumer. Not used.
+                    :type max_version: Optional[tuple[int, int]]
+                    :param dl_device: Device to export the Tensor to, only host device (1, 0) is supported.
+                    :type dl_device: Optional[tuple[int, int]]
+                    :param copy: If `True`, the data is copied to the exported capsule.
+                    :type copy: Optional[bool]
+                    :rtype: PyCapsule
+        """
+    def __dlpack_device__(self) -> tuple:
+        """
+                    Returns device type and id of the Tensor in DLPack convention.
+        
+                    :rtype: tuple[int, int]
+        """
     @typing.overload
     def __init__(self, array: numpy.ndarray[typing.Any, numpy.dtype[typing.Any]], shared_memory: bool = False) -> None:
         """
@@ -4578,7 +4649,8 @@ class Tensor:
                         :param shared_memory: If `True`, this Tensor memory is being shared with a host.
                                               Any action performed on the host memory is reflected on this Tensor's memory!
                                               If `False`, data is being copied to this Tensor.
-                                              Requires data to be C_CONTIGUOUS if `True`.
+                                              Requires data to be C_CONTIGUOUS or a padded row-major array,
+                                              e.g. a slice of innermost dimensions, if `True`.
                                               If the passed array contains strings, the flag must be set to `False'.
                         :type shared_memory: bool
         """
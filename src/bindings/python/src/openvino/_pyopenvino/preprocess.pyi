@@ -315,6 +315,20 @@ class PreProcessSteps:
         ...
     def crop(self, begin: collections.abc.Sequence[typing.SupportsInt], end: collections.abc.Sequence[typing.SupportsInt]) -> PreProcessSteps:
         ...
+    def crop_and_resize(self, rois_tensor_name: str, dst_height: typing.SupportsInt, dst_width: typing.SupportsInt) -> PreProcessSteps:
+        """
+                    Adds crop and resize of regions of interest. Each ROI of the new `rois_tensor_name` input,
+                    given as [batch_index, x_1, y_1, x_2, y_2] row, is cropped and resized with bilinear interpolation.
+        
+                    :param rois_tensor_name: Tensor name of added {num_rois, 5} f32 input.
+                    :type rois_tensor_name: str
+                    :param dst_height: Height of each resized ROI.
+                    :type dst_height: int
+                    :param dst_width: Width of each resized ROI.
+                    :type dst_width: int
+                    :return: Reference to itself, allows chaining of calls in client's code in a builder-like manner.
+                    :rtype: openvino.preprocess.PreProcessSteps
+        """
     def custom(self, operation: collections.abc.Callable) -> PreProcessSteps:
         """
                     Adds custom preprocessing operation.
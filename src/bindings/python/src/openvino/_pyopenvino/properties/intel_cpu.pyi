@@ -5,7 +5,7 @@ import typing
 """
 openvino.properties.intel_cpu submodule that simulates ov::intel_cpu
 """
-__all__: list[str] = ['TbbPartitioner', 'denormals_optimization', 'sparse_weights_decompression_rate', 'tbb_partitioner']
+__all__: list[str] = ['TbbPartitioner', 'denormals_optimization', 'sparse_float_weights_rate', 'sparse_weights_decompression_rate', 'tbb_partitioner']
 class TbbPartitioner:
     """
     Members:
@@ -58,6 +58,12 @@ def denormals_optimization() -> str:
 def denormals_optimization(arg0: bool) -> tuple[str, openvino._pyopenvino.OVAny]:
     ...
 @typing.overload
+def sparse_float_weights_rate() -> str:
+    ...
+@typing.overload
+def sparse_float_weights_rate(arg0: typing.SupportsFloat) -> tuple[str, openvino._pyopenvino.OVAny]:
+    ...
+@typing.overload
 def sparse_weights_decompression_rate() -> str:
     ...
 @typing.overload
@@ -6,8 +6,12 @@
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <limits>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <string>
@@ -19,15 +23,99 @@
 
 namespace py = pybind11;
 
+namespace {
+
+// Bounded lock-free multi-producer multi-consumer ring of request handles, based on Dmitry Vyukov's algorithm.
+// The capacity is not smaller than the number of requests in the pool and the callers never push a handle which
+// is already in the ring, so push never overflows.
+class HandleRing {
+public:
+    void resize(size_t size) {
+        size_t capacity = 1;
+        while (capacity < size) {
+            capacity <<= 1;
+        }
+        m_cells.reset(new Cell[capacity]);
+        for (size_t i = 0; i < capacity; i++) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        m_mask = capacity - 1;
+    }
+
+    void push(size_t handle) {
+        size_t pos = m_tail.load(std::memory_order_relaxed);
+        while (true) {
+            auto& cell = m_cells[pos & m_mask];
+            const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            if (sequence == pos && m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell.handle = handle;
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                m_size++;
+                return;
+            }
+            if (sequence != pos) {
+                // the cell is still being released by a concurrent pop or the tail is outdated
+                pos = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool pop(size_t& handle) {
+        size_t pos = m_head.load(std::memory_order_relaxed);
+        while (true) {
+            auto& cell = m_cells[pos & m_mask];
+            const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+            if (diff == 0 && m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                handle = cell.handle;
+                cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+                m_size--;
+                return true;
+            }
+            if (diff < 0) {
+                return false;
+            }
+            if (diff > 0) {
+                pos = m_head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool empty() const {
+        return m_size.load() <= 0;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        size_t handle = 0;
+    };
+
+    std::unique_ptr<Cell[]> m_cells;
+    size_t m_mask = 0;
+    std::atomic<size_t> m_head{0};
+    std::atomic<size_t> m_tail{0};
+    // may be negative for a moment as push publishes the cell before increasing the size
+    std::atomic<std::ptrdiff_t> m_size{0};
+};
+
+}  // namespace
+
 class AsyncInferQueue {
 public:
-    AsyncInferQueue(ov::CompiledModel& model, size_t jobs) {
+    static constexpr size_t no_handle = std::numeric_limits<size_t>::max();
+
+    AsyncInferQueue(ov::CompiledModel& model, size_t jobs, bool polling) : m_polling(polling) {
         if (jobs == 0) {
             jobs = static_cast<size_t>(Common::get_optimal_number_of_requests(model));
         }
 
         m_requests.reserve(jobs);
         m_user_ids.reserve(jobs);
+        m_busy.reset(new std::atomic<bool>[jobs]());
+        m_queued_completed.reset(new std::atomic<bool>[jobs]());
+        m_idle_handles.resize(jobs);
+        m_completed_handles.resize(jobs);
 
         for (size_t handle = 0; handle < jobs; handle++) {
             // Create new "empty" InferRequestWrapper without pre-defined callback and
@@ -47,28 +135,50 @@ public:
     bool _is_ready() {
         // Check if any request has finished already
         py::gil_scoped_release release;
-        // acquire the mutex to access m_errors and m_idle_handles
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_errors.size() > 0)
-            throw m_errors.front();
-        return !(m_idle_handles.empty());
+        throw_if_errors();
+        return m_peeked_handle.load() != no_handle || !m_idle_handles.empty();
     }
 
     size_t get_idle_request_id() {
-        // Wait for any request to complete and return its id
+        // Wait for any request to complete and return its id, the id is kept for the next start_async
         // release GIL to avoid deadlock on python callback
         py::gil_scoped_release release;
-        // acquire the mutex to access m_errors and m_idle_handles
-        std::unique_lock<std::mutex> lock(m_mutex);
-        m_cv.wait(lock, [this] {
-            return !(m_idle_handles.empty());
+        size_t handle = no_handle;
+        bool popped = false;
+        wait_until([&] {
+            handle = m_peeked_handle.load();
+            popped = handle == no_handle && m_idle_handles.pop(handle);
+            return handle != no_handle;
         });
-        size_t idle_handle = m_idle_handles.front();
+        if (popped) {
+            return_idle_handle(handle);
+            handle = m_peeked_handle.load();
+        }
         // wait for request to make sure it returned from callback
-        m_requests[idle_handle].m_request.wait();
-        if (m_errors.size() > 0)
-            throw m_errors.front();
-        return idle_handle;
+        m_requests[handle].m_request.wait();
+        throw_if_errors();
+        return handle;
+    }
+
+    size_t acquire_idle_handle() {
+        // release GIL to avoid deadlock on python callback
+        py::gil_scoped_release release;
+        size_t handle = no_handle;
+        wait_until([&] {
+            handle = m_peeked_handle.exchange(no_handle);
+            return handle != no_handle || m_idle_handles.pop(handle);
+        });
+        try {
+            // wait for request to make sure it returned from callback
+            m_requests[handle].m_request.wait();
+            throw_if_errors();
+        } catch (...) {
+            return_idle_handle(handle);
+            throw;
+        }
+        m_busy[handle] = true;
+        m_busy_requests++;
+        return handle;
     }
 
     void wait_all() {
@@ -78,50 +188,93 @@ public:
         for (auto&& request : m_requests) {
             request.m_request.wait();
         }
-        // acquire the mutex to access m_errors
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_errors.size() > 0)
-            throw m_errors.front();
+        if (!m_polling) {
+            // python callbacks of the completed requests may still be dispatched by another thread
+            wait_until([this] {
+                return m_busy_requests.load() == 0;
+            });
+        }
+        throw_if_errors();
+    }
+
+    py::object pop_completed_request_id() {
+        OPENVINO_ASSERT(m_polling, "AsyncInferQueue is not created in the polling mode");
+        size_t handle = no_handle;
+        {
+            py::gil_scoped_release release;
+            if (!pop_completed_handle(handle)) {
+                return py::none();
+            }
+            try {
+                // rethrows the exception of failed inference
+                m_requests[handle].m_request.wait();
+            } catch (...) {
+                release_handle(handle);
+                throw;
+            }
+        }
+        return py::int_(handle);
+    }
+
+    void release_completed_request_id(size_t handle) {
+        OPENVINO_ASSERT(m_polling, "AsyncInferQueue is not created in the polling mode");
+        OPENVINO_ASSERT(handle < m_requests.size(), "Wrong id of InferRequest: ", handle);
+        py::gil_scoped_release release;
+        release_handle(handle);
     }
 
     void set_default_callbacks() {
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
-            // auto end_time = m_requests[handle].m_end_time; // TODO: pass it bellow? like in InferRequestWrapper
-
-            m_requests[handle].m_request.set_callback([this, handle /* ... */](std::exception_ptr exception_ptr) {
+            m_requests[handle].m_request.set_callback([this, handle](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
-                {
-                    // acquire the mutex to access m_idle_handles
-                    std::lock_guard<std::mutex> lock(m_mutex);
-                    // Add idle handle to queue
-                    m_idle_handles.push(handle);
-                }
-                // Notify locks in getIdleRequestId()
-                m_cv.notify_one();
-
-                try {
-                    if (exception_ptr) {
-                        std::rethrow_exception(exception_ptr);
-                    }
-                } catch (const std::exception& e) {
-                    OPENVINO_THROW(e.what());
+                if (m_polling) {
+                    // the request stays busy until it's consumed by polling
+                    push_completed_handle(handle);
+                } else {
+                    release_handle(handle);
                 }
+                rethrow_if_failed(exception_ptr);
             });
         }
     }
 
     void set_custom_callbacks(py::function f_callback) {
+        OPENVINO_ASSERT(!m_polling, "Callback can't be set for AsyncInferQueue in the polling mode");
         // need to acquire GIL before py::function deletion
-        auto callback_sp = Common::utils::wrap_pyfunction(std::move(f_callback));
+        std::atomic_store(&m_callback, Common::utils::wrap_pyfunction(std::move(f_callback)));
 
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
-            m_requests[handle].m_request.set_callback([this, callback_sp, handle](std::exception_ptr exception_ptr) {
+            m_requests[handle].m_request.set_callback([this, handle](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
                 if (exception_ptr == nullptr) {
-                    // For free-threaded Python, gil_scoped_acquire still ensures thread is attached
-                    py::gil_scoped_acquire acquire;
+                    push_completed_handle(handle);
+                    dispatch_callbacks();
+                } else {
+                    release_handle(handle);
+                }
+                rethrow_if_failed(exception_ptr);
+            });
+        }
+    }
+
+    // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
+    // all of requests are destroyed as well.
+    std::vector<InferRequestWrapper> m_requests;
+    std::vector<py::object> m_user_ids;  // user ID can be any Python object
+
+private:
+    // Runs python callbacks of all the completed requests under a single GIL acquisition. Only one thread
+    // dispatches at a time, completions reported meanwhile by other threads are picked up by it.
+    void dispatch_callbacks() {
+        while (!m_completed_handles.empty() && !m_dispatching.exchange(true)) {
+            {
+                // For free-threaded Python, gil_scoped_acquire still ensures thread is attached
+                py::gil_scoped_acquire acquire;
+                const auto callback = std::atomic_load(&m_callback);
+                size_t handle = 0;
+                while (pop_completed_handle(handle)) {
                     try {
-                        (*callback_sp)(m_requests[handle], m_user_ids[handle]);
+                        (*callback)(m_requests[handle], m_user_ids[handle]);
                     } catch (const py::error_already_set& py_error) {
                         // This should behave the same as assert(!PyErr_Occurred())
                         // since constructor for pybind11's error_already_set is
@@ -131,36 +284,104 @@ public:
                         // acquire the mutex to access m_errors
                         std::lock_guard<std::mutex> lock(m_mutex);
                         m_errors.push(py_error);
+                        m_has_errors = true;
                     }
+                    release_handle(handle);
                 }
+            }
+            m_dispatching = false;
+        }
+    }
 
-                {
-                    // acquire the mutex to access m_idle_handles
-                    std::lock_guard<std::mutex> lock(m_mutex);
-                    // Add idle handle to queue
-                    m_idle_handles.push(handle);
-                }
-                // Notify locks in getIdleRequestId()
-                m_cv.notify_one();
+    void release_handle(size_t handle) {
+        // the request was started directly instead of through the queue or it's released twice,
+        // the handle is already idle then
+        if (!m_busy[handle].exchange(false)) {
+            return;
+        }
+        m_idle_handles.push(handle);
+        m_busy_requests--;
+        notify_waiters();
+    }
 
-                try {
-                    if (exception_ptr) {
-                        std::rethrow_exception(exception_ptr);
-                    }
-                } catch (const std::exception& e) {
-                    OPENVINO_THROW(e.what());
-                }
-            });
+    void push_completed_handle(size_t handle) {
+        // a request restarted directly before its previous completion is consumed is reported once
+        if (!m_queued_completed[handle].exchange(true)) {
+            m_completed_handles.push(handle);
         }
     }
 
-    // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
-    // all of requests are destroyed as well.
-    std::vector<InferRequestWrapper> m_requests;
-    std::queue<size_t> m_idle_handles;
-    std::vector<py::object> m_user_ids;  // user ID can be any Python object
+    bool pop_completed_handle(size_t& handle) {
+        if (!m_completed_handles.pop(handle)) {
+            return false;
+        }
+        m_queued_completed[handle] = false;
+        return true;
+    }
+
+    void return_idle_handle(size_t handle) {
+        size_t expected = no_handle;
+        if (!m_peeked_handle.compare_exchange_strong(expected, handle)) {
+            m_idle_handles.push(handle);
+        }
+        notify_waiters();
+    }
+
+    // GIL must be released by the caller
+    template <typename Predicate>
+    void wait_until(Predicate predicate) {
+        if (predicate()) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_waiters++;
+        m_cv.wait(lock, predicate);
+        m_waiters--;
+    }
+
+    void notify_waiters() {
+        // the mutex is taken only if somebody may sleep on the condition variable
+        if (m_waiters.load() != 0) {
+            { std::lock_guard<std::mutex> lock(m_mutex); }
+            m_cv.notify_all();
+        }
+    }
+
+    void throw_if_errors() {
+        if (m_has_errors.load()) {
+            // acquire the mutex to access m_errors
+            std::lock_guard<std::mutex> lock(m_mutex);
+            throw m_errors.front();
+        }
+    }
+
+    static void rethrow_if_failed(const std::exception_ptr& exception_ptr) {
+        try {
+            if (exception_ptr) {
+                std::rethrow_exception(exception_ptr);
+            }
+        } catch (const std::exception& e) {
+            OPENVINO_THROW(e.what());
+        }
+    }
+
+    const bool m_polling;
+    HandleRing m_idle_handles;
+    // requests waiting for the python callback or for polling
+    HandleRing m_completed_handles;
+    // idle handle returned by get_idle_request_id, it's used by the next start_async
+    std::atomic<size_t> m_peeked_handle{no_handle};
+    std::atomic<std::ptrdiff_t> m_busy_requests{0};
+    // per handle flags: the request is started through the queue and not released yet,
+    // the handle is in m_completed_handles
+    std::unique_ptr<std::atomic<bool>[]> m_busy;
+    std::unique_ptr<std::atomic<bool>[]> m_queued_completed;
+    std::shared_ptr<py::function> m_callback;
+    std::atomic<bool> m_dispatching{false};
+    std::atomic<size_t> m_waiters{0};
     std::mutex m_mutex;
     std::condition_variable m_cv;
+    std::atomic<bool> m_has_errors{false};
     std::queue<py::error_already_set> m_errors;
 };
 
@@ -169,9 +390,10 @@ void regclass_AsyncInferQueue(py::module m) {
     cls.doc() = "openvino.AsyncInferQueue represents a helper that creates a pool of asynchronous"
                 "InferRequests and provides synchronization functions to control flow of a simple pipeline.";
 
-    cls.def(py::init<ov::CompiledModel&, size_t>(),
+    cls.def(py::init<ov::CompiledModel&, size_t, bool>(),
             py::arg("model"),
             py::arg("jobs") = 0,
+            py::arg("polling") = false,
             R"(
                 Creates AsyncInferQueue.
 
@@ -180,6 +402,9 @@ void regclass_AsyncInferQueue(py::module m) {
                 :param jobs: Number of InferRequests objects in a pool. If 0, jobs number
                 will be set automatically to the optimal number. Default: 0
                 :type jobs: int
+                :param polling: If True, completed requests are not passed to a callback
+                and have to be consumed with `completed()` instead. Default: False
+                :type polling: bool
                 :rtype: openvino.AsyncInferQueue
             )");
 
@@ -189,11 +414,7 @@ void regclass_AsyncInferQueue(py::module m) {
         [](AsyncInferQueue& self, const ov::Tensor& inputs, py::object userdata) {
             // getIdleRequestId function has an intention to block InferQueue
             // until there is at least one idle (free to use) InferRequest
-            auto handle = self.get_idle_request_id();
-            {
-                std::lock_guard<std::mutex> lock(self.m_mutex);
-                self.m_idle_handles.pop();
-            }
+            auto handle = self.acquire_idle_handle();
             // Set new inputs label/id from user
             self.m_user_ids[handle] = userdata;
             // Update inputs if there are any
@@ -235,11 +456,7 @@ void regclass_AsyncInferQueue(py::module m) {
         [](AsyncInferQueue& self, const py::dict& inputs, py::object userdata) {
             // getIdleRequestId function has an intention to block InferQueue
             // until there is at least one idle (free to use) InferRequest
-            auto handle = self.get_idle_request_id();
-            {
-                std::lock_guard<std::mutex> lock(self.m_mutex);
-                self.m_idle_handles.pop();
-            }
+            auto handle = self.acquire_idle_handle();
             // Set new inputs label/id from user
             self.m_user_ids[handle] = userdata;
             // Update inputs if there are any
@@ -301,6 +518,30 @@ void regclass_AsyncInferQueue(py::module m) {
             :rtype: int
         )");
 
+    cls.def("_pop_completed",
+            &AsyncInferQueue::pop_completed_request_id,
+            R"(
+            Returns id of the next completed InferRequest or None if there is no such request.
+            The request is not returned to the pool until `_release` is called.
+            Available only in the polling mode.
+
+            GIL is released while running this function.
+
+            :rtype: Optional[int]
+        )");
+
+    cls.def("_release",
+            &AsyncInferQueue::release_completed_request_id,
+            py::arg("id"),
+            R"(
+            Returns completed InferRequest obtained by `_pop_completed` to the pool.
+
+            GIL is released while running this function.
+
+            :param id: InferRequest id
+            :type id: int
+        )");
+
     cls.def("set_callback",
             &AsyncInferQueue::set_custom_callbacks,
             R"(
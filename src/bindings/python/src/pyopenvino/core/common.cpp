@@ -4,6 +4,8 @@
 
 #include "common.hpp"
 
+#include <memory>
+#include <tuple>
 #include <unordered_map>
 
 #include "Python.h"
@@ -244,6 +246,23 @@ std::vector<size_t> get_strides(const py::array& array) {
     return std::vector<size_t>(array.strides(), array.strides() + array.ndim());
 }
 
+bool has_shareable_strides(const py::array& array) {
+    // ov::Tensor can wrap row-major layouts with padding, e.g. a slice of the innermost dimensions.
+    if (array.ndim() == 0 || array.size() == 0) {
+        return false;
+    }
+    const auto itemsize = array.itemsize();
+    auto dense_stride = itemsize;
+    for (auto i = array.ndim(); i-- > 0;) {
+        const auto stride = array.strides(i);
+        if (stride < dense_stride || stride % itemsize != 0) {
+            return false;
+        }
+        dense_stride = stride * array.shape(i);
+    }
+    return true;
+}
+
 py::array as_contiguous(py::array& array, ov::element::Type type) {
     switch (type) {
     // floating
@@ -518,10 +537,249 @@ ov::Tensor create_shared(py::array& array) {
                           array_helpers::get_shape(array),
                           (array.ndim() == 0 || array.size() == 0) ? array.mutable_data() : array.mutable_data(0));
     }
-    // If passed array is not C-style, throw an error.
-    OPENVINO_THROW("SHARED MEMORY MODE FOR THIS TENSOR IS NOT APPLICABLE! Passed numpy array must be C contiguous.");
+    // Padded row-major arrays (i.e. slices of C-style arrays) are shared as strided Tensors.
+    if (array_helpers::has_shareable_strides(array)) {
+        return ov::Tensor(type_helpers::get_ov_type(array),
+                          array_helpers::get_shape(array),
+                          array.mutable_data(0),
+                          array_helpers::get_strides(array));
+    }
+    // If passed array has other memory layout, throw an error.
+    OPENVINO_THROW("SHARED MEMORY MODE FOR THIS TENSOR IS NOT APPLICABLE! Passed numpy array must be C contiguous "
+                   "or a row-major array with padding.");
 }
 
+namespace dlpack_helpers {
+namespace {
+
+// Subset of DLPack ABI (https://github.com/dmlc/dlpack), version 0.8, required by the exchange protocol.
+enum DLDeviceType : int32_t { kDLCPU = 1 };
+
+enum DLDataTypeCode : uint8_t { kDLInt = 0, kDLUInt = 1, kDLFloat = 2, kDLBfloat = 4, kDLBool = 6 };
+
+struct DLDevice {
+    int32_t device_type;
+    int32_t device_id;
+};
+
+struct DLDataType {
+    uint8_t code;
+    uint8_t bits;
+    uint16_t lanes;
+};
+
+struct DLTensor {
+    void* data;
+    DLDevice device;
+    int32_t ndim;
+    DLDataType dtype;
+    int64_t* shape;
+    int64_t* strides;
+    uint64_t byte_offset;
+};
+
+struct DLManagedTensor {
+    DLTensor dl_tensor;
+    void* manager_ctx;
+    void (*deleter)(DLManagedTensor* self);
+};
+
+constexpr const char* dltensor_name = "dltensor";
+constexpr const char* used_dltensor_name = "used_dltensor";
+
+// Keeps exported Tensor and its Python owner alive until the consumer calls the deleter.
+struct ExportedTensor {
+    ov::Tensor tensor;
+    std::shared_ptr<py::object> owner;
+    std::vector<int64_t> shape;
+    std::vector<int64_t> strides;
+    DLManagedTensor managed;
+};
+
+DLDataType to_dl_type(const ov::element::Type& type) {
+    const auto bits = static_cast<uint8_t>(type.bitwidth());
+    switch (type) {
+    case ov::element::f16:
+    case ov::element::f32:
+    case ov::element::f64:
+        return {kDLFloat, bits, 1};
+    case ov::element::bf16:
+        return {kDLBfloat, bits, 1};
+    case ov::element::i8:
+    case ov::element::i16:
+    case ov::element::i32:
+    case ov::element::i64:
+        return {kDLInt, bits, 1};
+    case ov::element::u8:
+    case ov::element::u16:
+    case ov::element::u32:
+    case ov::element::u64:
+        return {kDLUInt, bits, 1};
+    case ov::element::boolean:
+        return {kDLBool, bits, 1};
+    default:
+        throw py::buffer_error("Tensor of " + type.get_type_name() + " type can't be exported with DLPack.");
+    }
+}
+
+ov::element::Type from_dl_type(const DLDataType& type) {
+    if (type.lanes == 1) {
+        switch (type.code) {
+        case kDLFloat:
+            if (type.bits == 16 || type.bits == 32 || type.bits == 64) {
+                return type.bits == 16 ? ov::element::f16 : type.bits == 32 ? ov::element::f32 : ov::element::f64;
+            }
+            break;
+        case kDLBfloat:
+            if (type.bits == 16) {
+                return ov::element::bf16;
+            }
+            break;
+        case kDLInt:
+        case kDLUInt: {
+            const bool is_signed = type.code == kDLInt;
+            switch (type.bits) {
+            case 8:
+                return is_signed ? ov::element::i8 : ov::element::u8;
+            case 16:
+                return is_signed ? ov::element::i16 : ov::element::u16;
+            case 32:
+                return is_signed ? ov::element::i32 : ov::element::u32;
+            case 64:
+                return is_signed ? ov::element::i64 : ov::element::u64;
+            }
+            break;
+        }
+        case kDLBool:
+            if (type.bits == 8) {
+                return ov::element::boolean;
+            }
+            break;
+        }
+    }
+    throw py::buffer_error("DLPack data type (code: " + std::to_string(type.code) +
+                           ", bits: " + std::to_string(type.bits) + ", lanes: " + std::to_string(type.lanes) +
+                           ") is not supported by openvino.Tensor.");
+}
+
+void delete_unused_capsule(PyObject* capsule) {
+    // The capsule is renamed by the consumer which takes the ownership of DLManagedTensor.
+    if (PyCapsule_IsValid(capsule, dltensor_name)) {
+        auto managed = static_cast<DLManagedTensor*>(PyCapsule_GetPointer(capsule, dltensor_name));
+        if (managed->deleter) {
+            managed->deleter(managed);
+        }
+    }
+}
+
+}  // namespace
+
+py::capsule to_dlpack(const py::object& tensor, bool copy) {
+    auto ov_tensor = tensor.cast<ov::Tensor>();
+    const auto dl_type = to_dl_type(ov_tensor.get_element_type());
+    if (copy) {
+        ov::Tensor copied(ov_tensor.get_element_type(), ov_tensor.get_shape());
+        ov_tensor.copy_to(copied);
+        ov_tensor = copied;
+    }
+
+    auto exported = std::make_unique<ExportedTensor>();
+    exported->tensor = ov_tensor;
+    // Python object of the Tensor keeps alive the memory shared with it, e.g. numpy array
+    exported->owner = copy ? nullptr : Common::utils::wrap_pyobject_to_sp(tensor);
+    const auto& shape = ov_tensor.get_shape();
+    const auto& strides = ov_tensor.get_strides();
+    const auto element_size = static_cast<int64_t>(ov_tensor.get_element_type().size());
+    for (size_t i = 0; i < shape.size(); ++i) {
+        exported->shape.push_back(static_cast<int64_t>(shape[i]));
+        exported->strides.push_back(static_cast<int64_t>(strides[i]) / element_size);
+    }
+
+    auto& dl_tensor = exported->managed.dl_tensor;
+    dl_tensor.data = ov_tensor.data();
+    dl_tensor.device = {kDLCPU, 0};
+    dl_tensor.ndim = static_cast<int32_t>(shape.size());
+    dl_tensor.dtype = dl_type;
+    dl_tensor.shape = exported->shape.data();
+    dl_tensor.strides = exported->strides.data();
+    dl_tensor.byte_offset = 0;
+    exported->managed.manager_ctx = exported.get();
+    exported->managed.deleter = [](DLManagedTensor* self) {
+        delete static_cast<ExportedTensor*>(self->manager_ctx);
+    };
+
+    auto capsule = PyCapsule_New(&exported->managed, dltensor_name, &delete_unused_capsule);
+    if (!capsule) {
+        throw py::error_already_set();
+    }
+    exported.release();
+    return py::reinterpret_steal<py::capsule>(capsule);
+}
+
+py::object from_dlpack(const py::object& source) {
+    py::object capsule = source;
+    if (py::hasattr(source, "__dlpack__")) {
+        if (py::hasattr(source, "__dlpack_device__")) {
+            const auto device = source.attr("__dlpack_device__")().cast<std::tuple<int32_t, int32_t>>();
+            if (std::get<0>(device) != kDLCPU) {
+                throw py::buffer_error("Only data located in host memory can be shared with openvino.Tensor.");
+            }
+        }
+        capsule = source.attr("__dlpack__")();
+    }
+    if (!PyCapsule_IsValid(capsule.ptr(), dltensor_name)) {
+        throw py::type_error("Expected an object implementing DLPack protocol or an unused DLPack capsule, got " +
+                             std::string(py::str(py::type::of(source))) + ".");
+    }
+    auto managed = static_cast<DLManagedTensor*>(PyCapsule_GetPointer(capsule.ptr(), dltensor_name));
+    const auto& dl_tensor = managed->dl_tensor;
+    if (dl_tensor.device.device_type != kDLCPU) {
+        throw py::buffer_error("Only data located in host memory can be shared with openvino.Tensor.");
+    }
+
+    const auto type = from_dl_type(dl_tensor.dtype);
+    ov::Shape shape(dl_tensor.shape, dl_tensor.shape + dl_tensor.ndim);
+    ov::Strides strides;
+    if (dl_tensor.strides && ov::shape_size(shape) > 0) {
+        // Strides of dimensions equal to 1 are arbitrary in DLPack, they're replaced by dense ones.
+        bool is_dense = true;
+        size_t dense_stride = type.size();
+        strides.resize(shape.size());
+        for (size_t i = shape.size(); i-- > 0;) {
+            const auto stride = dl_tensor.strides[i] * static_cast<int64_t>(type.size());
+            if (shape[i] == 1) {
+                strides[i] = dense_stride;
+            } else if (stride >= static_cast<int64_t>(dense_stride)) {
+                strides[i] = static_cast<size_t>(stride);
+                is_dense = is_dense && strides[i] == dense_stride;
+            } else {
+                throw py::buffer_error("Only row-major memory layouts, possibly padded, can be shared with "
+                                       "openvino.Tensor.");
+            }
+            dense_stride = strides[i] * shape[i];
+        }
+        if (is_dense) {
+            strides.clear();
+        }
+    }
+    auto data = static_cast<char*>(dl_tensor.data) + dl_tensor.byte_offset;
+    auto tensor = strides.empty() ? ov::Tensor(type, shape, data) : ov::Tensor(type, shape, data, strides);
+
+    // The Tensor becomes the owner of DLManagedTensor and releases it when destroyed.
+    PyCapsule_SetName(capsule.ptr(), used_dltensor_name);
+    py::capsule owner(managed, [](void* ptr) {
+        auto managed = static_cast<DLManagedTensor*>(ptr);
+        if (managed->deleter) {
+            managed->deleter(managed);
+        }
+    });
+    auto result = py::cast(std::move(tensor));
+    py::detail::keep_alive_impl(result, owner);
+    return result;
+}
+
+};  // namespace dlpack_helpers
+
 ov::Tensor tensor_from_pointer(py::array& array, const ov::Shape& shape, const ov::element::Type& type) {
     if (type_helpers::get_ov_type(array) == ov::element::string) {
         OPENVINO_THROW("SHARED MEMORY MODE FOR THIS TENSOR IS NOT APPLICABLE! String types can be only copied.");
@@ -647,8 +905,19 @@ uint32_t get_optimal_number_of_requests(const ov::CompiledModel& actual) {
 
 py::dict outputs_to_dict(InferRequestWrapper& request, bool share_outputs, bool decode_strings) {
     py::dict res;
-    for (const auto& out : request.m_outputs) {
+    for (size_t i = 0; i < request.m_outputs.size(); ++i) {
+        const auto& out = request.m_outputs[i];
         auto t = request.m_request.get_tensor(out);
+        // Return array bound by user if the request still writes to its memory.
+        // Plugin may replace the tensor, e.g. when a dynamic output doesn't fit into the array anymore.
+        const auto& bound_output = (*request.m_output_arrays)[i];
+        if (bound_output) {
+            auto array = py::reinterpret_borrow<py::array>(*bound_output);
+            if (array.data() == t.data() && array_helpers::get_shape(array) == t.get_shape()) {
+                res[py::cast(out)] = array;
+                continue;
+            }
+        }
         if (t.get_element_type() == ov::element::string) {
             if (share_outputs) {
                 PyErr_WarnEx(PyExc_RuntimeWarning, "Result of a string type will be copied to OVDict!", 1);
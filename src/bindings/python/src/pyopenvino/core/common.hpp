@@ -82,6 +82,8 @@ std::vector<size_t> get_shape(const py::array& array);
 
 std::vector<size_t> get_strides(const py::array& array);
 
+bool has_shareable_strides(const py::array& array);
+
 py::array as_contiguous(py::array& array, ov::element::Type type);
 
 py::array array_from_tensor(ov::Tensor&& t, bool is_shared);
@@ -161,6 +163,14 @@ T object_from_data(D& data, bool shared_memory) {
     return create_copied<T>(data);
 }
 
+namespace dlpack_helpers {
+
+py::capsule to_dlpack(const py::object& tensor, bool copy);
+
+py::object from_dlpack(const py::object& source);
+
+};  // namespace dlpack_helpers
+
 ov::Tensor tensor_from_pointer(py::array& array, const ov::Shape& shape, const ov::element::Type& ov_type);
 
 ov::Tensor tensor_from_pointer(py::array& array, const ov::Output<const ov::Node>& port);
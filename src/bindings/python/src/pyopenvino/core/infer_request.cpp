@@ -27,6 +27,27 @@ inline py::object run_sync_infer(InferRequestWrapper& self, bool share_outputs,
     return Common::outputs_to_dict(self, share_outputs, decode_strings);
 }
 
+inline size_t get_output_index(const InferRequestWrapper& self, const py::handle& key) {
+    if (py::isinstance<py::int_>(key)) {
+        const auto idx = key.cast<size_t>();
+        OPENVINO_ASSERT(idx < self.m_outputs.size(), "Output index ", idx, " is out of range.");
+        return idx;
+    }
+    for (size_t i = 0; i < self.m_outputs.size(); ++i) {
+        if (py::isinstance<py::str>(key) && self.m_outputs[i].get_names().count(key.cast<std::string>())) {
+            return i;
+        }
+        if (py::isinstance<ov::Output<const ov::Node>>(key) &&
+            self.m_outputs[i] == key.cast<ov::Output<const ov::Node>>()) {
+            return i;
+        }
+    }
+    if (py::isinstance<py::str>(key) || py::isinstance<ov::Output<const ov::Node>>(key)) {
+        OPENVINO_THROW("Output ", std::string(py::str(key)), " is not found.");
+    }
+    throw py::type_error("Incompatible key type for output: " + std::string(py::str(py::type::of(key))));
+}
+
 void regclass_InferRequest(py::module m) {
     py::class_<InferRequestWrapper, std::shared_ptr<InferRequestWrapper>> cls(
         m,
@@ -696,6 +717,68 @@ void regclass_InferRequest(py::module m) {
             :type tensor: openvino.Tensor
         )");
 
+    // Python API exclusive function
+    cls.def(
+        "set_output_arrays",
+        [](InferRequestWrapper& self, const py::dict& outputs) {
+            for (auto&& output : outputs) {
+                const auto idx = get_output_index(self, output.first);
+                auto& bound_output = (*self.m_output_arrays)[idx];
+                const auto& port = self.m_outputs[idx];
+                if (output.second.is_none()) {
+                    if (bound_output) {
+                        // Request mustn't write to the unbound array anymore
+                        auto array = py::reinterpret_borrow<py::array>(*bound_output);
+                        auto tensor = self.m_request.get_tensor(port);
+                        if (tensor.data() == array.data()) {
+                            self.m_request.set_tensor(port, ov::Tensor(tensor.get_element_type(), tensor.get_shape()));
+                        }
+                    }
+                    bound_output.reset();
+                    continue;
+                }
+                if (!py::isinstance<py::array>(output.second)) {
+                    throw py::type_error("Unable to bind " + std::string(py::str(py::type::of(output.second))) +
+                                         " object as output, numpy.ndarray is expected.");
+                }
+                auto array = py::reinterpret_borrow<py::array>(output.second);
+                OPENVINO_ASSERT(array.writeable(), "Array bound as output ", idx, " must be writeable.");
+                OPENVINO_ASSERT(Common::type_helpers::get_ov_type(array) == port.get_element_type(),
+                                "Type of the array bound as output ",
+                                idx,
+                                " must be ",
+                                port.get_element_type(),
+                                ".");
+                if (port.get_partial_shape().is_static()) {
+                    const ov::Shape shape(array.shape(), array.shape() + array.ndim());
+                    OPENVINO_ASSERT(shape == port.get_shape(),
+                                    "Shape of the array bound as output ",
+                                    idx,
+                                    " must be ",
+                                    port.get_shape(),
+                                    ", got ",
+                                    shape,
+                                    ".");
+                }
+                self.m_request.set_tensor(port, Common::create_shared<ov::Tensor>(array));
+                bound_output = Common::utils::wrap_pyobject_to_sp(array);
+            }
+        },
+        py::arg("outputs"),
+        R"(
+            Binds numpy arrays as output tensors of InferRequest.
+
+            Results of every following inference are written directly into the bound arrays,
+            which are also returned by `infer` and `results` instead of new arrays.
+            It allows to avoid allocation of results on every inference call.
+            Bound arrays stay alive until they're unbound by passing `None`.
+
+            :param outputs: Arrays to bind. Key is index, name or port of the output.
+                            Array must be writeable, C contiguous or padded row-major,
+                            and have the same type and shape as the output.
+            :type outputs: dict[Union[int, str, openvino.ConstOutput], Optional[numpy.ndarray]]
+        )");
+
     cls.def(
         "get_profiling_info",
         [](InferRequestWrapper& self) {
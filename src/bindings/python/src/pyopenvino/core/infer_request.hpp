@@ -7,6 +7,8 @@
 #include <pybind11/pybind11.h>
 
 #include <chrono>
+#include <memory>
+#include <vector>
 #include <openvino/runtime/infer_request.hpp>
 
 #include "openvino/core/except.hpp"
@@ -36,7 +38,8 @@ public:
         : m_request{std::move(request)},
           m_inputs{inputs},
           m_outputs{outputs},
-          m_userdata{Common::utils::wrap_pyobject_to_sp(std::move(userdata))} {
+          m_userdata{Common::utils::wrap_pyobject_to_sp(std::move(userdata))},
+          m_output_arrays{std::make_shared<std::vector<std::shared_ptr<py::object>>>(outputs.size())} {
         m_start_time = std::make_shared<Time::time_point>(Time::time_point{});
         m_end_time = std::make_shared<Time::time_point>(Time::time_point{});
 
@@ -82,6 +85,9 @@ public:
     bool m_user_callback_defined = false;
     // Data that is passed by user from Python->C++
     std::shared_ptr<py::object> m_userdata;
+    // Arrays bound by user as output tensors, they're returned as results instead of new arrays.
+    // Shared between copies of the wrapper as the underlying ov::InferRequest is.
+    std::shared_ptr<std::vector<std::shared_ptr<py::object>>> m_output_arrays;
     // Times of inference's start and finish
     std::shared_ptr<Time::time_point> m_start_time;  // proposal: change to unique_ptr
     std::shared_ptr<Time::time_point> m_end_time;
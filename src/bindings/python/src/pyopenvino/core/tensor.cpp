@@ -8,6 +8,8 @@
 #include <pybind11/stl.h>
 #include <pybind11/typing.h>
 
+#include <tuple>
+
 #include "openvino/runtime/tensor.hpp"
 #include "pyopenvino/core/common.hpp"
 #include "pyopenvino/core/remote_tensor.hpp"
@@ -33,7 +35,8 @@ void regclass_Tensor(py::module m) {
                 :param shared_memory: If `True`, this Tensor memory is being shared with a host.
                                       Any action performed on the host memory is reflected on this Tensor's memory!
                                       If `False`, data is being copied to this Tensor.
-                                      Requires data to be C_CONTIGUOUS if `True`.
+                                      Requires data to be C_CONTIGUOUS or a padded row-major array,
+                                      e.g. a slice of innermost dimensions, if `True`.
                                       If the passed array contains strings, the flag must be set to `False'.
                 :type shared_memory: bool
             )");
@@ -516,6 +519,69 @@ void regclass_Tensor(py::module m) {
             Tensor's shape get/set.
         )");
 
+    cls.def(
+        "__dlpack__",
+        [](py::object& self,
+           const py::object& stream,
+           const py::object& max_version,
+           const py::object& dl_device,
+           const py::object& copy) {
+            if (!stream.is_none()) {
+                throw py::buffer_error("Tensor is located in host memory, stream must be None.");
+            }
+            if (!dl_device.is_none() && dl_device.cast<std::tuple<int32_t, int32_t>>() != std::make_tuple(1, 0)) {
+                throw py::buffer_error("Tensor can be exported only to host memory.");
+            }
+            return Common::dlpack_helpers::to_dlpack(self, !copy.is_none() && copy.cast<bool>());
+        },
+        py::arg("stream") = py::none(),
+        py::kw_only(),
+        py::arg("max_version") = py::none(),
+        py::arg("dl_device") = py::none(),
+        py::arg("copy") = py::none(),
+        R"(
+            Exports Tensor as a DLPack capsule, the capsule shares memory with the Tensor.
+            Allows zero-copy exchange with frameworks supporting DLPack, e.g. `numpy.from_dlpack(tensor)`
+            or `torch.from_dlpack(tensor)`.
+
+            :param stream: Must be None, as Tensor is located in host memory.
+            :type stream: Optional[int]
+            :param max_version: Maximum DLPack version supported by the consumer. Not used.
+            :type max_version: Optional[tuple[int, int]]
+            :param dl_device: Device to export the Tensor to, only host device (1, 0) is supported.
+            :type dl_device: Optional[tuple[int, int]]
+            :param copy: If `True`, the data is copied to the exported capsule.
+            :type copy: Optional[bool]
+            :rtype: PyCapsule
+        )");
+
+    cls.def(
+        "__dlpack_device__",
+        [](const ov::Tensor&) {
+            // kDLCPU device with id 0
+            return std::make_tuple(1, 0);
+        },
+        R"(
+            Returns device type and id of the Tensor in DLPack convention.
+
+            :rtype: tuple[int, int]
+        )");
+
+    cls.def_static("from_dlpack",
+                   &Common::dlpack_helpers::from_dlpack,
+                   py::arg("source"),
+                   R"(
+            Creates Tensor sharing memory with an object implementing DLPack protocol, e.g.
+            numpy.ndarray or torch.Tensor, or with an unused DLPack capsule.
+            Any action performed on the source memory will be reflected on this Tensor's memory!
+
+            Source data must be located in host memory and have row-major layout, possibly padded.
+
+            :param source: Object implementing `__dlpack__` method or DLPack capsule.
+            :type source: Any
+            :rtype: openvino.Tensor
+        )");
+
     cls.def("__repr__", [](const ov::Tensor& self) {
         std::stringstream ss;
 
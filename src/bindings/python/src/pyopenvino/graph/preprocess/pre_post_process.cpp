@@ -156,6 +156,31 @@ static void regclass_graph_PreProcessSteps(py::module m) {
         py::arg("begin"),
         py::arg("end"));
 
+    steps.def(
+        "crop_and_resize",
+        [](ov::preprocess::PreProcessSteps& self,
+           const std::string& rois_tensor_name,
+           size_t dst_height,
+           size_t dst_width) {
+            return &self.crop_and_resize(rois_tensor_name, dst_height, dst_width);
+        },
+        py::arg("rois_tensor_name"),
+        py::arg("dst_height"),
+        py::arg("dst_width"),
+        R"(
+            Adds crop and resize of regions of interest. Each ROI of the new `rois_tensor_name` input,
+            given as [batch_index, x_1, y_1, x_2, y_2] row, is cropped and resized with bilinear interpolation.
+
+            :param rois_tensor_name: Tensor name of added {num_rois, 5} f32 input.
+            :type rois_tensor_name: str
+            :param dst_height: Height of each resized ROI.
+            :type dst_height: int
+            :param dst_width: Width of each resized ROI.
+            :type dst_width: int
+            :return: Reference to itself, allows chaining of calls in client's code in a builder-like manner.
+            :rtype: openvino.preprocess.PreProcessSteps
+        )");
+
     steps.def(
         "convert_layout",
         [](ov::preprocess::PreProcessSteps& self, const ov::Layout& layout = {}) {
@@ -7,7 +7,7 @@ import pytest
 
 import openvino.opset13 as ops
 
-from openvino import Core, Layout, Model, Shape, Tensor, Type
+from openvino import Core, Layout, Model, PartialShape, Shape, Tensor, Type
 from openvino.utils.decorators import custom_preprocess_function
 from openvino import Output
 from openvino.preprocess import PrePostProcessor, ColorFormat, ResizeAlgorithm, PaddingMode
@@ -525,6 +525,28 @@ def test_graph_preprocess_crop():
         assert op in model_operators
 
 
+def test_graph_preprocess_crop_and_resize():
+    orig_shape = [-1, 3, 32, 32]
+    tensor_shape = [1, 3, 480, 640]
+    parameter_a = ops.parameter(orig_shape, dtype=np.float32, name="A")
+    model = ops.relu(parameter_a)
+    model = Model(model, [parameter_a], "TestModel")
+
+    ppp = PrePostProcessor(model)
+    ppp.input().tensor().set_shape(tensor_shape).set_layout(Layout("NCHW"))
+    ppp.input().preprocess().crop_and_resize("rois", 32, 32)
+    model = ppp.build()
+
+    model_operators = [op.get_name().split("_")[0] for op in model.get_ops()]
+    assert "ROIAlign" in model_operators
+    assert len(model.inputs) == 2
+    assert model.input(1).get_any_name() == "rois"
+    assert model.input(1).get_element_type() == Type.f32
+    assert model.input(1).get_partial_shape() == PartialShape([-1, 5])
+    assert list(model.input(0).get_shape()) == tensor_shape
+    assert model.get_output_partial_shape(0) == PartialShape([-1, 3, 32, 32])
+
+
 def test_graph_preprocess_resize_algorithm():
     shape = [1, 1, 3, 3]
     parameter_a = ops.parameter(shape, dtype=np.float32, name="A")
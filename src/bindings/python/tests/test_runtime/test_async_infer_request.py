@@ -189,6 +189,61 @@ def test_infer_queue_get_idle_handle(device):
     queue.wait_all()
 
 
+@pytest.mark.parametrize("with_callback", [True, False])
+def test_infer_queue_request_started_directly(device, with_callback):
+    param = ops.parameter([10])
+    model = Model(ops.relu(param), [param])
+    core = Core()
+    compiled_model = core.compile_model(model, device)
+    queue = AsyncInferQueue(compiled_model, 2)
+    finished = []
+    if with_callback:
+        queue.set_callback(lambda request, userdata: finished.append(userdata))
+
+    # requests completed outside the queue must not be returned to the pool twice
+    for _ in range(10):
+        queue[0].start_async()
+        queue[0].wait()
+    queue.wait_all()
+
+    jobs = 6
+    for job_id in range(jobs):
+        queue.start_async(userdata=job_id)
+    queue.wait_all()
+    assert queue.is_ready()
+    if with_callback:
+        assert sorted(job_id for job_id in finished if job_id is not None) == list(range(jobs))
+
+
+def test_infer_queue_polling(device):
+    jobs = 8
+    core = Core()
+    param = ops.parameter([10], np.float32)
+    model = Model(ops.relu(param), [param])
+    compiled_model = core.compile_model(model, device)
+    queue = AsyncInferQueue(compiled_model, 2, polling=True)
+    assert list(queue.completed()) == []
+
+    with pytest.raises(RuntimeError) as e:
+        queue.set_callback(lambda request, userdata: None)
+    assert "polling mode" in str(e.value)
+
+    results = {}
+    submitted = 0
+    while len(results) < jobs:
+        while submitted < jobs and queue.is_ready():
+            queue.start_async({0: np.full(10, -submitted, dtype=np.float32) + 1}, submitted)
+            submitted += 1
+        for request, job_id in queue.completed():
+            results[job_id] = request.get_output_tensor().data.copy()
+    queue.wait_all()
+
+    for job_id in range(jobs):
+        assert np.array_equal(results[job_id], np.maximum(np.full(10, 1 - job_id, dtype=np.float32), 0))
+    assert list(queue.completed()) == []
+    assert queue.is_ready()
+
+
 @pytest.mark.parametrize("share_inputs", [True, False])
 def test_results_async_infer(device, share_inputs):
     jobs = 8
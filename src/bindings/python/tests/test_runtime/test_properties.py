@@ -265,6 +265,7 @@ def test_properties_ro(ov_property_ro, expected_value):
         ),
         (props.force_tbb_terminate, "FORCE_TBB_TERMINATE", ((True, True), (False, False))),
         (props.enable_mmap, "ENABLE_MMAP", ((True, True), (False, False))),
+        (props.enable_compiled_model_sharing, "ENABLE_COMPILED_MODEL_SHARING", ((True, True), (False, False))),
         (
             props.weights_path,
             "WEIGHTS_PATH",
@@ -371,6 +372,13 @@ def test_properties_ro(ov_property_ro, expected_value):
                 (0.1, np.float32(0.1)),
                 (2.0, 2.0),
             ),
+        ),
+            intel_cpu.sparse_float_weights_rate,
+            "CPU_SPARSE_FLOAT_WEIGHTS_RATE",
+            (
+                (0.1, np.float32(0.1)),
+                (2.0, 2.0),
+            ),
         ),
         (
             intel_cpu.tbb_partitioner,
@@ -372,6 +372,40 @@ def test_get_results(device, share_inputs):
         assert np.array_equal(results[output], request.results[output])
 
 
+def test_infer_with_bound_output_arrays(device):
+    core = Core()
+    data = ops.parameter([10], np.float32)
+    model = Model([ops.relu(data), ops.abs(data)], [data])
+    compiled_model = core.compile_model(model, device)
+    request = compiled_model.create_infer_request()
+    relu_out = np.zeros(10, dtype=np.float32)
+    abs_out = np.zeros(10, dtype=np.float32)
+    request.set_output_arrays({0: relu_out, compiled_model.output(1): abs_out})
+
+    for _ in range(3):
+        inputs = np.random.normal(size=10).astype(np.float32)
+        results = request.infer(inputs)
+        assert results[0] is relu_out
+        assert results[1] is abs_out
+        assert request.results[0] is relu_out
+        assert np.array_equal(relu_out, np.maximum(inputs, 0))
+        assert np.array_equal(abs_out, np.abs(inputs))
+
+    request.set_output_arrays({0: None})
+    results = request.infer(inputs)
+    assert results[0] is not relu_out
+    assert not np.shares_memory(results[0], relu_out)
+    assert results[1] is abs_out
+
+    with pytest.raises(RuntimeError) as e:
+        request.set_output_arrays({0: np.zeros(10, dtype=np.int32)})
+    assert "must be f32" in str(e.value)
+
+    with pytest.raises(RuntimeError) as e:
+        request.set_output_arrays({1: np.zeros(5, dtype=np.float32)})
+    assert "Shape of the array bound as output 1 must be [10]" in str(e.value)
+
+
 @pytest.mark.skipif(
     os.environ.get("TEST_DEVICE") not in ["GPU"],
     reason="Device dependent test",
@@ -255,6 +255,46 @@ def test_init_with_roi_tensor():
     assert np.array_equal(ov_tensor1.data[0:1, :, 24:, 24:], ov_tensor2.data)
 
 
+def test_init_with_numpy_padded_shared_memory():
+    array = np.random.normal(size=[2, 3, 48, 64]).astype(np.float32)
+    padded = array[:, :, :, :48]
+    ov_tensor = ov.Tensor(padded, shared_memory=True)
+    assert list(ov_tensor.shape) == [2, 3, 48, 48]
+    assert list(ov_tensor.strides) == list(padded.strides)
+    assert np.shares_memory(array, ov_tensor.data)
+    assert np.array_equal(ov_tensor.data, padded)
+
+
+@pytest.mark.skipif(not hasattr(np, "from_dlpack"), reason="DLPack is not supported by numpy")
+@pytest.mark.parametrize("numpy_dtype", [np.float32, np.float16, np.int8, np.uint64])
+def test_dlpack_exchange_with_numpy(numpy_dtype):
+    array = np.ones([2, 3, 4], dtype=numpy_dtype)
+    ov_tensor = ov.Tensor.from_dlpack(array)
+    assert ov_tensor.shape == ov.Shape([2, 3, 4])
+    assert np.shares_memory(array, ov_tensor.data)
+    assert ov_tensor.__dlpack_device__() == (1, 0)
+
+    exported = np.from_dlpack(ov_tensor)
+    assert exported.dtype == numpy_dtype
+    assert np.shares_memory(array, exported)
+    del array, ov_tensor
+    assert np.array_equal(exported, np.ones([2, 3, 4], dtype=numpy_dtype))
+
+
+@pytest.mark.skipif(not hasattr(np, "from_dlpack"), reason="DLPack is not supported by numpy")
+def test_dlpack_strided_source():
+    array = np.arange(2 * 4 * 6, dtype=np.float32).reshape(2, 4, 6)
+    ov_tensor = ov.Tensor.from_dlpack(array[:, 1:3, 2:4])
+    assert ov_tensor.shape == ov.Shape([2, 2, 2])
+    assert np.shares_memory(array, ov_tensor.data)
+    assert np.array_equal(ov_tensor.data, array[:, 1:3, 2:4])
+
+    with pytest.raises(BufferError):
+        ov.Tensor.from_dlpack(array.transpose())
+    with pytest.raises(TypeError):
+        ov.Tensor.from_dlpack([1, 2, 3])
+
+
 @pytest.mark.parametrize(
     ("ov_type", "numpy_dtype"),
     [
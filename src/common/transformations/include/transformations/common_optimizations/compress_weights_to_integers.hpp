@@ -0,0 +1,40 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "transformations_visibility.hpp"
+
+namespace ov {
+namespace pass {
+
+class TRANSFORMATIONS_API CompressWeightsToIntegers;
+
+}  // namespace pass
+}  // namespace ov
+
+/**
+ * @ingroup ov_transformation_common_api
+ * @brief CompressWeightsToIntegers transformation replaces floating point MatMul weights with data-free
+ * quantized integer Constants followed by a decompression subgraph:
+ *
+ *     Constant(i8/u8/i4/u4) -> Convert -> [Subtract(zero point)] -> Multiply(scale) -> [Reshape] -> MatMul
+ *
+ * Signed types (i8, i4) produce symmetric compression without zero points, unsigned types (u8, u4)
+ * produce asymmetric compression with zero points. Scales are computed per output channel when
+ * group_size is 0, otherwise per group of group_size elements along the reduction axis of the MatMul.
+ * Weights whose reduction dimension is not divisible by group_size are compressed per output channel.
+ * The produced subgraph matches the compressed weights pattern fused by plugins into compressed
+ * FullyConnected.
+ */
+class ov::pass::CompressWeightsToIntegers : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("CompressWeightsToIntegers");
+    /// @brief Transformation constructor
+    /// @param weights_type Destination type of the weights: i8, u8, i4 or u4.
+    /// @param group_size Number of elements along the reduction axis that share a scale, 0 means per channel.
+    CompressWeightsToIntegers(const ov::element::Type& weights_type, size_t group_size = 0);
+};
@@ -0,0 +1,188 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/compress_weights_to_integers.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "itt.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformations/rt_info/decompression.hpp"
+
+namespace v0 = ov::op::v0;
+namespace v1 = ov::op::v1;
+
+namespace ov::pass {
+
+namespace {
+
+// 2D weights are viewed as [outer, n_groups, group_size, inner] where the reduction axis of the MatMul is split
+// into n_groups * group_size. For transpose_b == true (weights are [OC, IC]) inner == 1, otherwise
+// (weights are [IC, OC]) outer == 1. Each (outer, group, inner) triple shares one scale and zero point.
+struct WeightsLayout {
+    size_t outer;
+    size_t n_groups;
+    size_t group_size;
+    size_t inner;
+};
+
+struct QuantizedWeights {
+    std::vector<int32_t> values;
+    std::vector<float> scales;
+    std::vector<int32_t> zero_points;
+};
+
+QuantizedWeights quantize(const std::vector<float>& weights, const WeightsLayout& layout, const element::Type& type) {
+    const bool symmetric = type.is_signed();
+    const int32_t q_min = symmetric ? -(1 << (type.bitwidth() - 1)) : 0;
+    const int32_t q_max = symmetric ? (1 << (type.bitwidth() - 1)) - 1 : (1 << type.bitwidth()) - 1;
+
+    const size_t n_scales = layout.outer * layout.n_groups * layout.inner;
+    QuantizedWeights result;
+    result.values.resize(weights.size());
+    result.scales.resize(n_scales);
+    if (!symmetric) {
+        result.zero_points.resize(n_scales);
+    }
+
+    ov::parallel_for(n_scales, [&](size_t s) {
+        const size_t i = s % layout.inner;
+        const size_t group_idx = s / layout.inner;
+        const size_t base = group_idx * layout.group_size * layout.inner + i;
+
+        float min_val = 0.f;
+        float max_val = 0.f;
+        for (size_t k = 0; k < layout.group_size; ++k) {
+            const float w = weights[base + k * layout.inner];
+            min_val = std::min(min_val, w);
+            max_val = std::max(max_val, w);
+        }
+
+        float scale = 0.f;
+        int32_t zero_point = 0;
+        if (symmetric) {
+            scale = std::max(std::abs(min_val), std::abs(max_val)) / static_cast<float>(q_max);
+        } else {
+            scale = (max_val - min_val) / static_cast<float>(q_max - q_min);
+        }
+        if (scale == 0.f || !std::isfinite(scale)) {
+            scale = 1.f;
+        }
+        if (!symmetric) {
+            zero_point = std::clamp(static_cast<int32_t>(std::round(-min_val / scale)), q_min, q_max);
+            result.zero_points[s] = zero_point;
+        }
+        result.scales[s] = scale;
+
+        for (size_t k = 0; k < layout.group_size; ++k) {
+            const size_t idx = base + k * layout.inner;
+            const auto q = static_cast<int32_t>(std::round(weights[idx] / scale)) + zero_point;
+            result.values[idx] = std::clamp(q, q_min, q_max);
+        }
+    });
+    return result;
+}
+
+}  // namespace
+
+CompressWeightsToIntegers::CompressWeightsToIntegers(const ov::element::Type& weights_type, size_t group_size) {
+    MATCHER_SCOPE(CompressWeightsToIntegers);
+    OPENVINO_ASSERT(weights_type == ov::element::i8 || weights_type == ov::element::u8 ||
+                        weights_type == ov::element::i4 || weights_type == ov::element::u4,
+                    "CompressWeightsToIntegers: unsupported weights type ",
+                    weights_type);
+
+    auto weights_m = pattern::wrap_type<v0::Constant>(
+        pattern::type_matches_any({ov::element::f32, ov::element::f16, ov::element::bf16}) &&
+        pattern::rank_equals(2));
+    auto matmul_m = pattern::wrap_type<v0::MatMul>({pattern::any_input(), weights_m});
+
+    ov::matcher_pass_callback callback = [OV_CAPTURE_CPY_AND_THIS](pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        auto matmul = ov::as_type_ptr<v0::MatMul>(pattern_map.at(matmul_m).get_node_shared_ptr());
+        auto weights = ov::as_type_ptr<v0::Constant>(pattern_map.at(weights_m).get_node_shared_ptr());
+        if (!matmul || !weights || transformation_callback(matmul)) {
+            return false;
+        }
+
+        const auto& shape = weights->get_shape();
+        if (ov::shape_size(shape) == 0) {
+            return false;
+        }
+
+        // the reduction axis of the weights is the last one if transpose_b is set and the first one otherwise
+        const bool reduce_last = matmul->get_transpose_b();
+        const size_t ic = reduce_last ? shape[1] : shape[0];
+        const size_t oc = reduce_last ? shape[0] : shape[1];
+        const bool grouped = group_size != 0 && group_size < ic && ic % group_size == 0;
+
+        WeightsLayout layout{reduce_last ? oc : 1, grouped ? ic / group_size : 1, grouped ? group_size : ic, 1};
+        layout.inner = reduce_last ? 1 : oc;
+
+        ov::Shape compressed_shape = shape;
+        ov::Shape scale_shape;
+        if (grouped) {
+            compressed_shape = reduce_last ? ov::Shape{oc, layout.n_groups, layout.group_size}
+                                           : ov::Shape{layout.n_groups, layout.group_size, oc};
+            scale_shape = reduce_last ? ov::Shape{oc, layout.n_groups, 1} : ov::Shape{layout.n_groups, 1, oc};
+        } else {
+            scale_shape = reduce_last ? ov::Shape{oc, 1} : ov::Shape{1, oc};
+        }
+
+        const auto float_type = weights->get_element_type();
+        const auto quantized = quantize(weights->cast_vector<float>(), layout, weights_type);
+
+        auto compressed = std::make_shared<v0::Constant>(weights_type, compressed_shape, quantized.values);
+        auto convert = std::make_shared<v0::Convert>(compressed, float_type);
+        ov::mark_as_decompression(convert);
+        ov::NodeVector new_nodes{compressed, convert};
+
+        std::shared_ptr<ov::Node> decompressed = convert;
+        if (!quantized.zero_points.empty()) {
+            auto zero_point = std::make_shared<v0::Constant>(weights_type, scale_shape, quantized.zero_points);
+            auto zero_point_convert = std::make_shared<v0::Convert>(zero_point, float_type);
+            ov::mark_as_decompression(zero_point_convert);
+            decompressed = std::make_shared<v1::Subtract>(decompressed, zero_point_convert);
+            new_nodes.insert(new_nodes.end(), {zero_point, zero_point_convert, decompressed});
+        }
+
+        auto scale = std::make_shared<v0::Constant>(float_type, scale_shape, quantized.scales);
+        decompressed = std::make_shared<v1::Multiply>(decompressed, scale);
+        new_nodes.insert(new_nodes.end(), {scale, decompressed});
+
+        if (grouped) {
+            auto target_shape = v0::Constant::create(ov::element::i64, ov::Shape{shape.size()}, shape);
+            decompressed = std::make_shared<v1::Reshape>(decompressed, target_shape, false);
+            new_nodes.insert(new_nodes.end(), {target_shape, decompressed});
+        }
+
+        compressed->set_friendly_name(weights->get_friendly_name() + "_compressed");
+        decompressed->set_friendly_name(weights->get_friendly_name());
+        ov::copy_runtime_info(weights, new_nodes);
+        // weights shared by several MatMuls with the same layout are compressed once, so the saved IR keeps
+        // a single copy of them
+        for (const auto& consumer : weights->output(0).get_target_inputs()) {
+            auto consumer_matmul = ov::as_type<v0::MatMul>(consumer.get_node());
+            if (consumer_matmul && consumer.get_index() == 1 && consumer_matmul->get_transpose_b() == reduce_last &&
+                !transformation_callback(consumer_matmul->shared_from_this())) {
+                consumer.replace_source_output(decompressed);
+            }
+        }
+        return true;
+    };
+
+    auto m = std::make_shared<pattern::Matcher>(matmul_m, matcher_name);
+    this->register_matcher(m, callback);
+}
+
+}  // namespace ov::pass
@@ -0,0 +1,104 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/compress_weights_to_integers.hpp"
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/pass/manager.hpp"
+#include "transformations/rt_info/decompression.hpp"
+
+using namespace testing;
+using namespace ov;
+
+namespace v0 = ov::op::v0;
+namespace v1 = ov::op::v1;
+
+TEST_F(TransformationTestsF, CompressWeightsToIntegersU8PerChannel) {
+    {
+        auto input = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, 4});
+        auto weights = v0::Constant::create(element::f32, Shape{2, 4}, {0.f, 1.f, 2.f, 3.f, -2.f, 0.f, 2.f, 4.f});
+        auto matmul = std::make_shared<v0::MatMul>(input, weights, false, true);
+        model = std::make_shared<Model>(OutputVector{matmul}, ParameterVector{input});
+        manager.register_pass<ov::pass::CompressWeightsToIntegers>(element::u8);
+    }
+    {
+        auto input = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, 4});
+        auto weights = v0::Constant::create(element::u8, Shape{2, 4}, {0, 85, 170, 255, 0, 85, 170, 255});
+        auto convert = std::make_shared<v0::Convert>(weights, element::f32);
+        mark_as_decompression(convert);
+        auto zero_point = v0::Constant::create(element::u8, Shape{2, 1}, {0, 85});
+        auto zero_point_convert = std::make_shared<v0::Convert>(zero_point, element::f32);
+        mark_as_decompression(zero_point_convert);
+        auto subtract = std::make_shared<v1::Subtract>(convert, zero_point_convert);
+        auto scale = v0::Constant::create(element::f32, Shape{2, 1}, {3.f / 255.f, 6.f / 255.f});
+        auto multiply = std::make_shared<v1::Multiply>(subtract, scale);
+        auto matmul = std::make_shared<v0::MatMul>(input, multiply, false, true);
+        model_ref = std::make_shared<Model>(OutputVector{matmul}, ParameterVector{input});
+    }
+    comparator.enable(FunctionsComparator::CONST_VALUES);
+}
+
+TEST_F(TransformationTestsF, CompressWeightsToIntegersI4Grouped) {
+    {
+        auto input = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, 4});
+        auto weights = v0::Constant::create(element::f32, Shape{4, 2}, {7.f, -1.f, -3.5f, 7.f, 14.f, 0.f, 7.f, 0.f});
+        auto matmul = std::make_shared<v0::MatMul>(input, weights);
+        model = std::make_shared<Model>(OutputVector{matmul}, ParameterVector{input});
+        manager.register_pass<ov::pass::CompressWeightsToIntegers>(element::i4, 2);
+    }
+    {
+        auto input = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, 4});
+        auto weights = v0::Constant::create(element::i4, Shape{2, 2, 2}, {7, -1, -4, 7, 7, 0, 4, 0});
+        auto convert = std::make_shared<v0::Convert>(weights, element::f32);
+        mark_as_decompression(convert);
+        auto scale = v0::Constant::create(element::f32, Shape{2, 1, 2}, {1.f, 1.f, 2.f, 1.f});
+        auto multiply = std::make_shared<v1::Multiply>(convert, scale);
+        auto target_shape = v0::Constant::create(element::i64, Shape{2}, {4, 2});
+        auto reshape = std::make_shared<v1::Reshape>(multiply, target_shape, false);
+        auto matmul = std::make_shared<v0::MatMul>(input, reshape);
+        model_ref = std::make_shared<Model>(OutputVector{matmul}, ParameterVector{input});
+    }
+    comparator.enable(FunctionsComparator::CONST_VALUES);
+}
+
+TEST_F(TransformationTestsF, CompressWeightsToIntegersSharedWeights) {
+    {
+        auto input = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, 4});
+        auto weights = v0::Constant::create(element::f32, Shape{2, 4}, {0.f, 1.f, 2.f, 3.f, -2.f, 0.f, 2.f, 4.f});
+        auto matmul_0 = std::make_shared<v0::MatMul>(input, weights, false, true);
+        auto matmul_1 = std::make_shared<v0::MatMul>(input, weights, false, true);
+        model = std::make_shared<Model>(OutputVector{matmul_0, matmul_1}, ParameterVector{input});
+        manager.register_pass<ov::pass::CompressWeightsToIntegers>(element::i8);
+    }
+    {
+        auto input = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, 4});
+        auto weights = v0::Constant::create(element::i8, Shape{2, 4}, {0, 42, 85, 127, -64, 0, 64, 127});
+        auto convert = std::make_shared<v0::Convert>(weights, element::f32);
+        mark_as_decompression(convert);
+        auto scale = v0::Constant::create(element::f32, Shape{2, 1}, {3.f / 127.f, 4.f / 127.f});
+        auto multiply = std::make_shared<v1::Multiply>(convert, scale);
+        auto matmul_0 = std::make_shared<v0::MatMul>(input, multiply, false, true);
+        auto matmul_1 = std::make_shared<v0::MatMul>(input, multiply, false, true);
+        model_ref = std::make_shared<Model>(OutputVector{matmul_0, matmul_1}, ParameterVector{input});
+    }
+    comparator.enable(FunctionsComparator::CONST_VALUES);
+}
+
+TEST_F(TransformationTestsF, CompressWeightsToIntegersSkipsNonConstantWeights) {
+    {
+        auto input = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, 4});
+        auto weights = std::make_shared<v0::Parameter>(element::f32, PartialShape{4, 2});
+        auto matmul = std::make_shared<v0::MatMul>(input, weights);
+        model = std::make_shared<Model>(OutputVector{matmul}, ParameterVector{input, weights});
+        manager.register_pass<ov::pass::CompressWeightsToIntegers>(element::u4, 2);
+    }
+}
@@ -34,6 +34,20 @@ public:
     virtual char* data() noexcept = 0;
     virtual size_t size() const noexcept = 0;
     virtual ~MappedMemory() = default;
+
+    /**
+     * @brief Releases physical pages backing the given range of the mapping.
+     * The data stays accessible and is read from the file again on the next access, so it is safe to call
+     * once the range has been consumed (e.g. weights were repacked by a plugin) to bound the resident memory.
+     * Only pages entirely covered by the range are released.
+     *
+     * @param data Pointer to the beginning of the range.
+     * @param size Size of the range in bytes.
+     * @return true if pages were released, false if the range is outside of the mapping or it is not supported.
+     */
+    virtual bool release(const char* /*data*/, size_t /*size*/) noexcept {
+        return false;
+    }
 };
 
 /**
@@ -61,4 +75,5 @@ template <typename T, std::enable_if_t<std::is_same<T, FileHandle>::value, int>
 std::shared_ptr<ov::MappedMemory> load_mmap_object(T handle) {
     return load_mmap_object_from_handle(static_cast<FileHandle>(handle));
 }
+
 }  // namespace ov
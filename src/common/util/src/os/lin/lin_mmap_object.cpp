@@ -105,6 +105,22 @@ public:
     size_t size() const noexcept override {
         return m_size;
     }
+
+    bool release(const char* data, size_t size) noexcept override {
+        const auto* begin = static_cast<const char*>(m_data);
+        if (m_data == MAP_FAILED || data == nullptr || size == 0 || data < begin || size > m_size ||
+            data - begin > static_cast<ptrdiff_t>(m_size - size)) {
+            return false;
+        }
+        const auto page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+        const auto aligned_begin = (reinterpret_cast<uintptr_t>(data) + page_size - 1) / page_size * page_size;
+        const auto aligned_end = (reinterpret_cast<uintptr_t>(data) + size) / page_size * page_size;
+        if (aligned_end <= aligned_begin) {
+            return false;
+        }
+        // the mapping is shared and read only, so dropped pages are read from the file again on the next access
+        return madvise(reinterpret_cast<void*>(aligned_begin), aligned_end - aligned_begin, MADV_DONTNEED) == 0;
+    }
 };
 
 std::shared_ptr<ov::MappedMemory> load_mmap_object(const std::filesystem::path& path) {
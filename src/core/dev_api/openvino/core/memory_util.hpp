@@ -4,11 +4,16 @@
 
 #pragma once
 
+#include <memory>
 #include <optional>
 
 #include "openvino/core/shape.hpp"
 #include "openvino/core/type/element_type.hpp"
 
+namespace ov {
+class MappedMemory;
+}  // namespace ov
+
 namespace ov::util {
 
 /**
@@ -54,4 +59,23 @@ constexpr size_t align_padding_size(size_t alignment, size_t pos) {
         return 0;
     }
 }
+
+/**
+ * @brief Registers memory mapped from a model file, so the pages of its ranges can be released by
+ * release_mapped_memory from any module: plugins get only raw pointers to the constants data.
+ * The registry does not extend the lifetime of the mapping.
+ *
+ * @param memory  Mapped memory created by load_mmap_object.
+ */
+OPENVINO_API void register_mapped_memory(const std::shared_ptr<ov::MappedMemory>& memory);
+
+/**
+ * @brief Releases physical pages backing the given range if it belongs to a live mapped memory registered by
+ * register_mapped_memory. The data stays accessible and is read from the file again on the next access.
+ *
+ * @param data  Pointer to the beginning of the range.
+ * @param size  Size of the range in bytes.
+ * @return true if pages were released, false otherwise.
+ */
+OPENVINO_API bool release_mapped_memory(const void* data, size_t size) noexcept;
 }  // namespace ov::util
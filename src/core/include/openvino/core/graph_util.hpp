@@ -319,4 +319,40 @@ void save_model(const std::shared_ptr<const ov::Model>& model,
 
 /// \}
 
+/// \brief Data-free weights compression modes supported by ov::save_model.
+enum class WeightsCompressionMode {
+    INT8_SYM,   //!< int8 weights with per output channel scales
+    INT8_ASYM,  //!< uint8 weights with per output channel scales and zero points
+    INT4_SYM,   //!< int4 weights with group-wise scales
+    INT4_ASYM,  //!< uint4 weights with group-wise scales and zero points
+};
+
+/// \brief Save given model into IR compressing MatMul weights to integers.
+/// Weights are replaced with low precision Constants followed by the decompression subgraph
+/// Convert -> [Subtract] -> Multiply that plugins fuse into compressed FullyConnected. Other floating point
+/// weights and the produced scales are compressed to FP16 if requested.
+/// \param model Model which will be converted to IR representation.
+/// \param output_model Path to the output model file, must have extension .xml.
+/// \param weights_compression Weights compression mode.
+/// \param group_size Number of weights along the reduction axis sharing a scale for INT4 modes (128 by default).
+///                   Weights whose reduction dimension is not divisible by group_size get per channel scales.
+/// \param compress_to_fp16 Whether to compress remaining floating point weights to FP16 (true by default).
+/// \{
+OPENVINO_API
+void save_model(const std::shared_ptr<const ov::Model>& model,
+                const std::filesystem::path& output_model,
+                WeightsCompressionMode weights_compression,
+                size_t group_size = 128,
+                bool compress_to_fp16 = true);
+
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT)
+OPENVINO_API
+void save_model(const std::shared_ptr<const ov::Model>& model,
+                const std::wstring& output_model,
+                WeightsCompressionMode weights_compression,
+                size_t group_size = 128,
+                bool compress_to_fp16 = true);
+#endif
+/// \}
+
 }  // namespace ov
@@ -164,6 +164,35 @@ public:
     /// \return Reference to 'this' to allow chaining with other calls in a builder-like manner.
     PreProcessSteps& crop(const std::vector<int>& begin, const std::vector<int>& end);
 
+    /// \brief Crop regions of interest (ROIs) from input images and resize each of them to given size with bilinear
+    /// interpolation. Under the hood, inserts `opset9::ROIAlign` operation to execution graph, so all ROIs of a frame
+    /// are processed by one operation and the result is a batch of `num_rois` images.
+    ///
+    /// The step adds a new model input named `rois_tensor_name` with `f32` element type and `{num_rois, 5}` shape.
+    /// Each row of it describes one ROI as `[batch_index, x_1, y_1, x_2, y_2]` in pixels of the input image, where
+    /// `batch_index` selects the image in the input batch and `x_2`, `y_2` are exclusive.
+    ///
+    /// Input layout shall have `N`, `C`, `H` and `W` dimensions. Use `ov::preprocess::InputTensorInfo::set_layout`
+    /// to define layout of image data.
+    ///
+    /// Example: model expects a batch of {N, 3, 224, 224} images, user has a full {1, 3, 1080, 1920} frame and a set
+    /// of detected boxes. Preprocessing may look like this:
+    ///
+    /// \code{.cpp}
+    /// auto proc = PrePostProcessor(model);
+    /// proc.input().tensor().set_shape({1, 3, 1080, 1920}).set_layout("NCHW");
+    /// proc.input().preprocess().crop_and_resize("rois", 224, 224);
+    /// \endcode
+    ///
+    /// \param rois_tensor_name Tensor name of added ROIs input.
+    ///
+    /// \param dst_height Height of each resized ROI.
+    ///
+    /// \param dst_width Width of each resized ROI.
+    ///
+    /// \return Reference to 'this' to allow chaining with other calls in a builder-like manner.
+    PreProcessSteps& crop_and_resize(const std::string& rois_tensor_name, size_t dst_height, size_t dst_width);
+
     /// \brief Add 'convert layout' operation to specified layout.
     ///
     /// \param dst_layout New layout after conversion. If not specified - destination layout is obtained from
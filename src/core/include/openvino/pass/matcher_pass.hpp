@@ -104,6 +104,12 @@ public:
         return m_matcher;
     }
 
+    /// \brief Returns true if the pass is applied only to nodes matched by its Matcher, i.e. it was created
+    /// with register_matcher. GraphRewrite uses it to skip the pass for nodes which can't match the pattern root.
+    bool is_matcher_driven() const {
+        return m_matcher_driven;
+    }
+
 protected:
     void register_matcher(const std::shared_ptr<pattern::Matcher>& m,
                           const matcher_pass_callback& callback,
@@ -115,6 +121,7 @@ private:
     handler_callback m_handler;
     std::shared_ptr<pattern::Matcher> m_matcher;
     NodeRegistry m_new_nodes;
+    bool m_matcher_driven = false;
 };
 }  // namespace pass
 }  // namespace ov
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <numeric>
 #include <utility>
@@ -12,6 +13,7 @@
 #include "openvino/op/util/attr_types.hpp"
 #include "openvino/reference/utils/coordinate_index.hpp"
 #include "openvino/reference/utils/coordinate_transform.hpp"
+#include "openvino/reference/utils/parallel_blocks.hpp"
 
 namespace ov {
 namespace reference {
@@ -71,17 +73,7 @@ inline size_t calculate_fixed_axis(size_t axis, const size_t* strides) {
         --axis;
     return axis;
 }
-}  // namespace internal
 
-/**
- * @brief Apply elementwise function for 2 inputs of same size.
- *
- * @param arg0  Pointer to input 0 data.
- * @param arg1  Pointer to input 1 data.
- * @param out   Pointer to output data.
- * @param count Number of elements in inputs
- * @param f     Binary elementwise functions.
- */
 template <typename T, typename U, class Functor>
 void no_broadcast_binop(const T* arg0, const T* arg1, U* out, const size_t count, Functor f) {
     for (auto last = arg0 + count; arg0 != last; ++arg0, ++arg1, ++out) {
@@ -89,16 +81,6 @@ void no_broadcast_binop(const T* arg0, const T* arg1, U* out, const size_t count
     }
 }
 
-/**
- * @brief Apply elementwise function for 2 inputs and apply NUMPY broadcasting.
- *
- * @param arg0       Pointer to input 0 data.
- * @param arg1       Pointer to input 1 data.
- * @param out        Pointer to output data.
- * @param arg0_shape Shape of input 0.
- * @param arg1_shape Shape of input 1.
- * @param f          Binary elementwise functions.
- */
 template <typename T, typename U, class Functor>
 void numpy_broadcast_binop(const T* arg0,
                            const T* arg1,
@@ -124,8 +106,6 @@ void numpy_broadcast_binop(const T* arg0,
     //                 Output shape
     //                 ------------
     //                 [ 3, 2, 6]
-    using namespace internal;
-
     const size_t shape_rank = std::max(arg0_shape.size(), arg1_shape.size()) + 1;
 
     // TODO: Use compiler-specific alloca() or variable-length array
@@ -203,6 +183,91 @@ void numpy_broadcast_binop(const T* arg0,
                                                   strides0[axis],
                                                   f);
 }
+}  // namespace internal
+
+/**
+ * @brief Apply elementwise function for 2 inputs of same size.
+ *
+ * @param arg0  Pointer to input 0 data.
+ * @param arg1  Pointer to input 1 data.
+ * @param out   Pointer to output data.
+ * @param count Number of elements in inputs
+ * @param f     Binary elementwise functions.
+ */
+template <typename T, typename U, class Functor>
+void no_broadcast_binop(const T* arg0, const T* arg1, U* out, const size_t count, Functor f) {
+    parallel_blocks(count, 1, [&](const size_t begin, const size_t end) {
+        internal::no_broadcast_binop(arg0 + begin, arg1 + begin, out + begin, end - begin, f);
+    });
+}
+
+/**
+ * @brief Apply elementwise function for 2 inputs and apply NUMPY broadcasting.
+ *
+ * @param arg0       Pointer to input 0 data.
+ * @param arg1       Pointer to input 1 data.
+ * @param out        Pointer to output data.
+ * @param arg0_shape Shape of input 0.
+ * @param arg1_shape Shape of input 1.
+ * @param f          Binary elementwise functions.
+ */
+template <typename T, typename U, class Functor>
+void numpy_broadcast_binop(const T* arg0,
+                           const T* arg1,
+                           U* out,
+                           const Shape& arg0_shape,
+                           const Shape& arg1_shape,
+                           Functor f) {
+    // Slices of the first not unit dimension of the output are independent, so blocks of them are broadcast in
+    // parallel. The leading unit dimensions are dropped, the blocks are described by the shapes of the slices.
+    const size_t rank = std::max(arg0_shape.size(), arg1_shape.size());
+    Shape shape0(rank - arg0_shape.size(), 1);
+    shape0.insert(shape0.end(), arg0_shape.begin(), arg0_shape.end());
+    Shape shape1(rank - arg1_shape.size(), 1);
+    shape1.insert(shape1.end(), arg1_shape.begin(), arg1_shape.end());
+
+    size_t axis = 0;
+    while (axis < rank && shape0[axis] == 1 && shape1[axis] == 1) {
+        ++axis;
+    }
+    if (axis == rank) {
+        internal::numpy_broadcast_binop(arg0, arg1, out, arg0_shape, arg1_shape, f);
+        return;
+    }
+
+    size_t out_slice_size = 1;
+    for (size_t i = axis + 1; i < rank; ++i) {
+        out_slice_size *= std::max(shape0[i], shape1[i]);
+    }
+    const size_t slice_size0 = shape_size(shape0.begin() + axis + 1, shape0.end());
+    const size_t slice_size1 = shape_size(shape1.begin() + axis + 1, shape1.end());
+    const size_t slices = std::max(shape0[axis], shape1[axis]);
+
+    parallel_blocks(slices, out_slice_size, [&](const size_t begin, const size_t end) {
+        if (begin == 0 && end == slices) {
+            internal::numpy_broadcast_binop(arg0, arg1, out, arg0_shape, arg1_shape, f);
+            return;
+        }
+        Shape block_shape0(shape0.begin() + axis, shape0.end());
+        Shape block_shape1(shape1.begin() + axis, shape1.end());
+        const T* block_arg0 = arg0;
+        const T* block_arg1 = arg1;
+        if (block_shape0[0] != 1) {
+            block_shape0[0] = end - begin;
+            block_arg0 += begin * slice_size0;
+        }
+        if (block_shape1[0] != 1) {
+            block_shape1[0] = end - begin;
+            block_arg1 += begin * slice_size1;
+        }
+        internal::numpy_broadcast_binop(block_arg0,
+                                        block_arg1,
+                                        out + begin * out_slice_size,
+                                        block_shape0,
+                                        block_shape1,
+                                        f);
+    });
+}
 
 /**
  * @brief Apply elementwise function for 2 inputs and apply PDPP broadcasting.
@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <numeric>
 
 #include "openvino/core/shape.hpp"
+#include "openvino/reference/utils/parallel_blocks.hpp"
 #include "utils/span.hpp"
 
 namespace ov {
@@ -30,27 +32,32 @@ void gather(const T* const data,
     int64_t batch_out_mul = shape_size(span(out_shape).subspan(batch_dims));
 
     int64_t axis_size = data_shape[axis];
-    int64_t data_offset, out_offset, idx;
-    // for out of bound indices is filled with zeros
-    std::fill(out, out + shape_size(out_shape), T{0});
-
-    for (int64_t batch = 0; batch < batch_size; batch++)
-        for (int64_t outer_idx = 0; outer_idx < outer_size; outer_idx++) {
-            data_offset = batch_data_mul * batch + inner_size * axis_size * outer_idx;
-            out_offset = batch_out_mul * batch + indices_size * inner_size * outer_idx;
-            for (int64_t i = 0; i < indices_size; i++) {
-                idx = indices[i + indices_size * batch];
-                if (idx < 0)
-                    idx += axis_size;
-                // for out of bound values have to be filled with zeros
-                if (idx >= axis_size || idx < 0)
-                    continue;
-
-                const auto src_begin = std::next(data, data_offset + inner_size * idx);
-                const auto out_ptr = std::next(out, out_offset + inner_size * i);
-                std::copy_n(src_begin, inner_size, out_ptr);
+
+    // work items are copies of inner_size elements, processed in parallel
+    const auto items = static_cast<size_t>(batch_size * outer_size * indices_size);
+    parallel_blocks(items, static_cast<size_t>(inner_size), [&](const size_t begin, const size_t end) {
+        for (auto item = static_cast<int64_t>(begin); item < static_cast<int64_t>(end); item++) {
+            const int64_t i = item % indices_size;
+            const int64_t outer_idx = (item / indices_size) % outer_size;
+            const int64_t batch = item / (indices_size * outer_size);
+
+            const int64_t data_offset = batch_data_mul * batch + inner_size * axis_size * outer_idx;
+            const int64_t out_offset = batch_out_mul * batch + indices_size * inner_size * outer_idx;
+            const auto out_ptr = std::next(out, out_offset + inner_size * i);
+
+            int64_t idx = indices[i + indices_size * batch];
+            if (idx < 0)
+                idx += axis_size;
+            // for out of bound indices is filled with zeros
+            if (idx >= axis_size || idx < 0) {
+                std::fill_n(out_ptr, inner_size, T{0});
+                continue;
             }
+
+            const auto src_begin = std::next(data, data_offset + inner_size * idx);
+            std::copy_n(src_begin, inner_size, out_ptr);
         }
+    });
 }
 
 }  // namespace reference
@@ -11,6 +11,7 @@
 #include "openvino/core/shape_util.hpp"
 #include "openvino/reference/utils/coordinate_index.hpp"
 #include "openvino/reference/utils/coordinate_transform.hpp"
+#include "openvino/reference/utils/reduction_loop.hpp"
 
 namespace ov {
 namespace reference {
@@ -30,17 +31,9 @@ void reduce_min(const T* in, T* out, const Shape& in_shape, const AxisSet& reduc
     const auto out_shape = util::reduce(in_shape, reduction_axes);
     std::fill(out, out + shape_size(out_shape), max_value);
 
-    const auto in_strides = row_major_strides(in_shape);
-    const auto out_strides = row_major_strides(out_shape);
-
-    CoordinateTransformBasic input_transform(in_shape);
-    for (const auto& in_coord : input_transform) {
-        const auto out_coord = util::reduce(in_coord, reduction_axes);
-        const auto in_idx = coordinate_offset(in_coord, in_strides);
-        const auto out_idx = coordinate_offset(out_coord, out_strides);
-
+    for_each_reduction(in_shape, reduction_axes, [&](const size_t out_idx, const size_t in_idx) {
         out[out_idx] = std::min(out[out_idx], in[in_idx]);
-    }
+    });
 }
 }  // namespace reference
 }  // namespace ov
@@ -12,6 +12,7 @@
 #include "openvino/core/type/float16.hpp"
 #include "openvino/reference/utils/coordinate_index.hpp"
 #include "openvino/reference/utils/coordinate_transform.hpp"
+#include "openvino/reference/utils/reduction_loop.hpp"
 #include "openvino/reference/utils/type_util.hpp"
 
 namespace ov {
@@ -78,17 +79,9 @@ void reduce_sum(const T* in, T* out, const Shape& in_shape, const AxisSet& reduc
     std::vector<T> cs(out_size, T{0});
     std::fill(out, std::next(out, out_size), T{0});
 
-    const auto in_strides = row_major_strides(in_shape);
-    const auto out_strides = row_major_strides(out_shape);
-
-    CoordinateTransformBasic input_transform(in_shape);
-    for (const auto& in_coord : input_transform) {
-        const auto out_coord = util::reduce(in_coord, reduction_axes);
-        const auto in_idx = coordinate_offset(in_coord, in_strides);
-        const auto out_idx = coordinate_offset(out_coord, out_strides);
-
+    for_each_reduction(in_shape, reduction_axes, [&](const size_t out_idx, const size_t in_idx) {
         out[out_idx] = details::kahan_summation(in[in_idx], out[out_idx], cs[out_idx]);
-    }
+    });
 }
 }  // namespace reference
 }  // namespace ov
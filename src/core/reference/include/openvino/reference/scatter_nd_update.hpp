@@ -16,6 +16,7 @@
 #include "openvino/reference/multiply.hpp"
 #include "openvino/reference/or.hpp"
 #include "openvino/reference/subtract.hpp"
+#include "openvino/reference/utils/parallel_blocks.hpp"
 #include "openvino/reference/xor.hpp"
 #include "utils/span.hpp"
 
@@ -89,6 +90,7 @@ void scatterNdUpdate(
     const auto reduction = scatter_nd_update::reduction_functor_for<dataType>(reduction_type);
     std::vector<indicesType> indicesCopy(indices, indices + shape_size(indicesShape));
     const auto num_of_updates = shape_size(span(indicesShape).drop_back(1));
+    std::vector<uint64_t> out_indices(num_of_updates);
     for (size_t i = 0; i != num_of_updates; ++i) {
         const auto indices_coord = indicesCopy.data() + i * indicesShape.back();
         const auto coord = span(indices_coord, indicesShape.back());
@@ -103,20 +105,24 @@ void scatterNdUpdate(
         }
 
         const auto out_index = std::inner_product(begin(coord), end(coord), begin(input_data_dim_pading), uint64_t(0));
-
-        const auto update_data = updates + i * update_el_number;
         OPENVINO_ASSERT(out_index >= 0 && out_index + update_el_number <= shape_size(dataShape),
                         "Index is out of bounds");
-        if (reduction) {
-            std::transform(outBuf + out_index,
-                           outBuf + out_index + update_el_number,
-                           update_data,
-                           outBuf + out_index,
-                           reduction);
-        } else {
-            std::memcpy(outBuf + out_index, update_data, update_el_number * sizeof(dataType));
-        }
+        out_indices[i] = out_index;
     }
+
+    // Updates may overlap, so the update chunk is split between threads instead of the updates, every element still
+    // receives the updates in order.
+    parallel_blocks(update_el_number, num_of_updates, [&](const size_t begin, const size_t end) {
+        for (size_t i = 0; i != num_of_updates; ++i) {
+            const auto out_data = outBuf + out_indices[i];
+            const auto update_data = updates + i * update_el_number;
+            if (reduction) {
+                std::transform(out_data + begin, out_data + end, update_data + begin, out_data + begin, reduction);
+            } else {
+                std::memcpy(out_data + begin, update_data + begin, (end - begin) * sizeof(dataType));
+            }
+        }
+    });
 }
 }  // namespace reference
 }  // namespace ov
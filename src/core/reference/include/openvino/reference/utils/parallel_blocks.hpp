@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <vector>
+
+#include "openvino/core/parallel.hpp"
+
+namespace ov {
+namespace reference {
+
+/**
+ * @brief Minimal number of elements processed by a single thread of the reference kernels.
+ *
+ * Reference kernels are used by constant folding on small tensors as well, such tensors are processed in the calling
+ * thread without threading overhead.
+ */
+constexpr size_t parallel_block_min_elements = 32768;
+
+/**
+ * @brief Splits range of independent work items into contiguous blocks processed in parallel.
+ *
+ * Exceptions thrown by the function are rethrown in the calling thread, so the kernels keep their error reporting
+ * regardless of the threading backend.
+ *
+ * @param count      Number of work items.
+ * @param item_size  Number of elements processed per work item, used to limit the number of blocks.
+ * @param func       Function called with [begin, end) range of work items.
+ */
+template <class F>
+void parallel_blocks(const size_t count, const size_t item_size, F&& func) {
+    const auto elements = count * std::max<size_t>(item_size, 1);
+    const auto blocks = std::min({elements / parallel_block_min_elements,
+                                  count,
+                                  static_cast<size_t>(std::max(parallel_get_max_threads(), 1))});
+    if (blocks <= 1) {
+        func(size_t{0}, count);
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(blocks);
+    parallel_nt(static_cast<int>(blocks), [&](const int ithr, const int nthr) {
+        size_t begin = 0, end = 0;
+        splitter(count, nthr, ithr, begin, end);
+        if (begin < end) {
+            try {
+                func(begin, end);
+            } catch (...) {
+                errors[ithr] = std::current_exception();
+            }
+        }
+    });
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+}  // namespace reference
+}  // namespace ov
@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "openvino/core/axis_set.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/reference/utils/parallel_blocks.hpp"
+
+namespace ov {
+namespace reference {
+
+/**
+ * @brief Visits input elements of reduction grouped by the output element they are reduced into.
+ *
+ * Output elements are independent, so they are split between threads. Input elements of one output are visited in
+ * row-major order, the same order as sequential iteration over the input, so reductions sensitive to the order of
+ * accumulation give the same results.
+ *
+ * @param in_shape        Input shape.
+ * @param reduction_axes  Axes on which reduction is applied.
+ * @param func            Function called with (output index, input index) for every input element.
+ */
+template <class F>
+void for_each_reduction(const Shape& in_shape, const AxisSet& reduction_axes, F&& func) {
+    const auto in_strides = row_major_strides(in_shape);
+
+    std::vector<size_t> kept_dims, kept_strides, reduced_dims, reduced_strides;
+    for (size_t axis = 0; axis < in_shape.size(); ++axis) {
+        if (reduction_axes.count(axis)) {
+            reduced_dims.push_back(in_shape[axis]);
+            reduced_strides.push_back(in_strides[axis]);
+        } else {
+            kept_dims.push_back(in_shape[axis]);
+            kept_strides.push_back(in_strides[axis]);
+        }
+    }
+    const auto out_size = shape_size(kept_dims);
+    const auto reduction_size = shape_size(reduced_dims);
+    if (out_size == 0 || reduction_size == 0) {
+        return;
+    }
+    // innermost reduced axis is walked by the tight loop, the rest by odometer
+    const size_t inner_dim = reduced_dims.empty() ? 1 : reduced_dims.back();
+    const size_t inner_stride = reduced_dims.empty() ? 0 : reduced_strides.back();
+    const size_t outer_axes = reduced_dims.empty() ? 0 : reduced_dims.size() - 1;
+
+    parallel_blocks(out_size, reduction_size, [&](const size_t begin, const size_t end) {
+        std::vector<size_t> coord(outer_axes);
+        for (size_t out_idx = begin; out_idx < end; ++out_idx) {
+            size_t base = 0;
+            for (size_t i = kept_dims.size(), rest = out_idx; i-- > 0;) {
+                base += (rest % kept_dims[i]) * kept_strides[i];
+                rest /= kept_dims[i];
+            }
+
+            std::fill(coord.begin(), coord.end(), size_t{0});
+            for (size_t outer = 0, outer_size = reduction_size / inner_dim; outer < outer_size; ++outer) {
+                for (size_t i = 0, in_idx = base; i < inner_dim; ++i, in_idx += inner_stride) {
+                    func(out_idx, in_idx);
+                }
+                for (size_t axis = outer_axes; axis-- > 0;) {
+                    base += reduced_strides[axis];
+                    if (++coord[axis] < reduced_dims[axis]) {
+                        break;
+                    }
+                    base -= coord[axis] * reduced_strides[axis];
+                    coord[axis] = 0;
+                }
+            }
+        }
+    });
+}
+
+}  // namespace reference
+}  // namespace ov
@@ -23,7 +23,9 @@
 #include "openvino/util/env_util.hpp"
 #include "openvino/util/file_util.hpp"
 #include "transformations/common_optimizations/compress_float_constants.hpp"
+#include "transformations/common_optimizations/compress_weights_to_integers.hpp"
 #include "transformations/common_optimizations/fused_names_cleanup.hpp"
+#include "transformations/common_optimizations/mark_precision_sensitive_shapeof_subgraphs.hpp"
 
 namespace {
 
@@ -312,6 +314,15 @@ void serialize(const std::shared_ptr<const ov::Model>& m,
     manager.run_passes(std::const_pointer_cast<ov::Model>(m));
 }
 
+namespace {
+void save_model_impl(const std::shared_ptr<ov::Model>& model, const std::filesystem::path& output_model) {
+    ov::pass::Manager manager("SaveModel");
+    manager.register_pass<ov::pass::FusedNamesCleanup>();
+    manager.register_pass<ov::pass::Serialize>(output_model, "");
+    manager.run_passes(model);
+}
+}  // namespace
+
 void save_model(const std::shared_ptr<const ov::Model>& m,
                 const std::filesystem::path& output_model,
                 bool compress_to_fp16) {
@@ -321,17 +332,61 @@ void save_model(const std::shared_ptr<const ov::Model>& m,
         bool postponed = true;
         ov::pass::compress_model_to_f16(cloned, postponed);
     }
+    save_model_impl(cloned, output_model);
+}
 
-    ov::pass::Manager manager("SaveModel");
-    manager.register_pass<ov::pass::FusedNamesCleanup>();
-    manager.register_pass<ov::pass::Serialize>(output_model, "");
-    manager.run_passes(std::move(cloned));
+void save_model(const std::shared_ptr<const ov::Model>& m,
+                const std::filesystem::path& output_model,
+                WeightsCompressionMode weights_compression,
+                size_t group_size,
+                bool compress_to_fp16) {
+    auto cloned = m->clone();
+
+    element::Type weights_type;
+    switch (weights_compression) {
+    case WeightsCompressionMode::INT8_SYM:
+        weights_type = element::i8;
+        group_size = 0;
+        break;
+    case WeightsCompressionMode::INT8_ASYM:
+        weights_type = element::u8;
+        group_size = 0;
+        break;
+    case WeightsCompressionMode::INT4_SYM:
+        weights_type = element::i4;
+        break;
+    case WeightsCompressionMode::INT4_ASYM:
+        weights_type = element::u4;
+        break;
+    default:
+        OPENVINO_THROW("Unsupported weights compression mode");
+    }
+
+    ov::pass::Manager manager("CompressWeights");
+    manager.register_pass<ov::pass::CompressWeightsToIntegers>(weights_type, group_size);
+    if (compress_to_fp16) {
+        // compress_model_to_f16 skips models that already contain compressed weights,
+        // so the scales and the rest of floating point constants are compressed explicitly
+        manager.register_pass<ov::pass::MarkPrecisionSensitiveConstants>();
+        manager.register_pass<ov::pass::CompressFloatConstants>(true);
+    }
+    manager.run_passes(cloned);
+
+    save_model_impl(cloned, output_model);
 }
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT)
 void save_model(const std::shared_ptr<const ov::Model>& m, const std::wstring& output_model, bool compress_to_fp16) {
     save_model(m, ov::util::wstring_to_string(output_model), compress_to_fp16);
 }
+
+void save_model(const std::shared_ptr<const ov::Model>& m,
+                const std::wstring& output_model,
+                WeightsCompressionMode weights_compression,
+                size_t group_size,
+                bool compress_to_fp16) {
+    save_model(m, ov::util::wstring_to_string(output_model), weights_compression, group_size, compress_to_fp16);
+}
 #endif
 
 bool is_used(Node* node);
@@ -4,9 +4,14 @@
 
 #include "openvino/core/memory_util.hpp"
 
+#include <iterator>
+#include <map>
+#include <mutex>
+
 #include "openvino/core/shape_util.hpp"
 #include "openvino/core/type/element_iterator.hpp"
 #include "openvino/util/common_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace ov::util {
 namespace {
@@ -25,6 +30,38 @@ size_t get_bit_memory_size(const element::Type& type, const size_t shape_size) {
     byte_size += static_cast<size_t>((byte_size * elements_per_storage_unit) != shape_size);
     return byte_size;
 }
+
+// Single registry of the process: libopenvino is the only module shared by frontends, which map model files, and
+// plugins, which release the pages of repacked weights
+class MappedMemoryRegistry {
+public:
+    static MappedMemoryRegistry& get() {
+        // never destroyed: mappings may outlive static objects destruction
+        static auto* registry = new MappedMemoryRegistry();
+        return *registry;
+    }
+
+    void add(const std::shared_ptr<ov::MappedMemory>& memory) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_mappings.begin(); it != m_mappings.end();) {
+            it = it->second.expired() ? m_mappings.erase(it) : std::next(it);
+        }
+        m_mappings[memory->data()] = memory;
+    }
+
+    std::shared_ptr<ov::MappedMemory> find(const char* data) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_mappings.upper_bound(data);
+        if (it == m_mappings.begin()) {
+            return nullptr;
+        }
+        return std::prev(it)->second.lock();
+    }
+
+private:
+    std::mutex m_mutex;
+    std::map<const char*, std::weak_ptr<ov::MappedMemory>> m_mappings;
+};
 }  // namespace
 
 size_t get_memory_size(const element::Type& type, const size_t n) {
@@ -51,4 +88,22 @@ std::optional<size_t> get_memory_size_safe(const element::Type& type, const ov::
     auto byte_size = shape_size_safe(shape);
     return byte_size ? get_memory_size_safe(type, *byte_size) : byte_size;
 }
+
+void register_mapped_memory(const std::shared_ptr<ov::MappedMemory>& memory) {
+    if (memory && memory->data() != nullptr && memory->size() != 0) {
+        MappedMemoryRegistry::get().add(memory);
+    }
+}
+
+bool release_mapped_memory(const void* data, size_t size) noexcept {
+    if (data == nullptr || size == 0) {
+        return false;
+    }
+    try {
+        const auto memory = MappedMemoryRegistry::get().find(static_cast<const char*>(data));
+        return memory && memory->release(static_cast<const char*>(data), size);
+    } catch (...) {
+        return false;
+    }
+}
 }  // namespace ov::util
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <deque>
 #include <iostream>
+#include <limits>
 #include <regex>
 #include <string>
 #include <unordered_set>
@@ -15,6 +16,7 @@
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/core/log_util.hpp"
 #include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/op/util/op_types.hpp"
 #include "openvino/pass/backward_graph_rewrite.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/util/log.hpp"
@@ -66,6 +68,119 @@ PerfCounters& perf_counters_graph_rewrite() {
 }  // namespace ov
 
 #endif  // ENABLE_PROFILING_ITT_FULL
+
+namespace ov {
+namespace pass {
+namespace {
+/* Decision tree compiled from the roots of all patterns registered in GraphRewrite.
+ * The first level selects matchers by the exact node type. It contains matchers registered
+ * for the type itself and for all its parent types in registration order and is filled lazily,
+ * once for each node type met in the graph. The second level selects matchers by the number
+ * of node inputs, as a pattern root with inputs matches nodes with the same number of inputs only.
+ * The last check is done for each node: types of node inputs are tested against pattern root inputs
+ * which are operations or WrapType patterns. All of them are necessary conditions of a match,
+ * so each node is tested once against all patterns and MatcherPass::apply is called only for
+ * matchers which can succeed. */
+class MatcherDecisionTree {
+public:
+    static constexpr size_t any_arity = std::numeric_limits<size_t>::max();
+
+    struct RootSignature {
+        std::vector<NodeTypeInfo> types;
+        size_t arity = any_arity;
+        // allowed types for each root input, empty vector means any type
+        std::vector<std::vector<NodeTypeInfo>> input_types;
+        // inputs can be checked only if the result of MatcherPass depends on the Matcher
+        bool inputs_checkable = false;
+    };
+
+    void add(size_t matcher_index, RootSignature signature) {
+        for (const auto& type : signature.types) {
+            m_type_to_matchers[type].push_back(matcher_index);
+        }
+        if (m_signatures.size() <= matcher_index) {
+            m_signatures.resize(matcher_index + 1);
+        }
+        m_signatures[matcher_index] = std::move(signature);
+    }
+
+    const std::vector<size_t>& candidates(const Node& node) {
+        const auto& type_info = node.get_type_info();
+        auto type_it = m_compiled.find(type_info);
+        if (type_it == m_compiled.end()) {
+            type_it = m_compiled.emplace(type_info, collect_by_type(type_info)).first;
+        }
+        auto& by_type = type_it->second;
+        const auto arity = node.get_input_size();
+        auto arity_it = by_type.by_arity.find(arity);
+        if (arity_it == by_type.by_arity.end()) {
+            std::vector<size_t> matchers;
+            std::copy_if(by_type.all.begin(), by_type.all.end(), std::back_inserter(matchers), [&](size_t idx) {
+                return m_signatures[idx].arity == any_arity || m_signatures[idx].arity == arity;
+            });
+            arity_it = by_type.by_arity.emplace(arity, std::move(matchers)).first;
+        }
+        return arity_it->second;
+    }
+
+    bool inputs_match(size_t matcher_index, const Node& node) const {
+        const auto& signature = m_signatures[matcher_index];
+        if (!signature.inputs_checkable || signature.input_types.empty() || ov::op::util::is_commutative(&node)) {
+            return true;
+        }
+        for (size_t i = 0; i < signature.input_types.size(); ++i) {
+            const auto& allowed_types = signature.input_types[i];
+            if (allowed_types.empty()) {
+                continue;
+            }
+            const auto& input_type = node.get_input_node_ptr(i)->get_type_info();
+            if (std::none_of(allowed_types.begin(), allowed_types.end(), [&](const NodeTypeInfo& type) {
+                    return input_type.is_castable(type);
+                })) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static std::vector<NodeTypeInfo> node_types(const std::shared_ptr<Node>& pattern_node) {
+        if (auto wrap_type = ov::as_type_ptr<pattern::op::WrapType>(pattern_node)) {
+            return wrap_type->get_wrapped_types();
+        }
+        if (ov::as_type_ptr<pattern::op::Pattern>(pattern_node)) {
+            return {};
+        }
+        return {pattern_node->get_type_info()};
+    }
+
+private:
+    struct TypeNode {
+        std::vector<size_t> all;
+        std::unordered_map<size_t, std::vector<size_t>> by_arity;
+    };
+
+    TypeNode collect_by_type(const DiscreteTypeInfo& type_info) const {
+        TypeNode result;
+        // collect matchers registered for parent types and sort them in order of the registration
+        for (const DiscreteTypeInfo* info = &type_info; info; info = info->parent) {
+            auto matchers = m_type_to_matchers.find(*info);
+            if (matchers != m_type_to_matchers.end()) {
+                result.all.insert(result.all.end(), matchers->second.begin(), matchers->second.end());
+            }
+        }
+        std::sort(result.all.begin(), result.all.end());
+        result.all.erase(std::unique(result.all.begin(), result.all.end()), result.all.end());
+        return result;
+    }
+
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> m_type_to_matchers;
+    std::vector<RootSignature> m_signatures;
+    std::unordered_map<NodeTypeInfo, TypeNode> m_compiled;
+};
+}  // namespace
+}  // namespace pass
+}  // namespace ov
+
 std::shared_ptr<ov::pass::MatcherPass> ov::pass::GraphRewrite::add_matcher(
     const std::shared_ptr<ov::pass::MatcherPass>& pass) {
     auto pass_config = get_pass_config();
@@ -103,7 +218,7 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
     // Check that all Matchers in MatcherPasses has type bases root node
     bool all_roots_has_type = true;
-    std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    MatcherDecisionTree decision_tree;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
@@ -124,23 +239,24 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         // if root is an operation from opset or has pattern::op::WrapType type then we can extract
         // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
+        // and use it in the decision tree for fast MatcherPass search. Otherwise type is unknown
         // and default algorithm is used.
-        if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
-            if (auto any_type = ov::as_type_ptr<ov::pass::pattern::op::WrapType>(p)) {
-                for (const auto& root_type_info : any_type->get_wrapped_types()) {
-                    type_to_matcher[root_type_info].push_back(matcher_index);
-                }
-            } else {
-                all_roots_has_type = false;
-                break;
-            }
-        } else {
-            type_to_matcher[root->get_type_info()].push_back(matcher_index);
+        MatcherDecisionTree::RootSignature signature;
+        signature.types = MatcherDecisionTree::node_types(root);
+        if (signature.types.empty()) {
+            all_roots_has_type = false;
+            break;
         }
-
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
+        // WrapType without inputs matches any inputs, operation from opset always checks them
+        signature.inputs_checkable = m_matchers[matcher_index]->is_matcher_driven();
+        if (signature.inputs_checkable &&
+            (root->get_input_size() != 0 || !ov::as_type_ptr<pattern::op::WrapType>(root))) {
+            signature.arity = root->get_input_size();
+        }
+        for (const auto& input : root->input_values()) {
+            signature.input_types.push_back(MatcherDecisionTree::node_types(input.get_node_shared_ptr()));
+        }
+        decision_tree.add(matcher_index, std::move(signature));
     }
 
     // This lambda preforms execution of particular MatcherPass on given node.
@@ -175,9 +291,6 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
         nodes_to_run.pop_front();
@@ -203,27 +316,10 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         // If all Matchers in MatcherPasses has type based root node then we apply efficient
         // algorithm for finding matchers
         if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
+            for (size_t matcher_index : decision_tree.candidates(*node)) {
+                if (!decision_tree.inputs_match(matcher_index, *node)) {
+                    continue;
                 }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run) {
                 if (run_matcher_pass(m_matchers[matcher_index], node)) {
                     rewritten = true;
                     break;
@@ -282,6 +378,7 @@ void ov::pass::MatcherPass::register_matcher(const std::shared_ptr<ov::pass::pat
     set_name(m->get_name());
     set_property(property, true);
     m_matcher = m;
+    m_matcher_driven = true;
     m_handler = [m, callback](const std::shared_ptr<Node>& node) -> bool {
         OPENVINO_LOG_GRAPH_REWRITE1(m, node);
         if (m->match(node->output(0))) {
@@ -466,6 +466,17 @@ PreProcessSteps& PreProcessSteps::crop(const std::vector<int>& begin, const std:
     return *this;
 }
 
+PreProcessSteps& PreProcessSteps::crop_and_resize(const std::string& rois_tensor_name,
+                                                  size_t dst_height,
+                                                  size_t dst_width) {
+    OPENVINO_ASSERT(dst_height <= static_cast<size_t>(std::numeric_limits<int>::max()) &&
+                        dst_width <= static_cast<size_t>(std::numeric_limits<int>::max()),
+                    "Crop and resize: Width/Height dimensions cannot be greater than ",
+                    std::to_string(std::numeric_limits<int>::max()));
+    m_impl->add_crop_and_resize_impl(rois_tensor_name, static_cast<int>(dst_height), static_cast<int>(dst_width));
+    return *this;
+}
+
 PreProcessSteps& PreProcessSteps::convert_layout(const Layout& dst_layout) {
     m_impl->add_convert_layout_impl(dst_layout);
     return *this;
@@ -225,6 +225,8 @@ bool InputInfo::InputInfoImpl::build(const std::shared_ptr<Model>& model,
         // Insert list of new parameters to the place of original parameter
         param_it = parameters_list.erase(param_it);
         parameters_list.insert(param_it, data.m_new_params.begin(), data.m_new_params.end());
+        // Inputs added by preprocessing steps follow the image planes
+        parameters_list.insert(param_it, context.extra_parameters().begin(), context.extra_parameters().end());
     }
     return need_validate;
 }
@@ -23,12 +23,15 @@
 #include "openvino/op/nv12_to_rgb.hpp"
 #include "openvino/op/pad.hpp"
 #include "openvino/op/range.hpp"
+#include "openvino/op/roi_align.hpp"
 #include "openvino/op/round.hpp"
 #include "openvino/op/shape_of.hpp"
 #include "openvino/op/slice.hpp"
+#include "openvino/op/squeeze.hpp"
 #include "openvino/op/subtract.hpp"
 #include "openvino/op/transpose.hpp"
 #include "openvino/op/unsqueeze.hpp"
+#include "openvino/op/variadic_split.hpp"
 #include "openvino/op/util/interpolate_base.hpp"
 #include "openvino/util/common_util.hpp"
 #include "transformations/rt_info/preprocessing_attribute.hpp"
@@ -312,6 +315,83 @@ void PreStepsList::add_resize_impl(ResizeAlgorithm alg, int dst_height, int dst_
         name);
 }
 
+void PreStepsList::add_crop_and_resize_impl(const std::string& rois_tensor_name, int dst_height, int dst_width) {
+    const auto name = "crop ROIs '" + rois_tensor_name + "' and resize to (" + std::to_string(dst_height) + ", " +
+                      std::to_string(dst_width) + ")";
+    m_actions.emplace_back(
+        [rois_tensor_name, dst_height, dst_width](const std::vector<Output<Node>>& nodes,
+                                                  const std::shared_ptr<Model>& function,
+                                                  PreprocessingContext& ctxt) {
+            OPENVINO_ASSERT(!nodes.empty(), "Internal error: Can't add crop and resize for empty input.");
+            OPENVINO_ASSERT(nodes.size() == 1,
+                            "Can't crop and resize multi-plane input. Suggesting to convert current image to "
+                            "RGB/BGR color format using 'PreProcessSteps::convert_color'");
+            const auto& layout = ctxt.layout();
+            const auto& node = nodes.front();
+            OPENVINO_ASSERT(node.get_partial_shape().rank().compatible(4),
+                            "Crop and resize is supported for 4D input only, input shape: ",
+                            node.get_partial_shape());
+            OPENVINO_ASSERT(ov::layout::has_batch(layout) && ov::layout::has_channels(layout) &&
+                                ov::layout::has_height(layout) && ov::layout::has_width(layout),
+                            "Can't add crop and resize for layout without N/C/H/W specified. Use 'set_layout' API to "
+                            "define layout of image data, like `NCHW`");
+
+            // ROIAlign works with NCHW data, other layouts are transposed there and back
+            const auto& shape = node.get_partial_shape();
+            const std::vector<uint64_t> to_nchw{get_and_check_batch_idx(layout, shape),
+                                                get_and_check_channels_idx(layout, shape),
+                                                get_and_check_height_idx(layout, shape),
+                                                get_and_check_width_idx(layout, shape)};
+            std::vector<uint64_t> from_nchw(to_nchw.size());
+            for (size_t i = 0; i < to_nchw.size(); i++) {
+                from_nchw[to_nchw[i]] = i;
+            }
+            const bool is_nchw = to_nchw == std::vector<uint64_t>{0, 1, 2, 3};
+
+            Output<Node> data = node;
+            if (!data.get_element_type().is_real()) {
+                data = std::make_shared<op::v0::Convert>(data, element::f32);
+            }
+            if (!is_nchw) {
+                auto order = op::v0::Constant::create(element::u64, Shape{to_nchw.size()}, to_nchw);
+                data = std::make_shared<op::v1::Transpose>(data, order);
+            }
+
+            // ROIs are [batch_index, x_1, y_1, x_2, y_2] rows
+            auto rois = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 5});
+            rois->set_friendly_name(rois_tensor_name);
+            rois->get_output_tensor(0).set_names({rois_tensor_name});
+            ctxt.extra_parameters().push_back(rois);
+
+            auto split_axis = op::v0::Constant::create(element::i32, Shape{}, {1});
+            auto split_lengths = op::v0::Constant::create(element::i32, Shape{2}, {1, 4});
+            auto split = std::make_shared<op::v1::VariadicSplit>(rois, split_axis, split_lengths);
+            auto batch_indices = std::make_shared<op::v0::Squeeze>(split->output(0), split_axis);
+            auto batch_indices_i32 = std::make_shared<op::v0::Convert>(batch_indices, element::i32);
+            Output<Node> boxes = split->output(1);
+            if (data.get_element_type() != element::f32) {
+                boxes = std::make_shared<op::v0::Convert>(boxes, data.get_element_type());
+            }
+
+            // One bilinear sample per output pixel with half pixel offsets is a bilinear resize of the ROI
+            Output<Node> result = std::make_shared<op::v9::ROIAlign>(data,
+                                                                     boxes,
+                                                                     batch_indices_i32,
+                                                                     dst_height,
+                                                                     dst_width,
+                                                                     1,
+                                                                     1.f,
+                                                                     op::v9::ROIAlign::PoolingMode::AVG,
+                                                                     op::v9::ROIAlign::AlignedMode::HALF_PIXEL);
+            if (!is_nchw) {
+                auto order = op::v0::Constant::create(element::u64, Shape{from_nchw.size()}, from_nchw);
+                result = std::make_shared<op::v1::Transpose>(result, order);
+            }
+            return std::make_tuple(OutputVector{result}, true);
+        },
+        name);
+}
+
 void PreStepsList::add_crop_impl(const std::vector<int>& begin, const std::vector<int>& end) {
     std::stringstream name_str;
     name_str << "Crop (" << ov::util::vector_to_string(begin) << "," << ov::util::vector_to_string(end) << ")";
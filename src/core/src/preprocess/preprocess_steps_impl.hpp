@@ -12,6 +12,7 @@
 #include "openvino/core/preprocess/color_format.hpp"
 #include "openvino/core/preprocess/postprocess_steps.hpp"
 #include "openvino/core/preprocess/preprocess_steps.hpp"
+#include "openvino/op/parameter.hpp"
 #include "tensor_name_util.hpp"
 
 namespace ov {
@@ -43,6 +44,19 @@ inline size_t get_and_check_height_idx(const Layout& layout, const PartialShape&
     return idx;
 }
 
+inline size_t get_and_check_batch_idx(const Layout& layout, const PartialShape& shape) {
+    OPENVINO_ASSERT(ov::layout::has_batch(layout), "Layout ", layout.to_string(), " doesn't have `batch` dimension");
+    OPENVINO_ASSERT(shape.rank().is_static(), "Can't get shape batch index for shape with dynamic rank");
+    auto idx = ov::layout::batch_idx(layout);
+    if (idx < 0) {
+        idx = shape.rank().get_length() + idx;
+    }
+    OPENVINO_ASSERT(idx >= 0 && shape.rank().get_length() > idx,
+                    "Batch dimension is out of bounds ",
+                    std::to_string(idx));
+    return idx;
+}
+
 inline size_t get_and_check_channels_idx(const Layout& layout, const PartialShape& shape) {
     OPENVINO_ASSERT(ov::layout::has_channels(layout),
                     "Layout ",
@@ -121,6 +135,15 @@ public:
         return m_model_shape;
     }
 
+    // Additional model inputs created by preprocessing steps, e.g. ROIs for crop_and_resize
+    const ParameterVector& extra_parameters() const {
+        return m_extra_parameters;
+    }
+
+    ParameterVector& extra_parameters() {
+        return m_extra_parameters;
+    }
+
     size_t get_model_height_for_resize() const {
         auto model_height_idx = get_and_check_height_idx(target_layout(), model_shape());
         OPENVINO_ASSERT(model_shape()[model_height_idx].is_static(),
@@ -138,6 +161,7 @@ public:
 private:
     PartialShape m_model_shape;
     Layout m_model_layout;
+    ParameterVector m_extra_parameters;
 };
 
 using InternalPreprocessOp =
@@ -166,6 +190,7 @@ public:
     void add_convert_impl(const element::Type& type);
     void add_crop_impl(const std::vector<int>& begin, const std::vector<int>& end);
     void add_resize_impl(ResizeAlgorithm alg, int dst_height, int dst_width);
+    void add_crop_and_resize_impl(const std::string& rois_tensor_name, int dst_height, int dst_width);
     void add_convert_layout_impl(const Layout& layout);
     void add_convert_layout_impl(const std::vector<uint64_t>& dims);
     void add_convert_color_impl(const ColorFormat& dst_format);
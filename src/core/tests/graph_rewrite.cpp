@@ -7,15 +7,18 @@
 #include "common_test_utils/ov_test_utils.hpp"
 #include "openvino/core/graph_util.hpp"
 #include "openvino/core/rtti.hpp"
+#include "openvino/op/add.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/divide.hpp"
 #include "openvino/op/op.hpp"
 #include "openvino/op/relu.hpp"
 #include "openvino/op/result.hpp"
+#include "openvino/op/subtract.hpp"
 #include "openvino/op/tanh.hpp"
 #include "openvino/pass/backward_graph_rewrite.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 
 using namespace ::testing;
 using namespace std;
@@ -269,6 +272,65 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2) {
     ASSERT_EQ(count_ops_of_type<op::v0::Tanh>(f), 1);
 }
 
+class ConstantFirstInputPass : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("ConstantFirstInputPass");
+    ConstantFirstInputPass(size_t& matched) : MatcherPass() {
+        auto root = pattern::wrap_type<op::v1::Add, op::v1::Subtract>(
+            {pattern::wrap_type<op::v0::Constant>(), pattern::any_input()});
+        ov::matcher_pass_callback callback = [&matched](pattern::Matcher& m) {
+            matched++;
+            return false;
+        };
+
+        auto m = std::make_shared<ov::pass::pattern::Matcher>(root, "ConstantFirstInputPass");
+        this->register_matcher(m, callback);
+    }
+};
+
+inline std::shared_ptr<Model> get_constant_input_model() {
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{3, 1, 2});
+    auto constant = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1}, {1.5});
+    auto add = std::make_shared<ov::op::v1::Add>(data, constant);
+    auto subtract_const_second = std::make_shared<ov::op::v1::Subtract>(add, constant);
+    auto subtract_const_first = std::make_shared<ov::op::v1::Subtract>(constant, subtract_const_second);
+    auto relu = std::make_shared<ov::op::v0::Relu>(subtract_const_first);
+    return std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{data});
+}
+
+TEST(GraphRewriteTest, TypeBasedMatcherPassInputTypes) {
+    auto f = get_constant_input_model();
+
+    size_t matched = 0;
+    Anchor anchor;
+    anchor.add_matcher<ConstantFirstInputPass>(matched);
+    anchor.run_on_model(f);
+
+    // Add is commutative, so its inputs are matched in any order
+    ASSERT_EQ(matched, 2);
+}
+
+TEST(GraphRewriteTest, TypeBasedMatcherPassCustomHandler) {
+    auto f = get_constant_input_model();
+
+    size_t called = 0;
+    auto root =
+        pattern::wrap_type<op::v1::Subtract>({pattern::wrap_type<op::v0::Constant>(), pattern::any_input()});
+    auto matcher = std::make_shared<ov::pass::pattern::Matcher>(root, "CustomHandler");
+    auto pass = std::make_shared<ov::pass::MatcherPass>("CustomHandler",
+                                                        matcher,
+                                                        [&called](const std::shared_ptr<Node>&) {
+                                                            called++;
+                                                            return false;
+                                                        });
+    Anchor anchor;
+    anchor.add_matcher(pass);
+    anchor.run_on_model(f);
+
+    // handler doesn't depend on the Matcher, so only root type is taken into account
+    ASSERT_EQ(called, 2);
+}
+
 TEST(PassConfigTest, Test1) {
     {
         auto f = get_model();
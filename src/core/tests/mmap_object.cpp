@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/mmap_object.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "openvino/core/memory_util.hpp"
+
+namespace ov::test {
+
+class MmapObjectTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        file_name = ov::test::utils::generateTestFilePrefix() + ".bin";
+        data.resize(4 * 4096 + 100);
+        std::iota(data.begin(), data.end(), 0);
+        std::ofstream fout(file_name, std::ios::binary);
+        fout.write(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(int32_t));
+    }
+
+    void TearDown() override {
+        if (std::filesystem::exists(file_name))
+            std::filesystem::remove(file_name);
+    }
+
+    std::filesystem::path file_name;
+    std::vector<int32_t> data;
+};
+
+TEST_F(MmapObjectTest, release_keeps_data) {
+    auto mapped_memory = ov::load_mmap_object(file_name);
+    ASSERT_EQ(mapped_memory->size(), data.size() * sizeof(int32_t));
+    ASSERT_EQ(0, memcmp(mapped_memory->data(), data.data(), mapped_memory->size()));
+
+#ifndef _WIN32
+    EXPECT_TRUE(mapped_memory->release(mapped_memory->data(), mapped_memory->size()));
+#else
+    mapped_memory->release(mapped_memory->data(), mapped_memory->size());
+#endif
+    // released pages are read from the file again
+    EXPECT_EQ(0, memcmp(mapped_memory->data(), data.data(), mapped_memory->size()));
+}
+
+TEST_F(MmapObjectTest, release_ignores_ranges_out_of_mapping) {
+    auto mapped_memory = ov::load_mmap_object(file_name);
+    EXPECT_FALSE(mapped_memory->release(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(int32_t)));
+    EXPECT_FALSE(mapped_memory->release(mapped_memory->data(), 16));
+    EXPECT_FALSE(mapped_memory->release(mapped_memory->data(), mapped_memory->size() + 4096));
+    EXPECT_EQ(0, memcmp(data.data(), mapped_memory->data(), data.size() * sizeof(int32_t)));
+}
+
+TEST_F(MmapObjectTest, release_mapped_memory_of_registered_mappings_only) {
+    auto mapped_memory = ov::load_mmap_object(file_name);
+    EXPECT_FALSE(ov::util::release_mapped_memory(mapped_memory->data(), mapped_memory->size()));
+
+    ov::util::register_mapped_memory(mapped_memory);
+#ifndef _WIN32
+    EXPECT_TRUE(ov::util::release_mapped_memory(mapped_memory->data(), mapped_memory->size()));
+#endif
+    EXPECT_FALSE(ov::util::release_mapped_memory(data.data(), data.size() * sizeof(int32_t)));
+    EXPECT_EQ(0, memcmp(data.data(), mapped_memory->data(), data.size() * sizeof(int32_t)));
+
+    // the registry does not keep the mapping alive
+    const auto* released_data = mapped_memory->data();
+    const auto released_size = mapped_memory->size();
+    mapped_memory.reset();
+    EXPECT_FALSE(ov::util::release_mapped_memory(released_data, released_size));
+}
+
+}  // namespace ov::test
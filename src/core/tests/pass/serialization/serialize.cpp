@@ -14,6 +14,8 @@
 #include "common_test_utils/test_common.hpp"
 #include "openvino/core/graph_util.hpp"
 #include "openvino/op/add.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
 #include "openvino/pass/serialize.hpp"
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/tensor.hpp"
@@ -93,6 +95,28 @@ TEST_P(SerializePassTestP, serialize_simple_model_with_constant) {
     const auto& [is_valid, error_msg] = model_comparator().compare(serialized_model, m_model);
     EXPECT_TRUE(is_valid) << error_msg;
 }
+
+TEST_F(SerializePassTest, save_model_compresses_shared_weights_once) {
+    const auto input = std::make_shared<Parameter>(element::f32, PartialShape{-1, 4});
+    const auto weights = Constant::create(element::f32, Shape{2, 4}, {0.f, 1.f, 2.f, 3.f, -2.f, 0.f, 2.f, 4.f});
+    const auto matmul_0 = std::make_shared<op::v0::MatMul>(input, weights, false, true);
+    const auto matmul_1 = std::make_shared<op::v0::MatMul>(input, weights, false, true);
+    m_model = std::make_shared<Model>(OutputVector{matmul_0, matmul_1}, ParameterVector{input}, "shared_weights");
+
+    OV_ASSERT_NO_THROW(ov::save_model(m_model, m_out_xml_path, WeightsCompressionMode::INT8_ASYM, 128, false));
+
+    const auto serialized_model = test::readModel(m_out_xml_path.string(), m_out_bin_path.string());
+    size_t compressed_weights = 0;
+    for (const auto& op : serialized_model->get_ops()) {
+        if (ov::is_type<Constant>(op) && op->get_element_type() == element::u8 && op->get_shape() == Shape{2, 4}) {
+            compressed_weights++;
+        }
+    }
+    EXPECT_EQ(compressed_weights, 1);
+    for (const auto& result : serialized_model->get_results()) {
+        EXPECT_TRUE(ov::is_type<op::v1::Multiply>(result->get_input_node_shared_ptr(0)->get_input_node_shared_ptr(1)));
+    }
+}
 }  // namespace ov::test
 
 using SerializationParams = std::tuple<std::string, std::string>;
@@ -1640,6 +1640,53 @@ TEST(pre_post_process, preprocess_crop_wrong_dims_not_aligned) {
     }
 }
 
+TEST(pre_post_process, preprocess_crop_and_resize) {
+    auto model = create_n_inputs(2, element::f32, PartialShape{-1, 3, 224, 224});
+    auto p = PrePostProcessor(model);
+
+    p.input("tensor_input1").tensor().set_shape({1, 3, 1080, 1920}).set_layout("NCHW");
+    p.input("tensor_input1").preprocess().crop_and_resize("rois", 224, 224);
+
+    std::stringstream dump;
+    dump << p;
+    EXPECT_TRUE(dump.str().find("rois") != std::string::npos) << dump.str();
+    model = p.build();
+
+    ASSERT_EQ(model->get_parameters().size(), 3);
+    EXPECT_EQ(model->input(0).get_any_name(), "tensor_input0");
+    EXPECT_EQ(model->input(1).get_any_name(), "tensor_input1");
+    EXPECT_EQ(model->input(1).get_partial_shape(), (PartialShape{1, 3, 1080, 1920}));
+    EXPECT_EQ(model->input(2).get_any_name(), "rois");
+    EXPECT_EQ(model->input(2).get_element_type(), element::f32);
+    EXPECT_EQ(model->input(2).get_partial_shape(), (PartialShape{-1, 5}));
+    EXPECT_EQ(model->output(1).get_partial_shape(), (PartialShape{-1, 3, 224, 224}));
+}
+
+TEST(pre_post_process, preprocess_crop_and_resize_nhwc_u8) {
+    auto model = create_simple_function(element::f32, PartialShape{-1, 3, 112, 96});
+    auto p = PrePostProcessor(model);
+
+    p.input().tensor().set_shape({2, 480, 640, 3}).set_layout("NHWC").set_element_type(element::u8);
+    p.input().preprocess().crop_and_resize("boxes", 112, 96).convert_layout("NCHW");
+    p.input().model().set_layout("NCHW");
+    model = p.build();
+
+    ASSERT_EQ(model->get_parameters().size(), 2);
+    EXPECT_EQ(model->input(0).get_element_type(), element::u8);
+    EXPECT_EQ(model->input(0).get_partial_shape(), (PartialShape{2, 480, 640, 3}));
+    EXPECT_EQ(model->input(1).get_any_name(), "boxes");
+    EXPECT_EQ(model->output().get_partial_shape(), (PartialShape{-1, 3, 112, 96}));
+}
+
+TEST(pre_post_process, preprocess_crop_and_resize_no_layout) {
+    auto model = create_simple_function(element::f32, PartialShape{-1, 3, 224, 224});
+    auto p = PrePostProcessor(model);
+
+    p.input().tensor().set_shape({1, 3, 480, 640});
+    p.input().preprocess().crop_and_resize("rois", 224, 224);
+    EXPECT_THROW(p.build(), ov::AssertFailure);
+}
+
 // --- PostProcess - set/convert element type ---
 
 TEST(pre_post_process, postprocess_convert_element_type_explicit) {
@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "openvino/reference/autobroadcast_binop.hpp"
+#include "openvino/reference/gather.hpp"
+#include "openvino/reference/reduce_max.hpp"
+#include "openvino/reference/utils/parallel_blocks.hpp"
+
+namespace parallel_blocks_test {
+using ov::reference::parallel_block_min_elements;
+
+TEST(ParallelBlocksTest, VisitsEveryItemOnce) {
+    const size_t count = 4 * parallel_block_min_elements + 3;
+    std::vector<std::atomic<int>> visits(count);
+    ov::reference::parallel_blocks(count, 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            ++visits[i];
+        }
+    });
+    for (const auto& v : visits) {
+        ASSERT_EQ(v.load(), 1);
+    }
+}
+
+TEST(ParallelBlocksTest, RethrowsException) {
+    const size_t count = 4 * parallel_block_min_elements;
+    EXPECT_THROW(ov::reference::parallel_blocks(count,
+                                                1,
+                                                [&](size_t begin, size_t end) {
+                                                    if (begin <= count / 2 && count / 2 < end) {
+                                                        throw std::domain_error("error");
+                                                    }
+                                                }),
+                 std::domain_error);
+}
+
+TEST(ParallelBlocksTest, NumpyBroadcastBinop) {
+    const ov::Shape shape0{64, 1, 1024}, shape1{3, 1}, out_shape{64, 3, 1024};
+    std::vector<int32_t> in0(ov::shape_size(shape0)), in1(ov::shape_size(shape1)), out(ov::shape_size(out_shape));
+    std::iota(in0.begin(), in0.end(), 0);
+    std::iota(in1.begin(), in1.end(), 1);
+
+    ov::reference::autobroadcast_binop(in0.data(),
+                                       in1.data(),
+                                       out.data(),
+                                       shape0,
+                                       shape1,
+                                       ov::op::AutoBroadcastType::NUMPY,
+                                       [](int32_t a, int32_t b) {
+                                           return a * b;
+                                       });
+
+    for (size_t n = 0; n < out_shape[0]; ++n) {
+        for (size_t c = 0; c < out_shape[1]; ++c) {
+            for (size_t w = 0; w < out_shape[2]; ++w) {
+                ASSERT_EQ(out[(n * out_shape[1] + c) * out_shape[2] + w], in0[n * shape0[2] + w] * in1[c]);
+            }
+        }
+    }
+}
+
+TEST(ParallelBlocksTest, ReduceOuterAxis) {
+    const ov::Shape shape{16, 4096, 3};
+    std::vector<int32_t> in(ov::shape_size(shape)), out(shape[1] * shape[2]);
+    std::iota(in.begin(), in.end(), 0);
+
+    ov::reference::reduce_max(in.data(), out.data(), shape, ov::AxisSet{0});
+
+    for (size_t i = 0; i < out.size(); ++i) {
+        ASSERT_EQ(out[i], in[(shape[0] - 1) * out.size() + i]);
+    }
+}
+
+TEST(ParallelBlocksTest, GatherOutOfBoundIndices) {
+    const ov::Shape data_shape{4, 8}, indices_shape{2 * parallel_block_min_elements}, out_shape{4, indices_shape[0]};
+    std::vector<float> data(ov::shape_size(data_shape)), out(ov::shape_size(out_shape), -1.f);
+    std::iota(data.begin(), data.end(), 1.f);
+    std::vector<int64_t> indices(indices_shape[0]);
+    for (size_t i = 0; i < indices.size(); ++i) {
+        indices[i] = static_cast<int64_t>(i % 12) - 2;
+    }
+
+    ov::reference::gather(data.data(), indices.data(), out.data(), data_shape, indices_shape, out_shape, 1);
+
+    for (size_t r = 0; r < out_shape[0]; ++r) {
+        for (size_t i = 0; i < indices.size(); ++i) {
+            const auto idx = indices[i] < 0 ? indices[i] + 8 : indices[i];
+            const auto expected = idx < 8 ? data[r * 8 + idx] : 0.f;
+            ASSERT_EQ(out[r * indices.size() + i], expected);
+        }
+    }
+}
+
+}  // namespace parallel_blocks_test
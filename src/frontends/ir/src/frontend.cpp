@@ -10,6 +10,7 @@
 
 #include "input_model.hpp"
 #include "openvino/core/any.hpp"
+#include "openvino/core/memory_util.hpp"
 #include "openvino/core/so_extension.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
@@ -257,6 +258,8 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     if (!weights_path.empty()) {
         if (enable_mmap) {
             auto mapped_memory = ov::load_mmap_object(ov::util::make_path(weights_path));
+            // plugins release the pages of the weights they repacked
+            ov::util::register_mapped_memory(mapped_memory);
             weights = std::make_shared<ov::SharedBuffer<std::shared_ptr<MappedMemory>>>(mapped_memory->data(),
                                                                                         mapped_memory->size(),
                                                                                         mapped_memory);
@@ -11,6 +11,7 @@
 
 #include <future>
 #include <memory>
+#include <vector>
 
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/exception.hpp"
@@ -71,6 +72,25 @@ public:
      */
     virtual void set_callback(std::function<void(std::exception_ptr)> callback);
 
+    /**
+     * @brief Callback of a batch of requests, receives the exceptions of the requests in the order of submission,
+     * nullptr for the successfully completed ones
+     */
+    using BatchCallback = std::function<void(const std::vector<std::exception_ptr>&)>;
+
+    /**
+     * @brief Starts inference of several requests and calls the batch callback once all of them are completed
+     * @details If all the requests can be started in a batch (see is_batch_startable()) and share the same request
+     * executor, their synchronous pipelines are run one by one inside a single task of the executor, so there is no
+     * per-stage scheduling. Callbacks set for the individual requests are not called in this case. Otherwise every
+     * request is started by its own start_async() and its callback is replaced by the one which joins the
+     * completions until the request is completed, then the previous callback is set back.
+     * @param requests Requests to start, they must be idle
+     * @param callback Function to be called once all the requests are completed
+     */
+    static void start_async_batch(const std::vector<std::shared_ptr<IAsyncInferRequest>>& requests,
+                                  BatchCallback callback);
+
     /**
      * @brief Infers specified input(s) in synchronous mode
      * @note blocks all method of InferRequest while request is ongoing (running or waiting in queue)
@@ -190,6 +210,13 @@ protected:
      * @brief Check that all tensors are valid. Throws an exception if it's not.
      */
     void check_tensors() const override;
+    /**
+     * @brief Tells if start_async_batch() can run the request as a part of a single executor task
+     * @details Such a request is executed by the tasks of its synchronous pipeline, bypassing start_async() and
+     * infer(). The default implementation returns true only for the instances of IAsyncInferRequest itself, a derived
+     * class may return true if it customizes the execution by the pipelines only.
+     */
+    virtual bool is_batch_startable() const;
 
     Pipeline m_pipeline;       //!< Pipeline variable that should be filled by inherited class.
     Pipeline m_sync_pipeline;  //!< Synchronous pipeline variable that should be filled by inherited class.
@@ -216,6 +243,11 @@ private:
         std::function<void(std::exception_ptr)> m_callback;
     };
 
+    void complete_batched(std::exception_ptr exception);
+
+    static void start_async_each(const std::vector<std::shared_ptr<IAsyncInferRequest>>& requests,
+                                 BatchCallback callback);
+
     void run_first_stage(const Pipeline::iterator itBeginStage,
                          const Pipeline::iterator itEndStage,
                          const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor = {});
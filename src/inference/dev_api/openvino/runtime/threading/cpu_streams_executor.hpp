@@ -45,6 +45,8 @@ public:
 
     void run(Task task) override;
 
+    void run(Task task, ov::hint::Priority priority) override;
+
     void execute(Task task) override;
 
     int get_stream_id() override;
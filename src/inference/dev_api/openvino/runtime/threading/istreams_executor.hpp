@@ -289,6 +289,17 @@ public:
      * @param task A task to start
      */
     virtual void execute(Task task) = 0;
+
+    using ITaskExecutor::run;
+
+    /**
+     * @brief Execute ov::Task inside task executor context. Pending tasks with higher priority are started first,
+     *        tasks with the same priority are started in the order of submission
+     * @note The default implementation ignores the priority and calls run(task)
+     * @param task A task to start
+     * @param priority A priority of the task
+     */
+    virtual void run(Task task, ov::hint::Priority priority);
 };
 
 static std::mutex _streams_executor_mutex;
@@ -12,6 +12,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "openvino/core/node_output.hpp"
 #include "openvino/runtime/common.hpp"
@@ -307,6 +308,24 @@ public:
      */
     void set_callback(std::function<void(std::exception_ptr)> callback);
 
+    /**
+     * @brief Starts inference of several infer requests in asynchronous mode.
+     * @note It returns immediately. The requests are run one by one inside a single task of the device executor and
+     *       their completion is reported by a single call of the callback, which reduces the scheduling overhead for
+     *       small models. To load several streams, split the requests into several batches.
+     *       Callbacks set by set_callback are not called for the requests started this way. If the device can't run
+     *       the requests in a single task, they are started one by one and their callbacks are replaced until
+     *       they are completed.
+     *       Calling any method of a request in a running state leads to throwing the ov::Busy exception.
+     * @param requests Idle infer requests created by the same compiled model. They should be alive until the
+     * callback is called.
+     * @param callback Callback object which is called once all the requests are finished. It receives the exceptions
+     * of the requests in the order of `requests`, nullptr for successfully finished ones.
+     * @warning Do not capture strong references to OpenVINO runtime objects into callback, see set_callback.
+     */
+    static void start_async_batch(const std::vector<InferRequest>& requests,
+                                  std::function<void(const std::vector<std::exception_ptr>&)> callback);
+
     /**
      * @brief Gets state control interface for the given infer request.
      *
@@ -117,5 +117,21 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
  */
 static constexpr Property<float> sparse_weights_decompression_rate{"CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @brief This property defines threshold for sparse f32 weights execution of Matrix Multiplication operations
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * FullyConnected layers with constant f32 weights, which sparse rate (the fraction of zero values) is not less than
+ * the threshold, are executed on the weights stored in the compressed sparse row format, so that only the non-zero
+ * weights are loaded and multiplied. The sparse implementation pays off only for highly sparse weights and small
+ * batches, the crossover point depends on the model and the platform, so the feature is not enabled automatically:
+ * the default value 1.0 disables it, and batches above 64 rows always use the dense implementation.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::sparse_float_weights_rate(0.9));
+ * @endcode
+ */
+static constexpr Property<float> sparse_float_weights_rate{"CPU_SPARSE_FLOAT_WEIGHTS_RATE"};
+
 }  // namespace intel_cpu
 }  // namespace ov
@@ -922,6 +922,21 @@ static constexpr Property<bool, PropertyMutability::RW> force_tbb_terminate{"FOR
  */
 static constexpr Property<bool, PropertyMutability::RW> enable_mmap{"ENABLE_MMAP"};
 
+/**
+ * @brief Read-write property to share compiled models between `compile_model` calls of the same core. Disabled by
+ * default. Only devices which support model caching are affected.
+ *
+ * When enabled, calls which compile the same model with the same configuration for the same device return the same
+ * compiled model while it is alive, and simultaneous calls trigger a single compilation.
+ *
+ * value type: boolean
+ *   - True reuse compiled models which are still in use
+ *   - False compile model on each call
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_compiled_model_sharing{
+    "ENABLE_COMPILED_MODEL_SHARING"};
+
 /**
  * @brief Namespace with device properties
  */
@@ -7,6 +7,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "itt.hpp"
 #include "openvino/core/except.hpp"
@@ -266,6 +267,27 @@ void InferRequest::set_callback(std::function<void(std::exception_ptr)> callback
     OV_INFER_REQ_CALL_STATEMENT(_impl->set_callback(std::move(callback));)
 }
 
+void InferRequest::start_async_batch(const std::vector<InferRequest>& requests,
+                                     std::function<void(const std::vector<std::exception_ptr>&)> callback) {
+    std::vector<std::shared_ptr<ov::IAsyncInferRequest>> impls;
+    impls.reserve(requests.size());
+    for (const auto& request : requests) {
+        OPENVINO_ASSERT(request._impl != nullptr, "InferRequest was not initialized.");
+        impls.push_back(request._impl);
+    }
+    try {
+        ov::IAsyncInferRequest::start_async_batch(impls, std::move(callback));
+    } catch (const ov::Busy&) {
+        throw;
+    } catch (const ov::Cancelled&) {
+        throw;
+    } catch (const std::exception& ex) {
+        OPENVINO_THROW(ex.what());
+    } catch (...) {
+        OPENVINO_THROW("Unexpected exception");
+    }
+}
+
 std::vector<VariableState> InferRequest::query_state() {
     std::vector<VariableState> variable_states;
     OV_INFER_REQ_CALL_STATEMENT({
@@ -209,6 +209,7 @@ void clean_batch_properties(const std::string& device_name, ov::AnyMap& config,
 
 static const auto core_properties_names = ov::util::make_array(ov::cache_dir.name(),
                                                                ov::enable_mmap.name(),
+                                                               ov::enable_compiled_model_sharing.name(),
                                                                ov::force_tbb_terminate.name(),
                                                                ov::cache_model_path.name());
 
@@ -836,9 +837,15 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     auto plugin = get_plugin(parsed.m_device_name);
     const auto& [cache_dir, cache_manager] = parsed.m_core_config.get_cache_config_for_device(plugin);
     auto res = import_compiled_model(plugin, {}, config, model);
+    auto shared_entry = res ? SharedModelEntry{} : lock_shared_model(plugin, parsed, [&](const ov::AnyMap& options) {
+        return ModelCache::compute_hash(model, get_cache_model_path(config), options);
+    });
     // Skip caching for proxy plugin. HW plugin will load network from the cache
     if (res) {
         // hint::compiled_blob is set and imported skip compilation
+    } else if (shared_entry.m_compiled_model) {
+        // the same model compiled by previous call is still in use
+        res = shared_entry.m_compiled_model;
     } else if (cache_manager && device_supports_model_caching(plugin, parsed.m_config) && !is_proxy_device(plugin)) {
         emplace_cache_dir_if_supported(parsed.m_config, plugin, cache_dir);
         CacheContent cache_content{cache_manager, parsed.m_core_config.get_enable_mmap(), get_cache_model_path(config)};
@@ -862,6 +869,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     } else {
         res = plugin.compile_model(model, parsed.m_config);
     }
+    register_shared_model(shared_entry, res);
     return res;
 }
 
@@ -908,9 +916,18 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
     auto plugin = get_plugin(parsed.m_device_name);
     const auto& [cache_dir, cache_manager] = parsed.m_core_config.get_cache_config_for_device(plugin);
     auto compiled_model = import_compiled_model(plugin, {}, parsed.m_config, model_path);
+    auto shared_entry =
+        compiled_model ? SharedModelEntry{} : lock_shared_model(plugin, parsed, [&](const ov::AnyMap& options) {
+            // file info is a part of the id, so the model file updated on disk is compiled again
+            return ov::ModelCache::compute_hash(model_path, options) +
+                   ov::ModelCache::calculate_file_info(util::make_path(model_path));
+        });
 
     if (compiled_model) {
         // hint::compiled_blob is set and imported skip compilation
+    } else if (shared_entry.m_compiled_model) {
+        // the same model compiled by previous call is still in use
+        compiled_model = shared_entry.m_compiled_model;
     } else if (cache_manager && device_supports_model_caching(plugin, parsed.m_config) && !is_proxy_device(plugin)) {
         // Skip caching for proxy plugin. HW plugin will load network from the cache
         CoreConfig::remove_core(parsed.m_config);
@@ -927,6 +944,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
     } else {
         compiled_model = plugin.compile_model(model_path, parsed.m_config);
     }
+    register_shared_model(shared_entry, compiled_model);
     return compiled_model;
 }
 
@@ -939,9 +957,16 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
     auto plugin = get_plugin(parsed.m_device_name);
     const auto& [cache_dir, cache_manager] = parsed.m_core_config.get_cache_config_for_device(plugin);
     auto compiled_model = import_compiled_model(plugin, {}, parsed.m_config);
+    auto shared_entry =
+        compiled_model ? SharedModelEntry{} : lock_shared_model(plugin, parsed, [&](const ov::AnyMap& options) {
+            return ov::ModelCache::compute_hash(model_str, weights, options);
+        });
     // Skip caching for proxy plugin. HW plugin will load network from the cache
     if (compiled_model) {
         // hint::compiled_blob is set and imported skip compilation
+    } else if (shared_entry.m_compiled_model) {
+        // the same model compiled by previous call is still in use
+        compiled_model = shared_entry.m_compiled_model;
     } else if (cache_manager && device_supports_model_caching(plugin, parsed.m_config) && !is_proxy_device(plugin)) {
         emplace_cache_dir_if_supported(parsed.m_config, plugin, cache_dir);
         CacheContent cache_content{cache_manager, parsed.m_core_config.get_enable_mmap()};
@@ -956,6 +981,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
         const auto model = read_model(model_str, weights);
         compiled_model = plugin.compile_model(model, parsed.m_config);
     }
+    register_shared_model(shared_entry, compiled_model);
     return compiled_model;
 }
 
@@ -1256,6 +1282,9 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
     } else if (name == ov::enable_mmap.name()) {
         const auto flag = m_core_config.get_enable_mmap();
         return decltype(ov::enable_mmap)::value_type(flag);
+    } else if (name == ov::enable_compiled_model_sharing.name()) {
+        const auto flag = m_core_config.get_enable_compiled_model_sharing();
+        return decltype(ov::enable_compiled_model_sharing)::value_type(flag);
     }
 
     OPENVINO_THROW("Exception is thrown while trying to call get_property with unsupported property: '", name, "'");
@@ -1454,6 +1483,52 @@ bool ov::CoreImpl::device_supports_model_caching(const ov::Plugin& plugin, const
                                                     : plugin.supports_model_caching();
 }
 
+ov::CoreImpl::SharedModelEntry ov::CoreImpl::lock_shared_model(
+    const ov::Plugin& plugin,
+    const Parsed& parsed,
+    const std::function<std::string(const ov::AnyMap&)>& compute_hash) const {
+    SharedModelEntry entry;
+    if (!parsed.m_core_config.get_enable_compiled_model_sharing() || is_proxy_device(plugin) ||
+        !device_supports_model_caching(plugin, parsed.m_config)) {
+        return entry;
+    }
+
+    // Runtime properties are not a part of caching properties, but compiled models which differ in them can't be shared
+    auto options = create_compile_config(plugin, parsed.m_config);
+    for (const auto& [name, value] : parsed.m_config) {
+        // values without text representation (e.g. callbacks) can't be compared by hash
+        if (!value.is<std::string>() && value.as<std::string>().empty()) {
+            return entry;
+        }
+        options.emplace(name, value);
+    }
+    entry.m_id = parsed.m_device_name + ':' + compute_hash(options);
+    entry.m_lock = m_shared_models_guard.get_hash_lock(entry.m_id);
+
+    std::lock_guard<std::mutex> lock(m_shared_models_mutex);
+    if (const auto it = m_shared_models.find(entry.m_id); it != m_shared_models.end()) {
+        if (auto compiled_model = it->second.m_model.lock()) {
+            entry.m_compiled_model = {compiled_model, it->second.m_so.lock()};
+        }
+    }
+    return entry;
+}
+
+void ov::CoreImpl::register_shared_model(SharedModelEntry& entry,
+                                         const ov::SoPtr<ov::ICompiledModel>& compiled_model) const {
+    if (!entry.m_lock) {
+        return;
+    }
+    if (compiled_model && !entry.m_compiled_model) {
+        std::lock_guard<std::mutex> lock(m_shared_models_mutex);
+        for (auto it = m_shared_models.begin(); it != m_shared_models.end();) {
+            it = it->second.m_model.expired() ? m_shared_models.erase(it) : std::next(it);
+        }
+        m_shared_models[entry.m_id] = {compiled_model._ptr, compiled_model._so};
+    }
+    entry.m_lock.reset();
+}
+
 ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model_and_cache(ov::Plugin& plugin,
                                                                     const std::shared_ptr<const ov::Model>& model,
                                                                     const ov::AnyMap& parsedConfig,
@@ -1651,6 +1726,7 @@ ov::CoreConfig::CoreConfig(const CoreConfig& other) {
         m_devices_cache_config = other.m_devices_cache_config;
     }
     m_flag_enable_mmap = other.m_flag_enable_mmap;
+    m_flag_enable_compiled_model_sharing = other.m_flag_enable_compiled_model_sharing;
 }
 
 void ov::CoreConfig::set(const ov::AnyMap& config, const std::string& device_name) {
@@ -1675,6 +1751,10 @@ void ov::CoreConfig::set(const ov::AnyMap& config, const std::string& device_nam
     if (const auto cfg_entry = config.find(ov::enable_mmap.name()); cfg_entry != config.end()) {
         m_flag_enable_mmap = cfg_entry->second.as<bool>();
     }
+
+    if (const auto cfg_entry = config.find(ov::enable_compiled_model_sharing.name()); cfg_entry != config.end()) {
+        m_flag_enable_compiled_model_sharing = cfg_entry->second.as<bool>();
+    }
 }
 
 void ov::CoreConfig::set_and_update(ov::AnyMap& config, const std::string& device_name) {
@@ -1697,6 +1777,10 @@ bool ov::CoreConfig::get_enable_mmap() const {
     return m_flag_enable_mmap;
 }
 
+bool ov::CoreConfig::get_enable_compiled_model_sharing() const {
+    return m_flag_enable_compiled_model_sharing;
+}
+
 ov::CoreConfig::CacheConfig ov::CoreConfig::get_cache_config_for_device(const ov::Plugin& plugin) const {
     std::lock_guard<std::mutex> lock(m_cache_config_mutex);
     return m_devices_cache_config.count(plugin.get_name()) ? m_devices_cache_config.at(plugin.get_name())
@@ -47,6 +47,8 @@ public:
 
     bool get_enable_mmap() const;
 
+    bool get_enable_compiled_model_sharing() const;
+
     // Creating thread-safe copy of global config including shared_ptr to ICacheManager
     CacheConfig get_cache_config_for_device(const ov::Plugin& plugin) const;
 
@@ -58,6 +60,7 @@ private:
     CacheConfig m_cache_config{};
     std::map<std::string, CacheConfig> m_devices_cache_config{};
     bool m_flag_enable_mmap{true};
+    bool m_flag_enable_compiled_model_sharing{false};
 };
 
 struct Parsed {
@@ -166,6 +169,37 @@ private:
 
     mutable ov::CacheGuard m_cache_guard;
 
+    // Compiled models shared between compile_model calls when ov::enable_compiled_model_sharing is set.
+    // Entries do not own compiled models, so a model is compiled again once all its users have released it
+    struct SharedCompiledModel {
+        std::weak_ptr<ov::ICompiledModel> m_model;
+        std::weak_ptr<void> m_so;
+    };
+    mutable std::mutex m_shared_models_mutex;
+    mutable std::unordered_map<std::string, SharedCompiledModel> m_shared_models;
+    // Locks model id while it is compiled, so simultaneous calls for the same model trigger a single compilation
+    mutable ov::CacheGuard m_shared_models_guard;
+
+    struct SharedModelEntry {
+        std::string m_id{};
+        std::unique_ptr<ov::CacheGuardEntry> m_lock{};
+        // compiled model found in registry, empty if the model shall be compiled
+        ov::SoPtr<ov::ICompiledModel> m_compiled_model{};
+    };
+
+    /**
+     * @brief Locks registry entry of shared compiled model and looks up the model compiled by previous calls
+     * @param plugin        Plugin used for compilation
+     * @param parsed        Parsed device name and configuration
+     * @param compute_hash  Computes model hash with given compile options
+     * @return Locked entry, or empty entry if compiled models sharing is disabled or not supported by device
+     */
+    SharedModelEntry lock_shared_model(const ov::Plugin& plugin,
+                                       const Parsed& parsed,
+                                       const std::function<std::string(const ov::AnyMap&)>& compute_hash) const;
+
+    void register_shared_model(SharedModelEntry& entry, const ov::SoPtr<ov::ICompiledModel>& compiled_model) const;
+
     struct PluginDescriptor {
         std::filesystem::path m_lib_location{};
         ov::AnyMap m_default_config{};
@@ -4,7 +4,11 @@
 
 #include "openvino/runtime/iasync_infer_request.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
+#include <typeinfo>
+#include <vector>
 
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/ivariable_state.hpp"
@@ -185,6 +189,170 @@ ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(
         std::move(callbackExecutor));
 }
 
+bool ov::IAsyncInferRequest::is_batch_startable() const {
+    return typeid(*this) == typeid(ov::IAsyncInferRequest);
+}
+
+void ov::IAsyncInferRequest::start_async_batch(const std::vector<std::shared_ptr<IAsyncInferRequest>>& requests,
+                                               BatchCallback callback) {
+    OPENVINO_ASSERT(!requests.empty(), "Batch of infer requests is empty");
+    for (const auto& request : requests) {
+        OPENVINO_ASSERT(nullptr != request, "Infer request of a batch is empty");
+    }
+    const auto executor = requests.front()->m_request_executor;
+    const bool single_task =
+        nullptr != executor && std::all_of(requests.begin(), requests.end(), [&executor](const auto& request) {
+            return request->m_request_executor == executor && request->is_batch_startable();
+        });
+    if (!single_task) {
+        start_async_each(requests, std::move(callback));
+        return;
+    }
+
+    size_t started = 0;
+    auto release_started = [&](const std::exception_ptr& exception) {
+        for (size_t i = 0; i < started; ++i) {
+            requests[i]->complete_batched(exception);
+        }
+    };
+    try {
+        for (; started < requests.size(); ++started) {
+            requests[started]->infer_impl([] {});
+        }
+    } catch (...) {
+        release_started(std::current_exception());
+        throw;
+    }
+
+    auto callback_executor = requests.front()->m_callback_executor;
+    auto batch_task = [requests, callback, callback_executor]() mutable {
+        std::vector<std::exception_ptr> exceptions(requests.size());
+        for (size_t i = 0; i < requests.size(); ++i) {
+            // the task is already run by the request executor, so the stages are called directly
+            try {
+                for (auto& stage : requests[i]->m_sync_pipeline) {
+                    auto& stageTask = std::get<Stage_e::TASK>(stage);
+                    OPENVINO_ASSERT(nullptr != stageTask);
+                    stageTask();
+                }
+            } catch (...) {
+                exceptions[i] = std::current_exception();
+            }
+        }
+
+        auto completion_task = [requests, callback, exceptions]() {
+            std::exception_ptr callback_exception = nullptr;
+            if (callback) {
+                try {
+                    callback(exceptions);
+                } catch (...) {
+                    callback_exception = std::current_exception();
+                }
+            }
+            for (size_t i = 0; i < requests.size(); ++i) {
+                requests[i]->complete_batched(exceptions[i] ? exceptions[i] : callback_exception);
+            }
+        };
+        if (nullptr == callback_executor) {
+            completion_task();
+        } else {
+            callback_executor->run(std::move(completion_task));
+        }
+    };
+
+    try {
+        executor->run(std::move(batch_task));
+    } catch (...) {
+        release_started(std::current_exception());
+        throw;
+    }
+}
+
+void ov::IAsyncInferRequest::start_async_each(const std::vector<std::shared_ptr<IAsyncInferRequest>>& requests,
+                                              BatchCallback callback) {
+    struct Completions {
+        std::mutex mutex;
+        std::vector<std::exception_ptr> exceptions;
+        std::vector<bool> completed;
+        size_t remaining;
+        BatchCallback callback;
+        // callbacks of the requests set before the batch, they are set back once the request is completed
+        std::vector<std::function<void(std::exception_ptr)>> request_callbacks;
+    };
+    auto completions = std::make_shared<Completions>();
+    completions->exceptions.resize(requests.size());
+    completions->completed.resize(requests.size(), false);
+    completions->remaining = requests.size();
+    completions->callback = std::move(callback);
+    completions->request_callbacks.resize(requests.size());
+
+    auto restore_callback = [&completions](IAsyncInferRequest& request, size_t i) {
+        std::lock_guard<std::mutex> lock{request.m_mutex};
+        request.m_callback = completions->request_callbacks[i];
+    };
+
+    size_t prepared = 0;
+    size_t started = 0;
+    try {
+        for (; prepared < requests.size(); ++prepared) {
+            const auto& request = requests[prepared];
+            {
+                std::lock_guard<std::mutex> lock{request->m_mutex};
+                completions->request_callbacks[prepared] = request->m_callback;
+            }
+            std::weak_ptr<IAsyncInferRequest> weak_request = request;
+            request->set_callback([completions, weak_request, i = prepared](std::exception_ptr exception) {
+                // the callback is called with m_callback moved out, so the restored one stays set after the call;
+                // if there was no callback before, this one stays set and ignores the later completions
+                if (auto request = weak_request.lock()) {
+                    std::lock_guard<std::mutex> lock{request->m_mutex};
+                    request->m_callback = completions->request_callbacks[i];
+                }
+                BatchCallback callback;
+                {
+                    std::lock_guard<std::mutex> lock{completions->mutex};
+                    if (completions->completed[i])
+                        return;
+                    completions->completed[i] = true;
+                    completions->exceptions[i] = std::move(exception);
+                    if (0 != --completions->remaining)
+                        return;
+                    std::swap(callback, completions->callback);
+                }
+                if (callback)
+                    callback(completions->exceptions);
+            });
+        }
+        for (; started < requests.size(); ++started) {
+            requests[started]->start_async();
+        }
+    } catch (...) {
+        // the requests started before run as usual, but the batch is not completed
+        {
+            std::lock_guard<std::mutex> lock{completions->mutex};
+            completions->callback = {};
+        }
+        for (size_t i = started; i < prepared; ++i) {
+            restore_callback(*requests[i], i);
+        }
+        throw;
+    }
+}
+
+void ov::IAsyncInferRequest::complete_batched(std::exception_ptr exception) {
+    std::promise<void> promise;
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_state = InferState::IDLE;
+        promise = std::move(m_promise);
+    }
+    if (nullptr == exception) {
+        promise.set_value();
+    } else {
+        promise.set_exception(exception);
+    }
+}
+
 void ov::IAsyncInferRequest::start_async() {
     infer_impl([this] {
         start_async_thread_unsafe();
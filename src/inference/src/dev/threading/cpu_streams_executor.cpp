@@ -4,6 +4,7 @@
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <memory>
@@ -364,11 +365,10 @@ struct CPUStreamsExecutor::Impl {
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
                         _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
+                            return _pendingTasks != 0 || (stopped = _isStopped);
                         });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                        if (_pendingTasks != 0) {
+                            task = Dequeue();
                         }
                     }
                     if (task) {
@@ -379,14 +379,28 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
-    void Enqueue(Task task) {
+    void Enqueue(Task task, ov::hint::Priority priority) {
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _taskQueues[static_cast<size_t>(priority)].emplace(std::move(task));
+            ++_pendingTasks;
         }
         _queueCondVar.notify_one();
     }
 
+    // must be called under _mutex with at least one pending task
+    Task Dequeue() {
+        for (auto queue = _taskQueues.rbegin(); queue != _taskQueues.rend(); ++queue) {
+            if (!queue->empty()) {
+                Task task = std::move(queue->front());
+                queue->pop();
+                --_pendingTasks;
+                return task;
+            }
+        }
+        return {};
+    }
+
     void Execute(const Task& task, Stream& stream) {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_TBB_ADAPTIVE
         auto& arena = stream._taskArena;
@@ -454,7 +468,9 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread> _threads;
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    // one FIFO queue per ov::hint::Priority value, the queue of higher priority is served first
+    std::array<std::queue<Task>, 3> _taskQueues;
+    size_t _pendingTasks = 0;
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     std::shared_ptr<CustomThreadLocal> _streams;
@@ -529,10 +545,14 @@ void CPUStreamsExecutor::execute(Task task) {
 }
 
 void CPUStreamsExecutor::run(Task task) {
+    run(std::move(task), ov::hint::Priority::DEFAULT);
+}
+
+void CPUStreamsExecutor::run(Task task, ov::hint::Priority priority) {
     if (0 == _impl->_config.get_streams()) {
         _impl->Defer(std::move(task));
     } else {
-        _impl->Enqueue(std::move(task));
+        _impl->Enqueue(std::move(task), priority);
     }
 }
 
@@ -22,6 +22,10 @@ namespace threading {
 
 IStreamsExecutor::~IStreamsExecutor() {}
 
+void IStreamsExecutor::run(Task task, ov::hint::Priority) {
+    run(std::move(task));
+}
+
 void IStreamsExecutor::Config::set_property(const std::string& key, const ov::Any& value) {
     set_property({{key, value}});
 }
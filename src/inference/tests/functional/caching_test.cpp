@@ -2745,6 +2745,39 @@ TEST_P(CachingTest, Load_threads) {
     std::cout << "Caching Load multiple threads test completed. Tried " << index << " times" << std::endl;
 }
 
+TEST_P(CachingTest, Load_threads_shared_compiled_model) {
+    const auto THREADS_COUNT = 4;
+    EXPECT_CALL(*mockPlugin, get_property(_, _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, query_model(_, _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, import_model(A<std::istream&>(), _, _)).Times(0);
+    EXPECT_CALL(*mockPlugin, import_model(A<std::istream&>(), _)).Times(0);
+    EXPECT_CALL(*mockPlugin, import_model(A<const ov::Tensor&>(), _, _)).Times(0);
+    EXPECT_CALL(*mockPlugin, import_model(A<const ov::Tensor&>(), _)).Times(0);
+    if (m_remoteContext) {
+        return;  // compiled models with remote context are not shared
+    }
+    EXPECT_CALL(*mockPlugin, compile_model(_, _, _)).Times(0);
+    EXPECT_CALL(*mockPlugin, compile_model(A<const std::shared_ptr<const ov::Model>&>(), _)).Times(2);
+    testLoad([&](ov::Core& core) {
+        core.set_property(ov::enable_compiled_model_sharing(true));
+        EXPECT_TRUE(core.get_property(ov::enable_compiled_model_sharing.name()).as<bool>());
+        for (int iteration = 0; iteration < 2; iteration++) {
+            std::vector<ov::CompiledModel> compiled_models(THREADS_COUNT);
+            std::vector<std::thread> threads;
+            for (int i = 0; i < THREADS_COUNT; i++) {
+                threads.emplace_back(([&, i]() {
+                    compiled_models[i] = m_testFunction(core);
+                }));
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            // compiled models are released, so the next iteration compiles the model again
+        }
+    });
+    EXPECT_EQ(comp_models.size(), 2);
+}
+
 TEST_P(CachingTest, Load_mmap) {
     ON_CALL(*mockPlugin, import_model(A<const ov::Tensor&>(), _))
         .WillByDefault(Invoke([&](const ov::Tensor& itensor, const ov::AnyMap& config) {
@@ -5,7 +5,9 @@
 #include <gtest/gtest.h>
 
 #include <future>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include "common_test_utils/test_assertions.hpp"
 #include "openvino/core/parallel.hpp"
@@ -215,6 +217,88 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+TEST(CPUStreamsExecutorTests, pendingTasksAreStartedByPriority) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1});
+    std::promise<void> unblock;
+    auto blocked = unblock.get_future().share();
+    std::promise<void> started;
+    taskExecutor->run([&started, blocked] {
+        started.set_value();
+        blocked.wait();
+    });
+    started.get_future().wait();
+
+    // the single stream is busy, so all the tasks below are pending at the same time
+    std::mutex mutex;
+    std::vector<int> order;
+    std::vector<Future> futures;
+    auto submit = [&](int id, ov::hint::Priority priority) {
+        auto task = std::make_shared<std::packaged_task<void()>>([&, id] {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(id);
+        });
+        futures.push_back(task->get_future());
+        taskExecutor->run(
+            [task] {
+                (*task)();
+            },
+            priority);
+    };
+    submit(0, ov::hint::Priority::LOW);
+    submit(1, ov::hint::Priority::MEDIUM);
+    submit(2, ov::hint::Priority::HIGH);
+    submit(3, ov::hint::Priority::LOW);
+    submit(4, ov::hint::Priority::HIGH);
+
+    unblock.set_value();
+    for (auto& future : futures) {
+        future.wait();
+    }
+    ASSERT_EQ(order, std::vector<int>({2, 4, 1, 0, 3}));
+}
+
+// an executor which is not aware of the priorities, as the ones implemented out of the tree
+class PlainStreamsExecutor : public IStreamsExecutor {
+public:
+    int get_stream_id() override {
+        return 0;
+    }
+    int get_streams_num() override {
+        return 1;
+    }
+    int get_numa_node_id() override {
+        return 0;
+    }
+    int get_socket_id() override {
+        return 0;
+    }
+    std::vector<int> get_rank() override {
+        return {};
+    }
+    void cpu_reset() override {}
+    void execute(Task task) override {
+        task();
+    }
+    void run(Task task) override {
+        ++runs;
+        task();
+    }
+    int runs = 0;
+};
+
+TEST(IStreamsExecutorTests, taskWithPriorityIsRunByDefault) {
+    PlainStreamsExecutor taskExecutor;
+    bool executed = false;
+    IStreamsExecutor& streamsExecutor = taskExecutor;
+    streamsExecutor.run(
+        [&executed] {
+            executed = true;
+        },
+        ov::hint::Priority::HIGH);
+    ASSERT_TRUE(executed);
+    ASSERT_EQ(1, taskExecutor.runs);
+}
+
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
 static auto Executors = ::testing::Values(
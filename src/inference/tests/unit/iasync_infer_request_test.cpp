@@ -0,0 +1,210 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/iasync_infer_request.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <thread>
+
+#include "common_test_utils/test_assertions.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_icompiled_model.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_iplugin.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_isync_infer_request.hpp"
+
+using namespace ::testing;
+
+class IAsyncInferRequestBatchTest : public ::testing::Test {
+protected:
+    static constexpr size_t batch_size = 4;
+
+    std::shared_ptr<const ov::Model> model;
+    std::shared_ptr<ov::MockIPlugin> plugin;
+    std::shared_ptr<ov::MockICompiledModel> compiled_model;
+    std::shared_ptr<ov::threading::ITaskExecutor> executor;
+    std::vector<std::shared_ptr<ov::MockISyncInferRequest>> sync_requests;
+    std::vector<std::shared_ptr<ov::IAsyncInferRequest>> requests;
+
+    void SetUp() override {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 3});
+        auto relu = std::make_shared<ov::op::v0::Relu>(param);
+        model = std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{param});
+        plugin = std::make_shared<ov::MockIPlugin>();
+        compiled_model = std::make_shared<ov::MockICompiledModel>(model, plugin);
+        ON_CALL(*compiled_model, inputs()).WillByDefault(ReturnRefOfCopy(model->inputs()));
+        ON_CALL(*compiled_model, outputs()).WillByDefault(ReturnRefOfCopy(model->outputs()));
+        executor = std::make_shared<ov::threading::CPUStreamsExecutor>(
+            ov::threading::IStreamsExecutor::Config{"IAsyncInferRequestBatchTest", 1, 1});
+
+        for (size_t i = 0; i < batch_size; ++i) {
+            sync_requests.push_back(std::make_shared<ov::MockISyncInferRequest>(compiled_model));
+            requests.push_back(std::make_shared<ov::IAsyncInferRequest>(sync_requests.back(), executor, nullptr));
+            for (const auto& port : {model->input(), model->output()}) {
+                requests.back()->set_tensor(port, ov::make_tensor(ov::element::f32, ov::Shape{1, 3}));
+            }
+        }
+    }
+
+    void TearDown() override {
+        requests.clear();
+        for (auto& request : sync_requests) {
+            EXPECT_TRUE(Mock::VerifyAndClearExpectations(request.get()));
+        }
+    }
+};
+
+TEST_F(IAsyncInferRequestBatchTest, runsAllRequestsAndCallsCallbackOnce) {
+    std::vector<std::thread::id> threads(batch_size);
+    for (size_t i = 0; i < batch_size; ++i) {
+        EXPECT_CALL(*sync_requests[i], infer()).WillOnce([&threads, i] {
+            threads[i] = std::this_thread::get_id();
+        });
+    }
+    std::promise<std::vector<std::exception_ptr>> completed;
+    size_t callback_calls = 0;
+    OV_ASSERT_NO_THROW(ov::IAsyncInferRequest::start_async_batch(
+        requests,
+        [&](const std::vector<std::exception_ptr>& exceptions) {
+            ++callback_calls;
+            completed.set_value(exceptions);
+        }));
+
+    const auto exceptions = completed.get_future().get();
+    for (auto& request : requests) {
+        OV_ASSERT_NO_THROW(request->wait());
+    }
+    EXPECT_EQ(callback_calls, 1);
+    ASSERT_EQ(exceptions.size(), batch_size);
+    for (size_t i = 0; i < batch_size; ++i) {
+        EXPECT_EQ(exceptions[i], nullptr);
+        // all the requests are run by a single executor task
+        EXPECT_EQ(threads[i], threads.front());
+    }
+    EXPECT_NE(threads.front(), std::this_thread::get_id());
+}
+
+TEST_F(IAsyncInferRequestBatchTest, reportsExceptionOfFailedRequest) {
+    EXPECT_CALL(*sync_requests[0], infer()).Times(1);
+    EXPECT_CALL(*sync_requests[1], infer()).WillOnce(Throw(std::runtime_error("failed request")));
+    EXPECT_CALL(*sync_requests[2], infer()).Times(1);
+    EXPECT_CALL(*sync_requests[3], infer()).Times(1);
+    std::vector<std::exception_ptr> exceptions;
+    OV_ASSERT_NO_THROW(ov::IAsyncInferRequest::start_async_batch(requests,
+                                                                 [&](const std::vector<std::exception_ptr>& e) {
+                                                                     exceptions = e;
+                                                                 }));
+
+    OV_EXPECT_THROW_HAS_SUBSTRING(requests[1]->wait(), std::runtime_error, "failed request");
+    for (auto i : {0, 2, 3}) {
+        OV_ASSERT_NO_THROW(requests[i]->wait());
+    }
+    ASSERT_EQ(exceptions.size(), batch_size);
+    EXPECT_NE(exceptions[1], nullptr);
+    EXPECT_EQ(exceptions[0], nullptr);
+}
+
+TEST_F(IAsyncInferRequestBatchTest, throwsBusyForDuplicatedRequest) {
+    requests.back() = requests.front();
+    EXPECT_CALL(*sync_requests[0], infer()).Times(0);
+    EXPECT_CALL(*sync_requests[1], infer()).Times(1);
+    EXPECT_THROW(ov::IAsyncInferRequest::start_async_batch(requests, {}), ov::Busy);
+    // the requests started before the failure are released
+    EXPECT_THROW(requests.front()->wait(), ov::Busy);
+    OV_ASSERT_NO_THROW(ov::IAsyncInferRequest::start_async_batch({requests[1]}, {}));
+    OV_ASSERT_NO_THROW(requests[1]->wait());
+}
+
+// a request which customizes the execution as the plugins do, so it can't be run by the stages of the pipeline
+class CustomAsyncInferRequest : public ov::IAsyncInferRequest {
+public:
+    using ov::IAsyncInferRequest::IAsyncInferRequest;
+
+    void start_async() override {
+        ++start_async_calls;
+        ov::IAsyncInferRequest::start_async();
+    }
+
+    void infer() override {
+        OPENVINO_NOT_IMPLEMENTED;
+    }
+
+    std::atomic<size_t> start_async_calls{0};
+};
+
+TEST_F(IAsyncInferRequestBatchTest, startsCustomRequestsByOwnStartAsync) {
+    std::vector<std::shared_ptr<CustomAsyncInferRequest>> custom_requests;
+    for (size_t i = 0; i < batch_size; ++i) {
+        custom_requests.push_back(std::make_shared<CustomAsyncInferRequest>(sync_requests[i], executor, nullptr));
+        for (const auto& port : {model->input(), model->output()}) {
+            custom_requests.back()->set_tensor(port, ov::make_tensor(ov::element::f32, ov::Shape{1, 3}));
+        }
+        requests[i] = custom_requests.back();
+    }
+    EXPECT_CALL(*sync_requests[0], infer()).Times(1);
+    EXPECT_CALL(*sync_requests[1], infer()).WillOnce(Throw(std::runtime_error("failed request")));
+    EXPECT_CALL(*sync_requests[2], infer()).Times(1);
+    EXPECT_CALL(*sync_requests[3], infer()).Times(1);
+    std::promise<std::vector<std::exception_ptr>> completed;
+    size_t callback_calls = 0;
+    OV_ASSERT_NO_THROW(ov::IAsyncInferRequest::start_async_batch(
+        requests,
+        [&](const std::vector<std::exception_ptr>& exceptions) {
+            ++callback_calls;
+            completed.set_value(exceptions);
+        }));
+
+    const auto exceptions = completed.get_future().get();
+    OV_EXPECT_THROW_HAS_SUBSTRING(requests[1]->wait(), std::runtime_error, "failed request");
+    for (auto i : {0, 2, 3}) {
+        OV_ASSERT_NO_THROW(requests[i]->wait());
+    }
+    EXPECT_EQ(callback_calls, 1);
+    ASSERT_EQ(exceptions.size(), batch_size);
+    for (size_t i = 0; i < batch_size; ++i) {
+        EXPECT_EQ(custom_requests[i]->start_async_calls.load(), 1u);
+        EXPECT_EQ(exceptions[i] != nullptr, i == 1);
+    }
+}
+
+TEST_F(IAsyncInferRequestBatchTest, restoresCallbacksOfCustomRequests) {
+    std::vector<std::shared_ptr<CustomAsyncInferRequest>> custom_requests;
+    std::vector<std::atomic<size_t>> request_callback_calls(batch_size);
+    for (size_t i = 0; i < batch_size; ++i) {
+        custom_requests.push_back(std::make_shared<CustomAsyncInferRequest>(sync_requests[i], executor, nullptr));
+        for (const auto& port : {model->input(), model->output()}) {
+            custom_requests.back()->set_tensor(port, ov::make_tensor(ov::element::f32, ov::Shape{1, 3}));
+        }
+        custom_requests.back()->set_callback([&request_callback_calls, i](std::exception_ptr) {
+            ++request_callback_calls[i];
+        });
+        requests[i] = custom_requests.back();
+    }
+    for (size_t i = 0; i < batch_size; ++i) {
+        EXPECT_CALL(*sync_requests[i], infer()).Times(2);
+    }
+    std::promise<void> completed;
+    OV_ASSERT_NO_THROW(ov::IAsyncInferRequest::start_async_batch(requests, [&](const std::vector<std::exception_ptr>&) {
+        completed.set_value();
+    }));
+    completed.get_future().get();
+    for (size_t i = 0; i < batch_size; ++i) {
+        OV_ASSERT_NO_THROW(requests[i]->wait());
+        EXPECT_EQ(request_callback_calls[i].load(), 0u);
+    }
+
+    // the callbacks set before the batch are called by the next runs
+    for (size_t i = 0; i < batch_size; ++i) {
+        OV_ASSERT_NO_THROW(requests[i]->start_async());
+        OV_ASSERT_NO_THROW(requests[i]->wait());
+        EXPECT_EQ(request_callback_calls[i].load(), 1u);
+    }
+}
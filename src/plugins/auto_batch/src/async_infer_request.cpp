@@ -65,6 +65,7 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                 std::pair<AsyncInferRequest*, ov::threading::Task> t;
                 t.first = _this;
                 t.second = std::move(task);
+                workerInferRequest->on_task_arrival();
                 workerInferRequest->_tasks.push(t);
                 // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
                 const int sz = static_cast<int>(workerInferRequest->_tasks.size());
@@ -110,7 +111,8 @@ void AsyncInferRequest::set_tensors(const ov::Output<const ov::Node>& port,
 
 std::vector<ov::ProfilingInfo> AsyncInferRequest::get_profiling_info() const {
     check_state();
-    if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
+    if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status ||
+        SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == m_sync_request->m_batched_request_status)
         return m_sync_request->get_profiling_info();
     else
         return m_request_without_batch->get_profiling_info();
@@ -118,7 +120,8 @@ std::vector<ov::ProfilingInfo> AsyncInferRequest::get_profiling_info() const {
 
 std::vector<ov::SoPtr<ov::IVariableState>> AsyncInferRequest::query_state() const {
     check_state();
-    if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
+    if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status ||
+        SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == m_sync_request->m_batched_request_status)
         return m_sync_request->query_state();
     else
         return m_request_without_batch->query_state();
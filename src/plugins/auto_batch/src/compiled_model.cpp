@@ -6,9 +6,90 @@
 #include "compiled_model.hpp"
 
 #include "async_infer_request.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 
 namespace ov {
 namespace autobatch_plugin {
+namespace {
+// weight of the latest sample in the exponential moving averages of the worker statistics
+constexpr int64_t ema_weight_reciprocal = 8;
+
+int64_t now_us() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+int64_t elapsed_us(const std::chrono::steady_clock::time_point& start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+// the batch1 requests complete concurrently, so the averages are updated by several threads
+void update_ema(std::atomic<int64_t>& average, int64_t sample) {
+    auto prev = average.load();
+    while (!average.compare_exchange_weak(prev, prev ? prev + (sample - prev) / ema_weight_reciprocal : sample)) {
+    }
+}
+
+// for the partial batch the outputs of the batched request are switched to the scratch tensors,
+// as the slots of the batched outputs are shared with the requests which may still read the previous results
+void set_batched_outputs(CompiledModel::WorkerInferRequest& worker, bool partial) {
+    auto& request = worker._infer_request_batched;
+    const auto& outputs = request->get_outputs();
+    if (worker._batched_outputs.empty()) {
+        if (!partial)
+            return;
+        for (const auto& output : outputs) {
+            auto tensor = request->get_tensor(output);
+            worker._batched_outputs.push_back(tensor);
+            worker._partial_outputs.push_back(
+                {ov::make_tensor(tensor->get_element_type(), tensor->get_shape()), nullptr});
+        }
+    }
+    const auto& tensors = partial ? worker._partial_outputs : worker._batched_outputs;
+    for (size_t i = 0; i < outputs.size(); i++) {
+        if (request->get_tensor(outputs[i])._ptr != tensors[i]._ptr)
+            request->set_tensor(outputs[i], tensors[i]);
+    }
+}
+}  // namespace
+
+void CompiledModel::WorkerInferRequest::on_task_arrival() {
+    const auto now = now_us();
+    const auto last = _last_arrival_us.exchange(now);
+    if (last)
+        update_ema(_arrival_interval_us, now - last);
+}
+
+void CompiledModel::WorkerInferRequest::on_execution_completed(bool batch1, int64_t latency_us) {
+    update_ema(batch1 ? _single_latency_us : _batch_latency_us, std::max<int64_t>(latency_us, 1));
+}
+
+std::chrono::microseconds CompiledModel::WorkerInferRequest::get_timeout(std::uint32_t time_out_ms) const {
+    const std::chrono::microseconds time_out = std::chrono::milliseconds(time_out_ms);
+    const auto interval = _arrival_interval_us.load();
+    if (!interval)
+        return time_out;
+    // twice the expected time to collect the full batch at the observed arrival rate, so that the jitter doesn't
+    // break the batches, while the sparse arrivals don't make the collected requests to wait for the full timeout
+    const std::chrono::microseconds expected(2 * interval * (_batch_size - 1));
+    const std::chrono::microseconds min_time_out = std::chrono::milliseconds(1);
+    return std::max(std::min(expected, time_out), std::min(min_time_out, time_out));
+}
+
+bool CompiledModel::WorkerInferRequest::prefer_partial_batch(int num_tasks) const {
+    if (num_tasks < 2)
+        return false;
+    const auto batch_latency = _batch_latency_us.load();
+    const auto single_latency = _single_latency_us.load();
+    // the latencies which are not measured yet are explored
+    if (!batch_latency)
+        return true;
+    if (!single_latency)
+        return false;
+    // the batch1 requests are executed one after another in the worst case
+    return batch_latency <= num_tasks * single_latency;
+}
+
 CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              const ov::AnyMap& config,
@@ -70,13 +151,35 @@ CompiledModel::GetWorkerInferRequest() const {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
-                // notify the individual requests on the completion
-                for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
-                    workerRequestPtr->_completion_tasks[c]();
+                workerRequestPtr->on_execution_completed(false, elapsed_us(workerRequestPtr->_batch_start));
+                auto partial_completed = workerRequestPtr->_partial_completed;
+                workerRequestPtr->_partial_completed = nullptr;
+                try {
+                    // the partial batch outputs are written to the scratch tensors, deliver the own slots only
+                    if (!exceptionPtr) {
+                        for (auto&& request : workerRequestPtr->_partial_requests)
+                            request->m_sync_request->copy_outputs_if_needed();
+                    }
+                    workerRequestPtr->_partial_requests.clear();
+                    // notify the individual requests on the completion
+                    for (int c = 0; c < workerRequestPtr->_num_tasks_in_batch; c++) {
+                        workerRequestPtr->_completion_tasks[c]();
+                    }
+                } catch (...) {
+                    workerRequestPtr->_partial_requests.clear();
+                    // the worker thread waits for the partial batch, so it is released on every path
+                    if (!partial_completed)
+                        throw;
+                    partial_completed->set_exception(std::current_exception());
+                    return;
+                }
+                if (partial_completed) {
+                    partial_completed->set_value();
+                } else {
+                    // reset the timeout
+                    workerRequestPtr->_is_wakeup = true;
+                    workerRequestPtr->_cond.notify_one();
                 }
-                // reset the timeout
-                workerRequestPtr->_is_wakeup = true;
-                workerRequestPtr->_cond.notify_one();
             });
 
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
@@ -84,7 +187,7 @@ CompiledModel::GetWorkerInferRequest() const {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_time_out));
+                    status = workerRequestPtr->_cond.wait_for(lock, workerRequestPtr->get_timeout(m_time_out));
                     if ((status != std::cv_status::timeout) && (workerRequestPtr->_is_wakeup == false))
                         continue;
                     workerRequestPtr->_is_wakeup = false;
@@ -96,6 +199,7 @@ CompiledModel::GetWorkerInferRequest() const {
                     // it is ok to call size() (as the _tasks can only grow in parallel)
                     const int sz = static_cast<int>(workerRequestPtr->_tasks.size());
                     if (sz == workerRequestPtr->_batch_size) {
+                        set_batched_outputs(*workerRequestPtr, false);
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
                         for (int n = 0; n < sz; n++) {
                             OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
@@ -104,20 +208,71 @@ CompiledModel::GetWorkerInferRequest() const {
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        workerRequestPtr->_num_tasks_in_batch = sz;
+                        workerRequestPtr->_batch_start = std::chrono::steady_clock::now();
                         workerRequestPtr->_infer_request_batched->start_async();
+                    } else if ((status == std::cv_status::timeout) && sz &&
+                               workerRequestPtr->prefer_partial_batch(sz)) {
+                        // timeout to collect the batch is over, execute the collected requests as the partial batch,
+                        // the rest of the batch is padded with the stale inputs and its outputs are discarded
+                        set_batched_outputs(*workerRequestPtr, true);
+                        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
+                        for (int n = 0; n < sz; n++) {
+                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                            workerRequestPtr->_completion_tasks[n] = std::move(t.second);
+                            workerRequestPtr->_partial_requests.push_back(t.first);
+                            t.first->m_sync_request->copy_inputs_if_needed();
+                            t.first->m_sync_request->m_batched_request_status =
+                                ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+                        }
+                        std::promise<void> partial_completed;
+                        auto partial_completed_future = partial_completed.get_future();
+                        workerRequestPtr->_partial_completed = &partial_completed;
+                        workerRequestPtr->_num_tasks_in_batch = sz;
+                        workerRequestPtr->_batch_start = std::chrono::steady_clock::now();
+                        bool started = false;
+                        try {
+                            workerRequestPtr->_infer_request_batched->start_async();
+                            started = true;
+                            // the requests which are not in the partial batch may complete the next batch meanwhile,
+                            // so wait for the batched request to become idle
+                            partial_completed_future.get();
+                        } catch (...) {
+                            // the completion callback is not called if the batched request failed to start,
+                            // otherwise the exception is thrown by the callback after the requests are notified
+                            if (!started) {
+                                workerRequestPtr->_partial_completed = nullptr;
+                                workerRequestPtr->_partial_requests.clear();
+                                workerRequestPtr->_exception_ptr = std::current_exception();
+                                for (int c = 0; c < sz; c++) {
+                                    workerRequestPtr->_completion_tasks[c]();
+                                }
+                            }
+                        }
                     } else if ((status == std::cv_status::timeout) && sz) {
                         // timeout to collect the batch is over, have to execute the requests in the batch1 mode
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
                         // popping all tasks collected by the moment of the time-out and execute each with batch1
                         std::atomic<int> arrived = {0};
+                        std::atomic<int64_t> last_completed_us = {0};
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
                         for (int n = 0; n < sz; n++) {
                             OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                            // the device may execute the requests one after another, so the latency of a request is
+                            // measured from its own start or the completion of the previous one, whichever is later,
+                            // not including the time it is queued behind the other requests
+                            const auto start_us = now_us();
                             t.first->m_request_without_batch->set_callback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
+                                [t, sz, start_us, workerRequestPtr, &arrived, &last_completed_us, &all_completed](
+                                    std::exception_ptr p) {
                                     if (p)
                                         t.first->m_sync_request->m_exception_ptr = p;
+                                    const auto completed_us = now_us();
+                                    const auto previous_us = last_completed_us.exchange(completed_us);
+                                    workerRequestPtr->on_execution_completed(
+                                        true,
+                                        completed_us - std::max(start_us, previous_us));
                                     t.second();
                                     if (sz == ++arrived) {
                                         all_completed.set_value();
@@ -125,8 +280,18 @@ CompiledModel::GetWorkerInferRequest() const {
                                 });
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
-                            t.first->m_sync_request->set_tensors_to_another_request(t.first->m_request_without_batch);
-                            t.first->m_request_without_batch->start_async();
+                            try {
+                                t.first->m_sync_request->set_tensors_to_another_request(
+                                    t.first->m_request_without_batch);
+                                t.first->m_request_without_batch->start_async();
+                            } catch (...) {
+                                // the callback is not called for the request failed to start
+                                t.first->m_sync_request->m_exception_ptr = std::current_exception();
+                                t.second();
+                                if (sz == ++arrived) {
+                                    all_completed.set_value();
+                                }
+                            }
                         }
                         all_completed_future.get();
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
@@ -5,7 +5,9 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
+#include <future>
 #include <thread>
 
 #include "openvino/runtime/iasync_infer_request.hpp"
@@ -31,6 +33,33 @@ public:
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
         bool _is_wakeup;
+
+        // number of requests in the batch being executed, less than _batch_size for the partial batch
+        int _num_tasks_in_batch = 0;
+        // requests of the partial batch, their outputs are copied from _partial_outputs on completion
+        std::vector<ov::autobatch_plugin::AsyncInferRequest*> _partial_requests;
+        // outputs of the batched request are redirected to these tensors for the partial batch,
+        // so that the slots of requests which don't participate in it are not overwritten
+        std::vector<ov::SoPtr<ov::ITensor>> _partial_outputs;
+        std::vector<ov::SoPtr<ov::ITensor>> _batched_outputs;
+        std::promise<void>* _partial_completed = nullptr;
+        std::chrono::steady_clock::time_point _batch_start;
+
+        // statistics for the adaptive timeout and the partial batch decision, in microseconds
+        std::atomic<int64_t> _last_arrival_us = {0};
+        std::atomic<int64_t> _arrival_interval_us = {0};
+        std::atomic<int64_t> _batch_latency_us = {0};
+        std::atomic<int64_t> _single_latency_us = {0};
+
+        // registers arrival of the new request to update the observed arrival rate
+        void on_task_arrival();
+        // accumulates latency of the batched (batch1 == false) or the batch1 execution
+        void on_execution_completed(bool batch1, int64_t latency_us);
+        // time to wait for the full batch: the time to collect it at the observed arrival rate,
+        // limited by the AUTO_BATCH_TIMEOUT
+        std::chrono::microseconds get_timeout(std::uint32_t time_out_ms) const;
+        // true if executing num_tasks requests as a partial batch is expected to be faster than batch1 executions
+        bool prefer_partial_batch(int num_tasks) const;
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
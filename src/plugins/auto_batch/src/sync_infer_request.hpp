@@ -40,7 +40,8 @@ public:
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
-        TIMEOUT_EXECUTED
+        TIMEOUT_EXECUTED,
+        PARTIAL_BATCH_EXECUTED  // executed by the batched request, outputs are already copied
     } m_batched_request_status = eExecutionFlavor::NOT_EXECUTED;
 
     size_t get_batch_size() const;
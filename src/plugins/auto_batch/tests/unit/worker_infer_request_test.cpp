@@ -0,0 +1,172 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mock_common.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/runtime/threading/immediate_executor.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_icore.hpp"
+
+using WorkerInferRequest = CompiledModel::WorkerInferRequest;
+
+class WorkerInferRequestTest : public ::testing::Test {
+public:
+    WorkerInferRequest m_worker;
+
+    void SetUp() override {
+        m_worker._batch_size = 4;
+        m_worker._is_wakeup = false;
+    }
+};
+
+TEST_F(WorkerInferRequestTest, timeout_is_not_changed_without_statistics) {
+    EXPECT_EQ(m_worker.get_timeout(1000), std::chrono::milliseconds(1000));
+}
+
+TEST_F(WorkerInferRequestTest, timeout_follows_arrival_rate) {
+    m_worker._arrival_interval_us = 2000;
+    // twice the time to collect 3 more requests
+    EXPECT_EQ(m_worker.get_timeout(1000), std::chrono::microseconds(12000));
+    // limited by the user timeout
+    EXPECT_EQ(m_worker.get_timeout(10), std::chrono::milliseconds(10));
+    m_worker._arrival_interval_us = 1;
+    EXPECT_EQ(m_worker.get_timeout(1000), std::chrono::milliseconds(1));
+    EXPECT_EQ(m_worker.get_timeout(0), std::chrono::milliseconds(0));
+}
+
+TEST_F(WorkerInferRequestTest, partial_batch_is_explored_first) {
+    EXPECT_FALSE(m_worker.prefer_partial_batch(1));
+    EXPECT_TRUE(m_worker.prefer_partial_batch(2));
+    m_worker.on_execution_completed(false, 3000);
+    EXPECT_FALSE(m_worker.prefer_partial_batch(2));
+}
+
+TEST_F(WorkerInferRequestTest, partial_batch_is_selected_by_latency) {
+    m_worker.on_execution_completed(false, 3000);
+    m_worker.on_execution_completed(true, 1000);
+    EXPECT_FALSE(m_worker.prefer_partial_batch(2));
+    EXPECT_TRUE(m_worker.prefer_partial_batch(3));
+}
+
+class PartialBatchExecutionTest : public ::testing::Test {
+public:
+    static constexpr size_t batch_size = 4;
+    static constexpr size_t num_elements = 8;
+
+    std::shared_ptr<NiceMock<MockAutoBatchInferencePlugin>> m_auto_batch_plugin;
+    std::shared_ptr<NiceMock<MockICompiledModel>> m_i_compile_model_with_batch;
+    std::shared_ptr<NiceMock<MockICompiledModel>> m_i_compile_model_without_batch;
+    std::shared_ptr<NiceMock<MockISyncInferRequest>> m_sync_infer_request_with_batch;
+    std::shared_ptr<ov::threading::ImmediateExecutor> m_executor;
+    std::shared_ptr<CompiledModel> m_auto_batch_compile_model;
+    std::vector<std::shared_ptr<ov::IAsyncInferRequest>> m_requests;
+
+    static std::shared_ptr<ov::Model> make_model(size_t batch) {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{batch, num_elements});
+        auto relu = std::make_shared<ov::op::v0::Relu>(param);
+        return std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{param});
+    }
+
+    void SetUp() override {
+        m_auto_batch_plugin =
+            std::shared_ptr<NiceMock<MockAutoBatchInferencePlugin>>(new NiceMock<MockAutoBatchInferencePlugin>());
+        m_auto_batch_plugin->set_core(std::make_shared<NiceMock<ov::MockICore>>());
+
+        auto model = make_model(1);
+        m_i_compile_model_with_batch =
+            std::make_shared<NiceMock<MockICompiledModel>>(make_model(batch_size), m_auto_batch_plugin);
+        m_i_compile_model_without_batch = std::make_shared<NiceMock<MockICompiledModel>>(model, m_auto_batch_plugin);
+        m_sync_infer_request_with_batch =
+            std::make_shared<NiceMock<MockISyncInferRequest>>(m_i_compile_model_with_batch);
+        m_executor = std::make_shared<ov::threading::ImmediateExecutor>();
+
+        // the batched request adds 100 to every slot of the batch, including the padded ones
+        ON_CALL(*m_sync_infer_request_with_batch, infer()).WillByDefault([this]() {
+            auto& request = *m_sync_infer_request_with_batch;
+            const auto input = request.get_tensor(request.get_inputs()[0]);
+            const auto output = request.get_tensor(request.get_outputs()[0]);
+            const auto src = input->data<const float>();
+            auto dst = output->data<float>();
+            for (size_t i = 0; i < input->get_size(); i++)
+                dst[i] = src[i] + 100.f;
+        });
+        ON_CALL(*m_i_compile_model_with_batch, create_infer_request()).WillByDefault([this]() {
+            return std::make_shared<ov::IAsyncInferRequest>(m_sync_infer_request_with_batch, m_executor, nullptr);
+        });
+        ON_CALL(*m_i_compile_model_without_batch, create_infer_request()).WillByDefault([this]() {
+            auto request = std::make_shared<NiceMock<MockISyncInferRequest>>(m_i_compile_model_without_batch);
+            return std::make_shared<ov::IAsyncInferRequest>(request, m_executor, nullptr);
+        });
+
+        const ov::AnyMap config = {{ov::auto_batch_timeout.name(), "10"}};
+        const DeviceInformation device_info = {"CPU", {}, batch_size};
+        const std::set<std::size_t> batched_ids = {0};
+        OV_ASSERT_NO_THROW(m_auto_batch_compile_model =
+                               std::make_shared<CompiledModel>(model->clone(),
+                                                               m_auto_batch_plugin,
+                                                               config,
+                                                               device_info,
+                                                               batched_ids,
+                                                               batched_ids,
+                                                               {m_i_compile_model_with_batch, {}},
+                                                               {m_i_compile_model_without_batch, {}},
+                                                               {}));
+        for (size_t i = 0; i < batch_size; i++) {
+            m_requests.push_back(m_auto_batch_compile_model->create_infer_request());
+            auto input = m_requests.back()->get_tensor(m_requests.back()->get_inputs()[0]);
+            auto output = m_requests.back()->get_tensor(m_requests.back()->get_outputs()[0]);
+            std::fill_n(input->data<float>(), num_elements, static_cast<float>(i));
+            std::fill_n(output->data<float>(), num_elements, -1.f);
+        }
+    }
+
+    void TearDown() override {
+        m_requests.clear();
+        m_auto_batch_compile_model.reset();
+        m_sync_infer_request_with_batch.reset();
+        m_i_compile_model_with_batch.reset();
+        m_i_compile_model_without_batch.reset();
+        m_auto_batch_plugin.reset();
+    }
+
+    std::vector<float> get_output(size_t request_id) const {
+        const auto& request = m_requests[request_id];
+        auto output = request->get_tensor(request->get_outputs()[0]);
+        return {output->data<const float>(), output->data<const float>() + num_elements};
+    }
+};
+
+TEST_F(PartialBatchExecutionTest, own_slots_are_delivered_and_the_rest_are_discarded) {
+    EXPECT_CALL(*m_sync_infer_request_with_batch, infer()).Times(1);
+    // the batch is not collected in time, so the two requests are executed as the partial batch
+    m_requests[0]->start_async();
+    m_requests[1]->start_async();
+    OV_ASSERT_NO_THROW(m_requests[0]->wait());
+    OV_ASSERT_NO_THROW(m_requests[1]->wait());
+
+    EXPECT_EQ(get_output(0), std::vector<float>(num_elements, 100.f));
+    EXPECT_EQ(get_output(1), std::vector<float>(num_elements, 101.f));
+    // the padded slots are computed into the scratch tensor and don't overwrite the outputs of the idle requests
+    EXPECT_EQ(get_output(2), std::vector<float>(num_elements, -1.f));
+    EXPECT_EQ(get_output(3), std::vector<float>(num_elements, -1.f));
+    auto& batched_request = *m_sync_infer_request_with_batch;
+    auto scratch_output = batched_request.get_tensor(batched_request.get_outputs()[0]);
+    EXPECT_NE(scratch_output->data(), m_requests[0]->get_tensor(m_requests[0]->get_outputs()[0])->data());
+    EXPECT_EQ(scratch_output->data<const float>()[3 * num_elements], 103.f);
+}
+
+TEST_F(PartialBatchExecutionTest, failure_of_the_partial_batch_is_reported_to_its_requests) {
+    EXPECT_CALL(*m_sync_infer_request_with_batch, infer()).WillOnce([]() {
+        OPENVINO_THROW("batched inference failed");
+    });
+    m_requests[0]->start_async();
+    m_requests[1]->start_async();
+    EXPECT_THROW(m_requests[0]->wait(), ov::Exception);
+    EXPECT_THROW(m_requests[1]->wait(), ov::Exception);
+    EXPECT_EQ(get_output(0), std::vector<float>(num_elements, -1.f));
+    EXPECT_EQ(get_output(1), std::vector<float>(num_elements, -1.f));
+    // the worker is released, so the compiled model is destroyed without waiting for the batch forever
+    m_requests.clear();
+    m_auto_batch_compile_model.reset();
+}
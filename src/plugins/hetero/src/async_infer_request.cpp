@@ -21,12 +21,53 @@ struct RequestExecutor : ov::threading::ITaskExecutor {
     ov::threading::Task m_task;
 };
 
+ov::hetero::PipelineLimiter::PipelineLimiter(uint32_t depth) : m_depth(depth) {
+    OPENVINO_ASSERT(m_depth > 0, "Pipeline depth must be greater than zero");
+}
+
+void ov::hetero::PipelineLimiter::run(ov::threading::Task task) {
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if (m_in_flight == m_depth) {
+            m_pending.push(std::move(task));
+            return;
+        }
+        ++m_in_flight;
+    }
+    task();
+}
+
+void ov::hetero::PipelineLimiter::release() {
+    ov::threading::Task task;
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if (m_pending.empty()) {
+            --m_in_flight;
+            return;
+        }
+        // the slot is passed to the pending request
+        task = std::move(m_pending.front());
+        m_pending.pop();
+    }
+    task();
+}
+
 ov::hetero::AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<ov::hetero::InferRequest>& request,
                                                  const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
-                                                 const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor)
+                                                 const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor,
+                                                 const std::shared_ptr<PipelineLimiter>& pipeline_limiter)
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
-      m_infer_request(std::static_pointer_cast<ov::hetero::InferRequest>(request)) {
+      m_infer_request(std::static_pointer_cast<ov::hetero::InferRequest>(request)),
+      m_pipeline_limiter(pipeline_limiter) {
     m_pipeline.clear();
+    if (m_pipeline_limiter) {
+        // the first stage waits for a free slot in the pipeline, the slot is released by the callback, which is
+        // called both on the completion and on the failure of any stage
+        m_pipeline.emplace_back(m_pipeline_limiter, [this] {
+            m_admitted = true;
+        });
+        set_callback(nullptr);
+    }
     for (auto&& request : m_infer_request->m_subrequests) {
         auto request_executor = std::make_shared<RequestExecutor>(request);
         m_pipeline.emplace_back(request_executor, [request_executor] {
@@ -39,6 +80,27 @@ ov::hetero::AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<ov::heter
 
 ov::hetero::AsyncInferRequest::~AsyncInferRequest() {
     ov::IAsyncInferRequest::stop_and_wait();
+    // the callback is reset by stop_and_wait, so the slot of the last request is released here
+    leave_pipeline();
+}
+
+void ov::hetero::AsyncInferRequest::leave_pipeline() {
+    if (m_pipeline_limiter && m_admitted.exchange(false)) {
+        m_pipeline_limiter->release();
+    }
+}
+
+void ov::hetero::AsyncInferRequest::set_callback(std::function<void(std::exception_ptr)> callback) {
+    if (!m_pipeline_limiter) {
+        ov::IAsyncInferRequest::set_callback(std::move(callback));
+        return;
+    }
+    ov::IAsyncInferRequest::set_callback([this, callback](std::exception_ptr exception_ptr) {
+        leave_pipeline();
+        if (callback) {
+            callback(std::move(exception_ptr));
+        }
+    });
 }
 
 void ov::hetero::AsyncInferRequest::cancel() {
@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <queue>
 
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "sync_infer_request.hpp"
@@ -12,18 +15,43 @@
 namespace ov {
 namespace hetero {
 
+// Admits at most `depth` requests to the pipeline of submodels, so no stage has more requests in flight.
+// The requests above the limit are started when the previous ones leave the pipeline.
+class PipelineLimiter : public ov::threading::ITaskExecutor {
+public:
+    explicit PipelineLimiter(uint32_t depth);
+
+    void run(ov::threading::Task task) override;
+
+    // called when an admitted request leaves the pipeline
+    void release();
+
+private:
+    std::mutex m_mutex;
+    const uint32_t m_depth;
+    uint32_t m_in_flight = 0;
+    std::queue<ov::threading::Task> m_pending;
+};
+
 class AsyncInferRequest : public ov::IAsyncInferRequest {
 public:
     AsyncInferRequest(const std::shared_ptr<InferRequest>& request,
                       const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
-                      const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor);
+                      const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor,
+                      const std::shared_ptr<PipelineLimiter>& pipeline_limiter = nullptr);
 
     ~AsyncInferRequest();
 
     void cancel() override;
 
+    void set_callback(std::function<void(std::exception_ptr)> callback) override;
+
 private:
+    void leave_pipeline();
+
     std::shared_ptr<InferRequest> m_infer_request;
+    std::shared_ptr<PipelineLimiter> m_pipeline_limiter;
+    std::atomic<bool> m_admitted = {false};
 };
 
 }  // namespace hetero
@@ -40,7 +40,8 @@ ov::hetero::CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model
 }
 
 void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::SubmodelInfo>& submodels) {
-    const bool add_exclusive = submodels.size() > 1;
+    // submodels of the pipelined model keep own executors to run different requests at the same time
+    const bool add_exclusive = submodels.size() > 1 && m_cfg.pipeline_depth == 0;
     const auto& hetero_plugin = get_hetero_plugin();
     const auto& core = hetero_plugin->get_core();
     const auto& device_properties = m_cfg.get_device_properties();
@@ -75,6 +76,12 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
         m_compiled_submodels.emplace_back(std::move(desc));
     }
     set_inputs_and_outputs();
+    create_pipeline_limiter();
+}
+
+void ov::hetero::CompiledModel::create_pipeline_limiter() {
+    if (m_compiled_submodels.size() > 1 && m_cfg.pipeline_depth > 0)
+        m_pipeline_limiter = std::make_shared<ov::hetero::PipelineLimiter>(m_cfg.pipeline_depth);
 }
 
 ov::hetero::CompiledModel::CompiledModel(std::istream& model,
@@ -168,6 +175,7 @@ ov::hetero::CompiledModel::CompiledModel(std::istream& model,
     }
     // clang-format on
     set_inputs_and_outputs();
+    create_pipeline_limiter();
 }
 
 std::shared_ptr<ov::ISyncInferRequest> ov::hetero::CompiledModel::create_sync_infer_request() const {
@@ -180,7 +188,8 @@ std::shared_ptr<ov::IAsyncInferRequest> ov::hetero::CompiledModel::create_infer_
     auto async_infer_request = std::make_shared<ov::hetero::AsyncInferRequest>(
         std::static_pointer_cast<ov::hetero::InferRequest>(internal_request),
         get_task_executor(),
-        get_callback_executor());
+        get_callback_executor(),
+        m_pipeline_limiter);
 
     return async_infer_request;
 }
@@ -261,6 +270,8 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
                              comp_model_desc.compiled_model->get_property(ov::optimal_number_of_infer_requests.name())
                                  .as<unsigned int>());
         }
+        // keep all the stages of the pipeline busy
+        value = std::max(value, m_cfg.pipeline_depth);
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
     } else if (ov::execution_devices == name) {
         std::vector<std::string> device_names;
@@ -16,6 +16,7 @@ namespace hetero {
 
 class Plugin;
 class InferRequest;
+class PipelineLimiter;
 
 class CompiledModel : public ov::ICompiledModel {
 public:
@@ -56,6 +57,8 @@ private:
 
     void set_inputs_and_outputs();
 
+    void create_pipeline_limiter();
+
     Configuration m_cfg;
     std::string m_name;
     const bool m_loaded_from_cache;
@@ -69,6 +72,8 @@ private:
         ov::SoPtr<ov::ICompiledModel> compiled_model;
     };
     std::vector<CompiledModelDesc> m_compiled_submodels;
+    // limits the number of requests in the pipeline of submodels to HETERO_PIPELINE_DEPTH
+    std::shared_ptr<PipelineLimiter> m_pipeline_limiter;
 };
 }  // namespace hetero
 }  // namespace ov
@@ -38,6 +38,8 @@ struct Configuration {
 
     std::set<ov::hint::ModelDistributionPolicy> modelDistributionPolicy = {};
 
+    uint32_t pipeline_depth = 0;
+
     EncryptionCallbacks encryption_callbacks;
 
     ov::AnyMap device_properties;
@@ -4,6 +4,7 @@
 
 #include "plugin.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <map>
 #include <memory>
@@ -210,12 +211,20 @@ std::pair<ov::SupportedOpsMap, ov::hetero::SubgraphsMappingInfo> ov::hetero::Plu
     //  WARNING: Here is devices with user set priority
     auto device_names = ov::DeviceIDParser::get_hetero_devices(full_config.device_priorities);
     bool hetero_query_model_by_device = false;
+    bool pipeline_by_cost = false;
     if (full_config.modelDistributionPolicy.count(ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL) != 0) {
         get_device_memory_map(device_names, available_device_mem_map);
         // Will disable hetero query model by device if there is no device's available memory is obtained.
         if (available_device_mem_map.size() != 0) {
             hetero_query_model_by_device = true;
         }
+        // The devices which can't be split by the memory size take the stages with the balanced compute cost
+        pipeline_by_cost = device_names.size() > 1 &&
+                           std::none_of(device_names.begin(), device_names.end(), [&](const std::string& device_name) {
+                               return ov::util::contains(
+                                   get_core()->get_property(device_name, ov::internal::supported_properties),
+                                   ov::internal::query_model_ratio);
+                           });
     }
 
     auto update_supported_ops = [](ov::SupportedOpsMap& final_results, const ov::SupportedOpsMap& device_results) {
@@ -295,6 +304,32 @@ std::pair<ov::SupportedOpsMap, ov::hetero::SubgraphsMappingInfo> ov::hetero::Plu
         }
     }
     model->add_results(new_outputs);
+    if (pipeline_by_cost) {
+        // each device takes the stage of the model with the balanced estimated cost, the nodes which are not
+        // supported by the device of their stage fall back to the first device which supports them
+        const auto stages = ov::hetero::split_model_by_cost(model, device_names.size());
+        for (const auto& device_name : device_names) {
+            query_results[device_name] =
+                get_core()->query_model(model, device_name, properties_per_device.at(device_name));
+        }
+        for (const auto& [name, stage] : stages) {
+            const auto& stage_device = device_names[stage];
+            if (query_results[stage_device].count(name)) {
+                supported_ops_final.emplace(name, stage_device);
+                continue;
+            }
+            for (const auto& device_name : device_names) {
+                if (query_results[device_name].count(name)) {
+                    supported_ops_final.emplace(name, device_name);
+                    break;
+                }
+            }
+        }
+        const auto& default_device = allow_exception ? "" : get_device_name();
+        mapping_info =
+            ov::hetero::mask_model_subgraphs_by_ops(model, supported_ops_final, m_cfg.dump_dot_files(), default_device);
+        return {supported_ops_final, mapping_info};
+    }
     for (const auto& device_name : device_names) {
         // If there are some unsupported operations and it is a last device
         // exception should be raised when allowed
@@ -365,7 +400,9 @@ ov::Any ov::hetero::Plugin::get_property(const std::string& name, const ov::AnyM
         return ro_properties;
     };
     const auto& default_rw_properties = []() {
-        std::vector<ov::PropertyName> rw_properties{ov::device::priorities, ov::hint::model_distribution_policy};
+        std::vector<ov::PropertyName> rw_properties{ov::device::priorities,
+                                                    ov::hint::model_distribution_policy,
+                                                    ov::hetero::pipeline_depth};
         return rw_properties;
     };
 
@@ -17,5 +17,15 @@ static constexpr Property<std::string, PropertyMutability::RO> caching_device_pr
  * @brief Read-only property showing number of compiled submodels
  */
 static constexpr Property<size_t, PropertyMutability::RO> number_of_submodels{"HETERO_NUMBER_OF_SUBMODELS"};
+
+/**
+ * @brief Number of infer requests which are expected to be in flight in the pipeline of submodels.
+ * When set to non-zero value, submodels of the split model are executed by their own device executors, so the
+ * next request runs the first submodel while the previous one runs the next submodel. At most this number of
+ * requests are in the pipeline at the same time, the requests above the limit wait until the previous ones
+ * complete. The value is also reported as ov::optimal_number_of_infer_requests of the compiled model.
+ * Default value is 0 which means that submodels on the same device share the exclusive executor.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> pipeline_depth{"HETERO_PIPELINE_DEPTH"};
 }  // namespace hetero
 }  // namespace ov
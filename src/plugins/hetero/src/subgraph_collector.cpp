@@ -12,6 +12,9 @@
 #include "openvino/core/graph_util.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/op/constant.hpp"
+#include "openvino/op/convolution.hpp"
+#include "openvino/op/group_conv.hpp"
+#include "openvino/op/matmul.hpp"
 #include "openvino/op/paged_attention.hpp"
 #include "openvino/op/reshape.hpp"
 #include "openvino/op/util/op_types.hpp"
@@ -783,3 +786,94 @@ ov::hetero::SubgraphsMappingInfo ov::hetero::mask_model_subgraphs_by_ops(std::sh
     }
     return new_mapping_info;
 }
+
+double ov::hetero::estimate_node_cost(const std::shared_ptr<const ov::Node>& node) {
+    // FLOPs per byte which the typical CPU socket reaches, memory bound nodes are scaled by it
+    constexpr double machine_balance = 8.0;
+    if (ov::op::util::is_constant(node.get()) || ov::op::util::is_parameter(node.get()) ||
+        ov::op::util::is_output(node.get()) || ov::op::util::is_sink(node.get())) {
+        return 0.0;
+    }
+    double bytes = 0.0;
+    for (const auto& output : node->outputs()) {
+        if (output.get_partial_shape().is_dynamic())
+            return 1.0;
+        bytes += static_cast<double>(output.get_element_type().size() * ov::shape_size(output.get_shape()));
+    }
+    // the weights are read on each inference
+    for (const auto& input : node->inputs()) {
+        const auto& source = input.get_source_output();
+        if (ov::op::util::is_constant(source.get_node()))
+            bytes += static_cast<double>(source.get_element_type().size() * ov::shape_size(source.get_shape()));
+    }
+
+    double flops = 0.0;
+    const auto out_elements = static_cast<double>(ov::shape_size(node->get_output_shape(0)));
+    if (const auto matmul = ov::as_type<const ov::op::v0::MatMul>(node.get())) {
+        const auto& a_shape = matmul->get_input_partial_shape(0);
+        if (a_shape.is_static() && a_shape.size() > 0) {
+            const auto k_axis = a_shape.size() == 1 || !matmul->get_transpose_a() ? a_shape.size() - 1
+                                                                                 : a_shape.size() - 2;
+            flops = 2.0 * out_elements * static_cast<double>(a_shape[k_axis].get_length());
+        }
+    } else if (ov::is_type<const ov::op::v1::Convolution>(node) ||
+               ov::is_type<const ov::op::v1::GroupConvolution>(node)) {
+        const auto& w_shape = node->get_input_partial_shape(1);
+        if (w_shape.is_static()) {
+            // Convolution weights are [O, I, k...], GroupConvolution weights are [G, O, I, k...]
+            const size_t out_dims = ov::is_type<const ov::op::v1::Convolution>(node) ? 1 : 2;
+            const auto w = w_shape.to_shape();
+            const auto macs_per_output =
+                ov::shape_size(w) / ov::shape_size(ov::Shape(w.begin(), w.begin() + out_dims));
+            flops = 2.0 * out_elements * static_cast<double>(macs_per_output);
+        }
+    }
+    return std::max(flops, bytes * machine_balance);
+}
+
+std::map<std::string, size_t> ov::hetero::split_model_by_cost(const std::shared_ptr<const ov::Model>& model,
+                                                              size_t num_stages) {
+    OPENVINO_ASSERT(num_stages > 0, "Number of stages must be positive");
+    const auto ordered_ops = model->get_ordered_ops();
+    std::vector<double> costs;
+    costs.reserve(ordered_ops.size());
+    double total_cost = 0.0;
+    for (const auto& node : ordered_ops) {
+        costs.push_back(estimate_node_cost(node));
+        total_cost += costs.back();
+    }
+
+    std::map<std::string, size_t> stages;
+    std::unordered_map<const ov::Node*, size_t> node_stages;
+    double accumulated_cost = 0.0;
+    size_t stage = 0;
+    for (size_t i = 0; i < ordered_ops.size(); ++i) {
+        const auto& node = ordered_ops[i];
+        if (ov::op::util::is_constant(node))
+            continue;
+        // the node belongs to the stage which contains the middle of its cost, the stage index never decreases
+        // along the topological order, so the data doesn't flow back to the previous stages
+        if (total_cost > 0.0 && costs[i] > 0.0) {
+            const auto middle = (accumulated_cost + costs[i] / 2.0) / total_cost;
+            stage = std::max(stage, std::min(num_stages - 1, static_cast<size_t>(middle * num_stages)));
+            accumulated_cost += costs[i];
+        }
+        const auto node_stage = ov::op::util::is_parameter(node) ? 0 : stage;
+        node_stages[node.get()] = node_stage;
+        stages[node->get_friendly_name()] = node_stage;
+    }
+    for (const auto& node : ordered_ops) {
+        if (!ov::op::util::is_constant(node))
+            continue;
+        size_t const_stage = num_stages - 1;
+        for (const auto& output : node->outputs()) {
+            for (const auto& target : output.get_target_inputs()) {
+                const auto consumer = node_stages.find(target.get_node());
+                if (consumer != node_stages.end())
+                    const_stage = std::min(const_stage, consumer->second);
+            }
+        }
+        stages[node->get_friendly_name()] = const_stage;
+    }
+    return stages;
+}
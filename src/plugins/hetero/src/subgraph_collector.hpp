@@ -91,5 +91,14 @@ SubgraphsMappingInfo mask_model_subgraphs_by_ops(std::shared_ptr<ov::Model>& mod
 
 void fix_submodel_with_paged_attention(std::shared_ptr<ov::Model>& model);
 
+// Estimated execution cost of the node: FLOPs of MatMul / Convolution or bytes of the data touched by other nodes
+// scaled by FLOPs per byte of the typical machine
+double estimate_node_cost(const std::shared_ptr<const ov::Node>& node);
+
+// Splits the model into num_stages stages with the balanced estimated cost. Stages are contiguous in the topological
+// order, so the data flows from the stage to the next ones only. Constants are placed to the stage of their consumer
+// to keep the weights local to the stage. Returns the stage index for each friendly name of the model operations.
+std::map<std::string, size_t> split_model_by_cost(const std::shared_ptr<const ov::Model>& model, size_t num_stages);
+
 }  // namespace hetero
 }  // namespace ov
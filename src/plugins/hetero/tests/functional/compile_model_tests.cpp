@@ -1,11 +1,16 @@
 // Copyright (C) 2018-2026 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 #include "common_test_utils/test_constants.hpp"
 #include "hetero_tests.hpp"
 #include "openvino/runtime/exec_model_info.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "properties.hpp"
 
 using namespace ov::hetero::tests;
 
@@ -99,6 +104,66 @@ TEST_F(HeteroTests, compile_with_device_properties_no_exclusive) {
     EXPECT_EQ(6, mock1_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
 }
 
+TEST_F(HeteroTests, compile_with_pipeline_depth_no_exclusive) {
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"),
+                         ov::hetero::pipeline_depth(4),
+                         ov::device::properties("MOCK0", ov::num_streams(4)),
+                         ov::device::properties("MOCK1", ov::num_streams(6))};
+    auto model = create_model_with_subtract_reshape();
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_HETERO, config);
+    auto device_properties = compiled_model.get_property(ov::device::properties.name()).as<ov::AnyMap>();
+    ASSERT_TRUE(device_properties.count("MOCK0.0"));
+    auto mock0_properties = device_properties.at("MOCK0.0").as<ov::AnyMap>();
+    EXPECT_EQ(4, mock0_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
+    ASSERT_TRUE(device_properties.count("MOCK1.0"));
+    auto mock1_properties = device_properties.at("MOCK1.0").as<ov::AnyMap>();
+    EXPECT_EQ(6, mock1_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
+}
+
+TEST_F(HeteroTests, pipeline_depth_limits_requests_in_flight) {
+    const uint32_t depth = 2;
+    // Add and Subtract are executed by MOCK1, Reshape by MOCK0
+    ov::AnyMap config = {ov::device::priorities("MOCK1,MOCK0"), ov::hetero::pipeline_depth(depth)};
+    auto model = create_model_with_subtract_reshape();
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_HETERO, config);
+    ASSERT_EQ(2u, compiled_model.get_property(ov::hetero::number_of_submodels));
+
+    // a request is in flight from the start of the first submodel till the end of the last one,
+    // the last submodel is slow, so without the limit all the requests would pass the first one
+    std::atomic<uint32_t> in_flight{0};
+    std::atomic<uint32_t> max_in_flight{0};
+    on_infer = [&](const std::string& device_name) {
+        if (device_name == "MOCK1") {
+            auto current = ++in_flight;
+            auto max = max_in_flight.load();
+            while (max < current && !max_in_flight.compare_exchange_weak(max, current)) {
+            }
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            --in_flight;
+        }
+    };
+
+    std::vector<ov::InferRequest> requests;
+    for (uint32_t i = 0; i < 3 * depth; i++) {
+        requests.push_back(compiled_model.create_infer_request());
+        requests.back().set_input_tensor(create_and_fill_tensor(ov::element::i64, ov::Shape{1, 3, 2, 2}));
+    }
+    for (auto& request : requests) {
+        request.start_async();
+    }
+    for (auto& request : requests) {
+        OV_ASSERT_NO_THROW(request.wait());
+        // (x + 1) - 1, reshaped
+        auto output = request.get_output_tensor();
+        ASSERT_EQ(ov::Shape{12}, output.get_shape());
+        for (size_t i = 0; i < output.get_size(); i++)
+            EXPECT_EQ(static_cast<int64_t>(i), output.data<int64_t>()[i]);
+    }
+    EXPECT_EQ(0u, in_flight.load());
+    EXPECT_EQ(depth, max_in_flight.load());
+}
+
 TEST_F(HeteroTests, get_runtime_model) {
     ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1")};
     auto model = create_model_with_subtract_reshape();
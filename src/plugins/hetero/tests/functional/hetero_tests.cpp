@@ -306,6 +306,7 @@ public:
         : ov::ISyncInferRequest(compiled_model) {
         OPENVINO_ASSERT(compiled_model);
         m_model = compiled_model->get_model();
+        m_device_name = compiled_model->get_plugin()->get_device_name();
         // Allocate input/output tensors
         for (const auto& input : get_inputs()) {
             allocate_tensor(input, [this, input, compiled_model](ov::SoPtr<ov::ITensor>& tensor) {
@@ -331,6 +332,8 @@ public:
     ~MockInferRequest() = default;
 
     void infer() override {
+        if (ov::hetero::tests::HeteroTests::on_infer)
+            ov::hetero::tests::HeteroTests::on_infer(m_device_name);
         ov::TensorVector input_tensors;
         for (const auto& input : get_inputs()) {
             input_tensors.emplace_back(ov::make_tensor(get_tensor(input)));
@@ -365,6 +368,7 @@ private:
         }
     }
     std::shared_ptr<const ov::Model> m_model;
+    std::string m_device_name;
 };
 
 std::shared_ptr<ov::ISyncInferRequest> MockCompiledModel::create_sync_infer_request() const {
@@ -906,6 +910,8 @@ void ov::hetero::tests::HeteroTests::reg_plugin_type(const std::string& device_n
     reg_plugin(plugin);
 }
 
+std::function<void(const std::string&)> ov::hetero::tests::HeteroTests::on_infer;
+
 void ov::hetero::tests::HeteroTests::SetUp() {
     if (m_mock_plugins.empty()) {
         reg_plugin_type<MockPluginReshape>("MOCK0");
@@ -915,6 +921,7 @@ void ov::hetero::tests::HeteroTests::SetUp() {
 }
 
 void ov::hetero::tests::HeteroTests::TearDown() {
+    on_infer = nullptr;
     for (const auto& plugin : m_mock_plugins) {
         try {
             core.unload_plugin(plugin->get_device_name());
@@ -5,6 +5,7 @@
 
 #include <gtest/gtest.h>
 
+#include <functional>
 #include <memory>
 
 #include "common_test_utils/test_assertions.hpp"
@@ -19,6 +20,9 @@ class HeteroTests : public ::testing::Test {
 public:
     ov::Core core;
 
+    // called by the mock infer requests before the inference, gets the device name of the request
+    static std::function<void(const std::string&)> on_infer;
+
     void SetUp() override;
     void TearDown() override;
 
@@ -176,6 +176,35 @@ TEST_F(HeteroTests, query_model_by_two_device) {
         }
     }
 }
+
+TEST_F(HeteroTests, query_model_pipeline_parallel_by_cost) {
+    const std::string dev_name0 = "MOCK0.0";
+    const std::string dev_name1 = "MOCK0.1";
+    std::set<ov::hint::ModelDistributionPolicy> model_policy = {ov::hint::ModelDistributionPolicy::PIPELINE_PARALLEL};
+
+    // This WA is needed because mock plugins are loaded one by one
+    EXPECT_NO_THROW(core.get_available_devices());
+    const auto model = create_model_with_multi_add();
+    const auto supported_ops = core.query_model(
+        model,
+        ov::test::utils::DEVICE_HETERO,
+        {ov::device::priorities(dev_name0 + "," + dev_name1), ov::hint::model_distribution_policy(model_policy)});
+    std::map<std::string, std::string> expect_result = {{"input", dev_name0},
+                                                        {"const_val1", dev_name0},
+                                                        {"const_val2", dev_name0},
+                                                        {"add1", dev_name0},
+                                                        {"add2", dev_name0},
+                                                        {"const_val3", dev_name1},
+                                                        {"add3", dev_name1},
+                                                        {"const_val4", dev_name1},
+                                                        {"add4", dev_name1},
+                                                        {"res", dev_name1}};
+    EXPECT_EQ(expect_result.size(), supported_ops.size());
+    for (const auto& op : supported_ops) {
+        ASSERT_TRUE(expect_result.count(op.first));
+        EXPECT_EQ(op.second, expect_result[op.first]);
+    }
+}
 }  // namespace tests
 }  // namespace hetero
 }  // namespace ov
\ No newline at end of file
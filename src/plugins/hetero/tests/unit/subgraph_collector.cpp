@@ -609,4 +609,38 @@ TEST_F(SubgraphCollectorTest, merge_independent_submodel) {
     OV_ASSERT_NO_THROW(
         ov::hetero::merge_submodels(actual_submodels, actual_mapping_info._submodels_input_to_prev_output));
     ASSERT_EQ(1, actual_submodels.size());
-}
\ No newline at end of file
+}
+
+TEST(SplitModelByCostTest, balanced_stages) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 64});
+    param->set_friendly_name("input");
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    relu->set_friendly_name("relu");
+    auto weights1 = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{64, 64}, {1});
+    weights1->set_friendly_name("weights1");
+    auto matmul1 = std::make_shared<ov::op::v0::MatMul>(relu, weights1);
+    matmul1->set_friendly_name("matmul1");
+    auto weights2 = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{64, 64}, {1});
+    weights2->set_friendly_name("weights2");
+    auto matmul2 = std::make_shared<ov::op::v0::MatMul>(matmul1, weights2);
+    matmul2->set_friendly_name("matmul2");
+    auto result = std::make_shared<ov::op::v0::Result>(matmul2);
+    result->set_friendly_name("res");
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+
+    EXPECT_GT(estimate_node_cost(matmul1), estimate_node_cost(relu));
+    EXPECT_EQ(0.0, estimate_node_cost(weights1));
+
+    const std::map<std::string, size_t> expected_stages = {{"input", 0},
+                                                           {"relu", 0},
+                                                           {"weights1", 0},
+                                                           {"matmul1", 0},
+                                                           {"weights2", 1},
+                                                           {"matmul2", 1},
+                                                           {"res", 1}};
+    EXPECT_EQ(expected_stages, split_model_by_cost(model, 2));
+
+    for (const auto& stage : split_model_by_cost(model, 1)) {
+        EXPECT_EQ(0, stage.second);
+    }
+}
@@ -53,3 +53,8 @@ void ov::intel_cpu::AsyncInferRequest::setSubInferRequest(
 void ov::intel_cpu::AsyncInferRequest::infer() {
     m_infer_func();
 }
+
+bool ov::intel_cpu::AsyncInferRequest::is_batch_startable() const {
+    // only infer() is customized, the pipelines run the sync request as is
+    return true;
+}
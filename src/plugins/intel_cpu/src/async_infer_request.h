@@ -43,6 +43,9 @@ public:
     std::shared_ptr<IInferRequest> m_internal_request;
     std::shared_ptr<ov::threading::IStreamsExecutor> m_stream_executor;
     std::function<void()> m_infer_func;
+
+protected:
+    [[nodiscard]] bool is_batch_startable() const override;
 };
 
 }  // namespace ov::intel_cpu
@@ -59,6 +59,19 @@ struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
     std::mutex _mutex;
 };
 
+// Submits the tasks with the model priority, so the pending requests of high priority models are started before
+// the ones of low priority models sharing the same streams executor (e.g. with exclusive async requests)
+struct PriorityStreamsExecutor : public ov::threading::ITaskExecutor {
+    PriorityStreamsExecutor(std::shared_ptr<IStreamsExecutor> executor, ov::hint::Priority priority)
+        : _executor(std::move(executor)),
+          _priority(priority) {}
+    void run(ov::threading::Task task) override {
+        _executor->run(std::move(task), _priority);
+    }
+    std::shared_ptr<IStreamsExecutor> _executor;
+    ov::hint::Priority _priority;
+};
+
 CompiledModel::~CompiledModel() {
     if (m_has_sub_compiled_models) {
         m_sub_compiled_models.clear();
@@ -117,6 +130,13 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
 
     m_optimized_single_stream = all_of(1, executor_config.get_streams(), executor_config.get_threads());
 
+    m_request_executor = m_task_executor;
+    // the optimized single stream executes requests in the caller thread, so there is nothing to reorder
+    auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
+    if (streamsExecutor && m_cfg.modelPriority != ov::hint::Priority::DEFAULT && !m_optimized_single_stream) {
+        m_request_executor = std::make_shared<PriorityStreamsExecutor>(streamsExecutor, m_cfg.modelPriority);
+    }
+
     int streams = std::max(1, executor_config.get_streams());
     std::vector<Task> tasks;
     tasks.resize(streams);
@@ -236,7 +256,7 @@ std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() co
     auto internal_request = create_sync_infer_request();
     auto async_infer_request =
         std::make_shared<AsyncInferRequest>(std::static_pointer_cast<SyncInferRequest>(internal_request),
-                                            get_task_executor(),
+                                            m_request_executor,
                                             get_callback_executor(),
                                             m_optimized_single_stream);
     if (m_has_sub_compiled_models) {
@@ -294,12 +314,14 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
             RO_property(ov::hint::enable_cpu_pinning.name()),
             RO_property(ov::hint::enable_cpu_reservation.name()),
             RO_property(ov::hint::scheduling_core_type.name()),
+            RO_property(ov::hint::model_priority.name()),
             RO_property(ov::hint::model_distribution_policy.name()),
             RO_property(ov::hint::enable_hyper_threading.name()),
             RO_property(ov::execution_devices.name()),
             RO_property(ov::intel_cpu::denormals_optimization.name()),
             RO_property(ov::log::level.name()),
             RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+            RO_property(ov::intel_cpu::sparse_float_weights_rate.name()),
             RO_property(ov::intel_cpu::enable_tensor_parallel.name()),
             RO_property(ov::intel_cpu::tbb_partitioner.name()),
             RO_property(ov::hint::dynamic_quantization_group_size.name()),
@@ -355,6 +377,9 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         const auto stream_mode = config.schedulingCoreType;
         return stream_mode;
     }
+    if (name == ov::hint::model_priority) {
+        return config.modelPriority;
+    }
     if (name == ov::hint::model_distribution_policy) {
         const auto& distribution_policy = config.modelDistributionPolicy;
         return distribution_policy;
@@ -380,6 +405,10 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         return static_cast<decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type>(
             config.fcSparseWeiDecompressionRate);
     }
+    if (name == ov::intel_cpu::sparse_float_weights_rate) {
+        return static_cast<decltype(ov::intel_cpu::sparse_float_weights_rate)::value_type>(
+            config.fcSparseFloatWeightsRate);
+    }
     if (name == ov::intel_cpu::enable_tensor_parallel) {
         const auto& enable_tensor_parallel = config.enableTensorParallel;
         return enable_tensor_parallel;
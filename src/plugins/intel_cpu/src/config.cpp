@@ -149,6 +149,16 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                ov::hint::scheduling_core_type.name(),
                                ". Expected only ov::hint::SchedulingCoreType::ANY_CORE/PCORE_ONLY/ECORE_ONLY");
             }
+        } else if (key == ov::hint::model_priority.name()) {
+            try {
+                modelPriority = val.as<ov::hint::Priority>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::hint::model_priority.name(),
+                               ". Expected only ov::hint::Priority::LOW/MEDIUM/HIGH");
+            }
         } else if (key == ov::hint::model_distribution_policy.name()) {
             auto error_info = [&]() {
                 OPENVINO_THROW("Wrong value ",
@@ -193,6 +203,20 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                             ov::intel_cpu::sparse_weights_decompression_rate.name(),
                             ". Sparse rate must be in range [0.0f,1.0f]");
             fcSparseWeiDecompressionRate = val_f;
+        } else if (key == ov::intel_cpu::sparse_float_weights_rate.name()) {
+            float val_f = 0.0F;
+            try {
+                val_f = val.as<float>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ",
+                               ov::intel_cpu::sparse_float_weights_rate.name(),
+                               ". Expected only float numbers");
+            }
+            OPENVINO_ASSERT(val_f >= 0.F && val_f <= 1.F,
+                            "Wrong value for property key ",
+                            ov::intel_cpu::sparse_float_weights_rate.name(),
+                            ". Sparse rate must be in range [0.0f,1.0f]");
+            fcSparseFloatWeightsRate = val_f;
         } else if (key == ov::intel_cpu::tbb_partitioner.name()) {
             try {
                 tbbPartitioner = val.as<ov::intel_cpu::TbbPartitioner>();
@@ -70,6 +70,10 @@ public:
     [[nodiscard]] R parallel_sum(const T0& D0, const R& input, const F& func) const {
         return cpu_parallel_sum(D0, input, func);
     }
+    template <typename I, typename F>
+    void parallel_sort(I begin, I end, const F& comparator) const {
+        ov::parallel_sort(begin, end, comparator);
+    }
     template <typename T0, typename F>
     void parallel_for(const T0& D0, const F& func) const {
         cpu_parallel_for(D0, func);
@@ -1326,6 +1326,9 @@ void Graph::PullOutputData(std::unordered_map<std::size_t, ov::SoPtr<ITensor>>&
             continue;
         }
 
+        // the residual copy is reported as the execution of the output node, so zero-copy outputs stay NOT_RUN
+        PERF(node, getConfig().collectPerfCounters);
+
         auto externDesc = MemoryDescUtils::generateCpuBlockedMemoryDesc(ext_blob);
         auto actualDesc = intr_blob.getDescWithType<BlockedMemoryDesc>();
         if (actualDesc->getPrecision() == element::string) {
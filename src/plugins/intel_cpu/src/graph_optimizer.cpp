@@ -43,6 +43,7 @@
 #include "nodes/interpolate.h"
 #include "nodes/memory.hpp"
 #include "nodes/memory_state_base.h"
+#include "nodes/non_max_suppression.h"
 #include "nodes/reorder.h"
 #include "nodes/reshape.h"
 #include "nodes/rnn.h"
@@ -107,6 +108,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph& graph) {
     FuseMultiplyAndAdd(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseColorConvertAndSimpleOperation");
+    FuseColorConvertAndSimpleOperation(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "MergeConvertAndEltwise");
     MergeConvertAndEltwise(graph);
     graph.RemoveDroppedNodes();
@@ -191,6 +196,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph& graph) {
     FuseGatherAndConvert(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseSigmoidAndNonMaxSuppression");
+    FuseSigmoidAndNonMaxSuppression(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEltwiseAndSimple");
     FuseEltwiseAndSimple(graph);
     graph.RemoveDroppedNodes();
@@ -1901,6 +1910,78 @@ void GraphOptimizer::FuseGatherAndConvert(Graph& graph) {
     }
 }
 
+void GraphOptimizer::FuseSigmoidAndNonMaxSuppression(Graph& graph) {
+    // Detection models apply Sigmoid to the scores of all anchors, although only a small part of them pass the score
+    // threshold of NMS. NMS applies the activation itself to the scores passing the threshold in the logit space.
+    const auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableSigmoid = [](const NodePtr& node) {
+        return node->getType() == Type::Eltwise && node->getAlgorithm() == Algorithm::EltwiseSigmoid &&
+               node->getParentEdges().size() == 1 && node->getChildEdges().size() == 1 &&
+               node->getFusedWith().empty() && !node->isConstant() &&
+               node->getOriginalOutputPrecisionAtPort(0) == ov::element::f32;
+    };
+
+    for (const auto& node : graphNodes) {
+        if (node->getType() != Type::NonMaxSuppression) {
+            continue;
+        }
+        auto nms = std::dynamic_pointer_cast<node::NonMaxSuppression>(node);
+        const auto sigmoid = nms->getParentEdgeAt(1)->getParent();  // scores
+        if (!isSuitableSigmoid(sigmoid)) {
+            continue;
+        }
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseSigmoidAndNonMaxSuppression);
+
+        nms->fuseScoresSigmoid();
+        nms->addOriginalLayer(sigmoid->getOriginalLayers());
+        graph.DropNode(sigmoid);
+    }
+}
+
+void GraphOptimizer::FuseColorConvertAndSimpleOperation(Graph& graph) {
+    const auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableParentNode = [](const NodePtr& node) {
+        return node->getType() == Type::ColorConvert && node->getChildEdges().size() == 1;
+    };
+
+    auto parent = graphNodes.begin();
+    while (parent != graphNodes.end()) {
+        auto parentNode = *parent;
+        if (!isSuitableParentNode(parentNode)) {
+            parent++;
+            continue;
+        }
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseColorConvertAndSimpleOperation);
+
+        // u8 -> f32 Convert is fused first, then the mean / scale Eltwise chain following it
+        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+        if (!parentNode->canFuse(childNode)) {
+            parent++;
+            continue;
+        }
+
+        childNode->fuseInto(parentNode);
+
+        if (childNode->getType() == Type::Eltwise) {
+            auto parentEdges = childNode->parentEdges;
+            for (auto& parentEdge : parentEdges) {
+                auto p_edge = parentEdge.lock();
+                if (p_edge->getParent()->getType() == Type::ColorConvert) {
+                    continue;
+                }
+
+                graph.RemoveEdge(p_edge);
+            }
+        }
+
+        graph.DropNode(childNode);
+    }
+}
+
 void GraphOptimizer::FuseInterpolateAndSimpleOperation(Graph& graph) {
     const auto& graphNodes = graph.GetNodes();
 
@@ -36,10 +36,12 @@ private:
     static void FusePoolingAndFakeQuantize(Graph& graph);
     static void FuseConvolutionSumAndConvolutionSumActivation(Graph& graph);
     static void FuseMVNAndSimpleOperation(Graph& graph);
+    static void FuseColorConvertAndSimpleOperation(Graph& graph);
     static void FuseInterpolateAndSimpleOperation(Graph& graph);
     static void FuseNormalizeL2AndSimpleOperation(Graph& graph);
     static void FuseReduceAndSimpleOperation(Graph& graph);
     static void FuseGatherAndConvert(Graph& graph);
+    static void FuseSigmoidAndNonMaxSuppression(Graph& graph);
 
     static void DropDoubleReorders(Graph& graph);
     static void FuseConvolutionAndZeroPoints(Graph& graph);
@@ -4,6 +4,7 @@
 
 #include "infer_request.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <exception>
 #include <functional>
@@ -250,11 +251,15 @@ void SyncInferRequest::change_default_ptr(Graph& graph) {
         auto parent_port = parentEdge->getInputNum();
         do {
             previousParent = parent;
-            if (parent->getChildEdgesAtPort(parent_port).size() != 1 || parent->isConstant()) {
+            if (parent->isConstant()) {
                 canBeInPlace = false;
                 break;
             }
-            if (parent->getChildEdgeAt(parent_port)->inPlace(Edge::LOOK_UP)) {
+            // the output memory may be shared with other consumers as long as none of them writes into it
+            const auto childEdges = parent->getChildEdgesAtPort(parent_port);
+            if (std::any_of(childEdges.begin(), childEdges.end(), [](const EdgePtr& edge) {
+                    return edge->inPlace(Edge::LOOK_UP) || edge->modifiedInPlace();
+                })) {
                 canBeInPlace = false;
                 break;
             }
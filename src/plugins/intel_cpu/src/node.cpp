@@ -41,6 +41,7 @@
 #include "onednn/iml_type_mapper.h"
 #include "openvino/cc/factory.h"
 #include "openvino/core/except.hpp"
+#include "openvino/core/memory_util.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/shape.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -1157,6 +1158,8 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr dstWeightDesc, DnnlMemoryD
                                    *_ptr,
                                    context->getParamsCache(),
                                    context->getCpuParallel()->get_thread_pool());
+        // the original weights are not read anymore, drop their pages if they are mapped from the model file
+        ov::util::release_mapped_memory(edgeMem->getData(), edgeMem->getSize());
 
         return _ptr;
     };
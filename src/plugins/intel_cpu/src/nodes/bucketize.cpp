@@ -27,6 +27,7 @@
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/op/bucketize.hpp"
 #include "utils/general_utils.h"
+#include "utils/sorted_search.hpp"
 
 namespace ov::intel_cpu::node {
 
@@ -239,14 +240,14 @@ void Bucketize::bucketize() {
     }
 
     // boundaries are assumed to be sorted and to have unique elements
-    cpu_parallel->parallel_for(num_values, [&](size_t ind) {
-        T value = input_data[ind];
+    const size_t chunks = div_up(num_values, VALUES_CHUNK);
+    cpu_parallel->parallel_for(chunks, [&](size_t chunk) {
+        const size_t start = chunk * VALUES_CHUNK;
+        const size_t num = std::min(VALUES_CHUNK, num_values - start);
         if (with_right) {
-            const auto* low = std::lower_bound(boundaries_data, boundaries_data + num_bin_values, value);
-            output_data[ind] = static_cast<T_IND>(low - boundaries_data);
+            sorted_rank_range<false>(boundaries_data, num_bin_values, input_data + start, num, output_data + start);
         } else {
-            const auto* up = std::upper_bound(boundaries_data, boundaries_data + num_bin_values, value);
-            output_data[ind] = static_cast<T_IND>(up - boundaries_data);
+            sorted_rank_range<true>(boundaries_data, num_bin_values, input_data + start, num, output_data + start);
         }
     });
 }
@@ -47,6 +47,9 @@ private:
     bool with_right = false;
     bool with_bins = false;
 
+    // number of values bucketized by one task
+    static constexpr size_t VALUES_CHUNK = 256;
+
     ov::element::Type input_precision;
     ov::element::Type boundaries_precision;
     ov::element::Type output_precision;
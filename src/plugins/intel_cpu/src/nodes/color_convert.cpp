@@ -5,6 +5,7 @@
 #include "color_convert.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cpu/x64/cpu_isa_traits.hpp>
 #include <cstddef>
@@ -25,12 +26,14 @@
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
+#include "nodes/eltwise.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/parallel.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "shape_inference/custom/color_convert.hpp"
+#include "utils/general_utils.h"
 
 #if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
 #    include <xbyak/xbyak.h>
@@ -74,8 +77,9 @@ public:
 
     [[nodiscard]] bool singlePlane() const;
 
-    template <typename T>
-    std::tuple<T, T, T> yuv_to_rgb(float y, float u, float v);
+    // T defines rounding of the result, TOut is the type it is stored in (differs if Convert is fused)
+    template <typename T, typename TOut = T>
+    std::tuple<TOut, TOut, TOut> yuv_to_rgb(float y, float u, float v);
 };
 
 Converter::Converter(Node* node)
@@ -89,16 +93,16 @@ bool Converter::singlePlane() const {
     return _node->getOriginalInputsNumber() == 1;
 }
 
-template <typename T>
-std::tuple<T, T, T> Converter::yuv_to_rgb(float y, float u, float v) {
+template <typename T, typename TOut>
+std::tuple<TOut, TOut, TOut> Converter::yuv_to_rgb(float y, float u, float v) {
     auto c = y - 16.F;
     auto d = u - 128.F;
     auto e = v - 128.F;
-    auto clip = [](float a) -> T {
+    auto clip = [](float a) -> TOut {
         if (std::is_integral<T>()) {
-            return static_cast<T>(std::min(std::max(std::round(a), 0.F), 255.F));
+            return static_cast<TOut>(std::min(std::max(std::round(a), 0.F), 255.F));
         }
-        return static_cast<T>(std::min(std::max(a, 0.F), 255.F));
+        return static_cast<TOut>(std::min(std::max(a, 0.F), 255.F));
     };
     auto r = clip(1.164F * c + 1.596F * e);
     auto g = clip(1.164F * c - 0.391F * d - 0.813F * e);
@@ -116,7 +120,9 @@ struct jit_uni_converter : public jit_kernel {
         const void* v;
         void* dst;
         size_t width;
-        uint8_t colorFormat;  // RGB: 0, BGR: !=0
+        uint8_t colorFormat;   // RGB: 0, BGR: !=0
+        const float* scales;  // interleaved per channel scales of the fused Eltwise nodes
+        const float* shifts;  // interleaved per channel shifts of the fused Eltwise nodes
     };
 
     using function_t = void (*)(const Params*);
@@ -142,6 +148,12 @@ protected:
                     const variable<float[N]>& b,
                     const variable<float[N]>& c,
                     const variable<size_t>& size);
+    template <size_t N>
+    void scale_shift(const variable<float[N]>& a,
+                     const variable<float[N]>& b,
+                     const variable<float[N]>& c,
+                     const variable<const float*>& scales,
+                     const variable<const float*>& shifts);
 
     function_t _fn = nullptr;
     variable<const float*> _consts;
@@ -298,6 +310,24 @@ void jit_uni_converter::store_tail(const variable<T*>& dst,
 
     copy<T>(ptr[dst], s.pointer(), copy_size);
 }
+
+template <size_t N>
+void jit_uni_converter::scale_shift(const variable<float[N]>& a,
+                                    const variable<float[N]>& b,
+                                    const variable<float[N]>& c,
+                                    const variable<const float*>& scales,
+                                    const variable<const float*>& shifts) {
+    // a, b, c hold 3 * N interleaved r,g,b values, scales and shifts are replicated with the same pattern
+    auto tmp = var<float[N]>();
+    size_t offset = 0;
+    for (const auto* vec : {&a, &b, &c}) {
+        uni_vmovups(tmp, ptr[scales + offset]);
+        uni_vmulps(*vec, *vec, tmp);
+        uni_vmovups(tmp, ptr[shifts + offset]);
+        uni_vaddps(*vec, *vec, tmp);
+        offset += N * sizeof(float);
+    }
+}
 #endif
 
 namespace nv12 {
@@ -307,20 +337,22 @@ ColorConvert::Converter::PrimitiveDescs supportedPrimitiveDescs(Node* node) {
 
     const ov::element::Type precision =
         node->getOriginalInputPrecisionAtPort(0) == ov::element::u8 ? ov::element::u8 : ov::element::f32;
+    // fused Convert and scale/shift produce f32 output right away
+    const ov::element::Type outPrecision = node->getFusedWith().empty() ? precision : ov::element::f32;
 
     ColorConvert::Converter::PrimitiveDescs descs;
 
     descs.emplace_back(std::vector<PortConfigurator>{node->getOriginalInputsNumber(), {layout, precision}},
-                       std::vector<PortConfigurator>{{layout, precision}},
+                       std::vector<PortConfigurator>{{layout, outPrecision}},
                        mayiuse(cpu_isa_t::sse41) ? impl_desc_type::jit_uni : impl_desc_type::ref,
                        true);
 
     return descs;
 }
 
-template <typename T, impl_desc_type I>
+template <typename T, impl_desc_type I, typename TOut = T>
 class SinglePlaneConvert;
-template <typename T, impl_desc_type I>
+template <typename T, impl_desc_type I, typename TOut = T>
 class TwoPlaneConvert;
 
 class RefConverter : public Converter {
@@ -328,10 +360,10 @@ public:
     explicit RefConverter(Node* node);
 
 protected:
-    template <typename T>
+    template <typename T, typename TOut>
     void convert(const T* y,
                  const T* uv,
-                 T* dst,
+                 TOut* dst,
                  size_t batch_size,
                  size_t height,
                  size_t width,
@@ -345,17 +377,19 @@ RefConverter::RefConverter(Node* node) : Converter(node) {
     OPENVINO_ASSERT(node->getOriginalOutputsNumber(), "NV12Converter node has incorrect number of outputs");
 }
 
-template <typename T>
+template <typename T, typename TOut>
 void RefConverter::convert(const T* y,
                            const T* uv,
-                           T* dst,
+                           TOut* dst,
                            size_t batch_size,
                            size_t height,
                            size_t width,
                            size_t stride_y,
                            size_t stride_uv) {
+    const float* scales = fusedScales();
+    const float* shifts = fusedShifts();
     ov::parallel_for2d(batch_size, height, [&](int batch, int h) {
-        T* out = dst + batch * width * height * 3;
+        TOut* out = dst + batch * width * height * 3;
         auto y_ptr = y + batch * stride_y;
         auto uv_ptr = uv + batch * stride_uv;
 
@@ -365,16 +399,21 @@ void RefConverter::convert(const T* y,
             auto uv_index = (h / 2) * width + (w / 2) * 2;
             auto u_val = static_cast<float>(uv_ptr[uv_index]);
             auto v_val = static_cast<float>(uv_ptr[uv_index + 1]);
-            auto [r, g, b] = yuv_to_rgb<T>(y_val, u_val, v_val);
+            auto [r, g, b] = yuv_to_rgb<T, TOut>(y_val, u_val, v_val);
             out[y_index * 3 + _colorFormat[0]] = r;
             out[y_index * 3 + _colorFormat[1]] = g;
             out[y_index * 3 + _colorFormat[2]] = b;
+            if constexpr (std::is_same_v<TOut, float>) {
+                for (size_t c = 0; c < 3; c++) {
+                    out[y_index * 3 + c] = out[y_index * 3 + c] * scales[c] + shifts[c];
+                }
+            }
         }
     });
 }
 
-template <typename T>
-class SinglePlaneConvert<T, impl_desc_type::ref> : public RefConverter {
+template <typename T, typename TOut>
+class SinglePlaneConvert<T, impl_desc_type::ref, TOut> : public RefConverter {
 public:
     using RefConverter::RefConverter;
 
@@ -387,14 +426,14 @@ public:
 
         const T* y = static_cast<const T*>(input(0));
         const T* uv = y + width * height;
-        T* dst = static_cast<T*>(output(0));
+        TOut* dst = static_cast<TOut*>(output(0));
 
-        convert<T>(y, uv, dst, batch_size, height, width, height * width * 3 / 2, height * width * 3 / 2);
+        convert<T, TOut>(y, uv, dst, batch_size, height, width, height * width * 3 / 2, height * width * 3 / 2);
     }
 };
 
-template <typename T>
-class TwoPlaneConvert<T, impl_desc_type::ref> : public RefConverter {
+template <typename T, typename TOut>
+class TwoPlaneConvert<T, impl_desc_type::ref, TOut> : public RefConverter {
 public:
     using RefConverter::RefConverter;
 
@@ -403,22 +442,22 @@ public:
 
         const T* y = static_cast<const T*>(input(0));
         const T* uv = static_cast<const T*>(input(1));
-        T* dst = static_cast<T*>(output(0));
+        TOut* dst = static_cast<TOut*>(output(0));
 
         const size_t batch_size = dims[N_DIM];
         const size_t height = dims[H_DIM];
         const size_t width = dims[W_DIM];
 
-        convert<T>(y, uv, dst, batch_size, height, width, height * width, height * width / 2);
+        convert<T, TOut>(y, uv, dst, batch_size, height, width, height * width, height * width / 2);
     }
 };
 
 #if defined(OPENVINO_ARCH_X86_64)
-template <typename T>
+template <typename T, typename TOut = T>
 class JitConverter;
 
-template <typename T, size_t N>
-class JitConverter<T[N]> : public jit_uni_converter {
+template <typename T, size_t N, typename TOut>
+class JitConverter<T[N], TOut> : public jit_uni_converter {
 private:
     void generate() override;
     std::tuple<variable<float[N]>, variable<float[N]>, variable<float[N]>> load_yuv(const variable<const T*>& src_y,
@@ -426,22 +465,24 @@ private:
     std::tuple<variable<float[N]>, variable<float[N]>> unpack_uv(const variable<float[N]>& uv);
 };
 
-template <typename T, size_t N>
-void JitConverter<T[N]>::generate() {
+template <typename T, size_t N, typename TOut>
+void JitConverter<T[N], TOut>::generate() {
     preamble();
 
     // Get arguments addresses
     auto src_y = arg<const T*>(&Params::y);
     auto src_uv = arg<const T*>(&Params::u);
-    auto dst = arg<T*>(&Params::dst);
+    auto dst = arg<TOut*>(&Params::dst);
     auto width = arg(&Params::width);
     auto colorFormat = arg(&Params::colorFormat);
+    auto scales = arg<const float*>(&Params::scales);
+    auto shifts = arg<const float*>(&Params::shifts);
 
     static const float data[8] = {16.F, 128.F, 1.164F, 1.596F, 0.391F, 2.018F, 0.813F, 255.F};
     _consts = data;
 
     const auto reg_capacity_log = static_cast<size_t>(std::logb(N));
-    const size_t step = N * sizeof(T);
+    const size_t step = N * sizeof(TOut);
 
     width >>= reg_capacity_log;
 
@@ -454,6 +495,9 @@ void JitConverter<T[N]>::generate() {
         const auto& v = std::get<2>(yuv);
 
         yuv_to_rgb(y, u, v, colorFormat, std::is_integral_v<T>);
+        if constexpr (std::is_same_v<TOut, float>) {
+            scale_shift(y, u, v, scales, shifts);
+        }
 
         store(dst, y);
         dst += step;
@@ -481,6 +525,9 @@ void JitConverter<T[N]>::generate() {
         const auto& v = std::get<1>(uv_pair);
 
         yuv_to_rgb(y, u, v, colorFormat, std::is_integral_v<T>);
+        if constexpr (std::is_same_v<TOut, float>) {
+            scale_shift(y, u, v, scales, shifts);
+        }
 
         store_tail(dst, y, u, v, width);
     });
@@ -488,9 +535,9 @@ void JitConverter<T[N]>::generate() {
     postamble();
 }
 
-template <typename T, size_t N>
+template <typename T, size_t N, typename TOut>
 std::tuple<jit_kernel::variable<float[N]>, jit_kernel::variable<float[N]>, jit_kernel::variable<float[N]>>
-JitConverter<T[N]>::load_yuv(const variable<const T*>& src_y, const variable<const T*>& src_uv) {
+JitConverter<T[N], TOut>::load_yuv(const variable<const T*>& src_y, const variable<const T*>& src_uv) {
     auto y = var<float[N]>();
     auto uv = var<float[N]>();
 
@@ -505,8 +552,8 @@ JitConverter<T[N]>::load_yuv(const variable<const T*>& src_y, const variable<con
     return std::make_tuple(std::move(y), std::move(std::get<0>(uv_pair)), std::move(std::get<1>(uv_pair)));
 }
 
-template <typename T, size_t N>
-std::tuple<jit_kernel::variable<float[N]>, jit_kernel::variable<float[N]>> JitConverter<T[N]>::unpack_uv(
+template <typename T, size_t N, typename TOut>
+std::tuple<jit_kernel::variable<float[N]>, jit_kernel::variable<float[N]>> JitConverter<T[N], TOut>::unpack_uv(
     const variable<float[N]>& uv) {
     auto u = var<float[N]>();
     auto v = var<float[N]>();
@@ -520,21 +567,21 @@ std::tuple<jit_kernel::variable<float[N]>, jit_kernel::variable<float[N]>> JitCo
     return std::make_tuple(std::move(u), std::move(v));
 }
 
-template <typename T>
+template <typename T, typename TOut = T>
 const jit_uni_converter& jit_converter_create() {
     auto createKernel = []() {
         std::unique_ptr<jit_uni_converter> kernel;
 
         if (mayiuse(cpu_isa_t::avx512_core)) {
-            auto converter = new JitConverter<T[16]>;
+            auto converter = new JitConverter<T[16], TOut>;
             kernel.reset(converter);
             converter->init();
         } else if (mayiuse(cpu_isa_t::avx2)) {
-            auto converter = new JitConverter<T[8]>;
+            auto converter = new JitConverter<T[8], TOut>;
             kernel.reset(converter);
             converter->init();
         } else if (mayiuse(cpu_isa_t::sse41)) {
-            auto converter = new JitConverter<T[4]>;
+            auto converter = new JitConverter<T[4], TOut>;
             kernel.reset(converter);
             converter->init();
         } else {
@@ -549,20 +596,20 @@ const jit_uni_converter& jit_converter_create() {
     return *kernel;
 }
 
-template <typename T>
+template <typename T, typename TOut = T>
 const jit_uni_converter& jit_converter_get() {
-    return jit_converter_create<T>();
+    return jit_converter_create<T, TOut>();
 }
 
-template <typename T>
-class SinglePlaneConvert<T, impl_desc_type::jit_uni> : public Converter {
+template <typename T, typename TOut>
+class SinglePlaneConvert<T, impl_desc_type::jit_uni, TOut> : public Converter {
 public:
     explicit SinglePlaneConvert(Node* node) : Converter(node) {
-        jit_converter_create<T>();
+        jit_converter_create<T, TOut>();
     }
 
     void execute([[maybe_unused]] const dnnl::stream& strm) override {
-        const auto& kernel = jit_converter_get<T>();
+        const auto& kernel = jit_converter_get<T, TOut>();
         const auto& dims = inputDims(0);
 
         const size_t batch_size = dims[N_DIM];
@@ -571,7 +618,7 @@ public:
 
         const T* y = static_cast<const T*>(input(0));
         const T* uv = y + width * height;
-        T* dst = static_cast<T*>(output(0));
+        TOut* dst = static_cast<TOut*>(output(0));
 
         const size_t stride_y = height * width * 3 / 2;
         const size_t stride_uv = height * width * 3 / 2;
@@ -584,21 +631,23 @@ public:
                 u_v,
                 dst + (batch * width * height + h * width) * 3,
                 width,
-                _colorFormat[0]};  // The first byte is enough to determine the RGB or BGR format.
+                _colorFormat[0],  // The first byte is enough to determine the RGB or BGR format.
+                fusedScales(),
+                fusedShifts()};
             kernel(args);
         });
     }
 };
 
-template <typename T>
-class TwoPlaneConvert<T, impl_desc_type::jit_uni> : public Converter {
+template <typename T, typename TOut>
+class TwoPlaneConvert<T, impl_desc_type::jit_uni, TOut> : public Converter {
 public:
     explicit TwoPlaneConvert(Node* node) : Converter(node) {
-        jit_converter_create<T>();
+        jit_converter_create<T, TOut>();
     }
 
     void execute([[maybe_unused]] const dnnl::stream& strm) override {
-        const auto& kernel = jit_converter_get<T>();
+        const auto& kernel = jit_converter_get<T, TOut>();
         const auto& dims = inputDims(0);
 
         const size_t batch_size = dims[N_DIM];
@@ -607,7 +656,7 @@ public:
 
         const T* y = static_cast<const T*>(input(0));
         const T* uv = static_cast<const T*>(input(1));
-        T* dst = static_cast<T*>(output(0));
+        TOut* dst = static_cast<TOut*>(output(0));
 
         const size_t stride_y = height * width;
         const size_t stride_uv = height * width / 2;
@@ -620,8 +669,9 @@ public:
                 u_v,
                 dst + (batch * width * height + h * width) * 3,
                 width,
-                _colorFormat[0]  // The first byte is enough to determine the RGB or BGR format.
-            };
+                _colorFormat[0],  // The first byte is enough to determine the RGB or BGR format.
+                fusedScales(),
+                fusedShifts()};
             kernel(args);
         });
     }
@@ -636,20 +686,22 @@ ColorConvert::Converter::PrimitiveDescs supportedPrimitiveDescs(Node* node) {
 
     const ov::element::Type precision =
         node->getOriginalInputPrecisionAtPort(0) == ov::element::u8 ? ov::element::u8 : ov::element::f32;
+    // fused Convert and scale/shift produce f32 output right away
+    const ov::element::Type outPrecision = node->getFusedWith().empty() ? precision : ov::element::f32;
 
     ColorConvert::Converter::PrimitiveDescs descs;
 
     descs.emplace_back(std::vector<PortConfigurator>{node->getOriginalInputsNumber(), {layout, precision}},
-                       std::vector<PortConfigurator>{{layout, precision}},
+                       std::vector<PortConfigurator>{{layout, outPrecision}},
                        mayiuse(cpu_isa_t::sse41) ? impl_desc_type::jit_uni : impl_desc_type::ref,
                        true);
 
     return descs;
 }
 
-template <typename T, impl_desc_type I>
+template <typename T, impl_desc_type I, typename TOut = T>
 class SinglePlaneConvert;
-template <typename T, impl_desc_type I>
+template <typename T, impl_desc_type I, typename TOut = T>
 class ThreePlaneConvert;
 
 class RefConverter : public Converter {
@@ -657,11 +709,11 @@ public:
     explicit RefConverter(Node* node);
 
 protected:
-    template <typename T>
+    template <typename T, typename TOut>
     void convert(const T* y,
                  const T* u,
                  const T* v,
-                 T* dst,
+                 TOut* dst,
                  size_t batch_size,
                  size_t height,
                  size_t width,
@@ -675,18 +727,20 @@ RefConverter::RefConverter(Node* node) : Converter(node) {
     OPENVINO_ASSERT(node->getOriginalOutputsNumber(), "I420Converter node has incorrect number of outputs");
 }
 
-template <typename T>
+template <typename T, typename TOut>
 void RefConverter::convert(const T* y,
                            const T* u,
                            const T* v,
-                           T* dst,
+                           TOut* dst,
                            size_t batch_size,
                            size_t height,
                            size_t width,
                            size_t stride_y,
                            size_t stride_uv) {
+    const float* scales = fusedScales();
+    const float* shifts = fusedShifts();
     ov::parallel_for2d(batch_size, height, [&](int batch, int h) {
-        T* out = dst + batch * width * height * 3;
+        TOut* out = dst + batch * width * height * 3;
         auto y_ptr = y + batch * stride_y;
         auto u_ptr = u + batch * stride_uv;
         auto v_ptr = v + batch * stride_uv;
@@ -697,16 +751,21 @@ void RefConverter::convert(const T* y,
             auto uv_index = (h / 2) * (width / 2) + w / 2;
             auto u_val = static_cast<float>(u_ptr[uv_index]);
             auto v_val = static_cast<float>(v_ptr[uv_index]);
-            auto [r, g, b] = yuv_to_rgb<T>(y_val, u_val, v_val);
+            auto [r, g, b] = yuv_to_rgb<T, TOut>(y_val, u_val, v_val);
             out[y_index * 3 + _colorFormat[0]] = r;
             out[y_index * 3 + _colorFormat[1]] = g;
             out[y_index * 3 + _colorFormat[2]] = b;
+            if constexpr (std::is_same_v<TOut, float>) {
+                for (size_t c = 0; c < 3; c++) {
+                    out[y_index * 3 + c] = out[y_index * 3 + c] * scales[c] + shifts[c];
+                }
+            }
         }
     });
 }
 
-template <typename T>
-class SinglePlaneConvert<T, impl_desc_type::ref> : public RefConverter {
+template <typename T, typename TOut>
+class SinglePlaneConvert<T, impl_desc_type::ref, TOut> : public RefConverter {
 public:
     using RefConverter::RefConverter;
 
@@ -720,14 +779,14 @@ public:
         const T* y = static_cast<const T*>(input(0));
         const T* u = y + width * height;
         const T* v = y + 5 * width * height / 4;
-        T* dst = static_cast<T*>(output(0));
+        TOut* dst = static_cast<TOut*>(output(0));
 
-        convert<T>(y, u, v, dst, batch_size, height, width, height * width * 3 / 2, height * width * 3 / 2);
+        convert<T, TOut>(y, u, v, dst, batch_size, height, width, height * width * 3 / 2, height * width * 3 / 2);
     }
 };
 
-template <typename T>
-class ThreePlaneConvert<T, impl_desc_type::ref> : public RefConverter {
+template <typename T, typename TOut>
+class ThreePlaneConvert<T, impl_desc_type::ref, TOut> : public RefConverter {
 public:
     using RefConverter::RefConverter;
 
@@ -737,22 +796,22 @@ public:
         const T* y = static_cast<const T*>(input(0));
         const T* u = static_cast<const T*>(input(1));
         const T* v = static_cast<const T*>(input(2));
-        T* dst = static_cast<T*>(output(0));
+        TOut* dst = static_cast<TOut*>(output(0));
 
         const size_t batch_size = dims[N_DIM];
         const size_t height = dims[H_DIM];
         const size_t width = dims[W_DIM];
 
-        convert<T>(y, u, v, dst, batch_size, height, width, height * width, height * width / 4);
+        convert<T, TOut>(y, u, v, dst, batch_size, height, width, height * width, height * width / 4);
     }
 };
 
 #if defined(OPENVINO_ARCH_X86_64)
-template <typename T>
+template <typename T, typename TOut = T>
 class JitConverter;
 
-template <typename T, size_t N>
-class JitConverter<T[N]> : public jit_uni_converter {
+template <typename T, size_t N, typename TOut>
+class JitConverter<T[N], TOut> : public jit_uni_converter {
 private:
     void generate() override;
     std::tuple<variable<float[N]>, variable<float[N]>, variable<float[N]>> load_yuv(const variable<const T*>& src_y,
@@ -761,23 +820,25 @@ private:
     void unpack_uv(const variable<float[N]>& u, const variable<float[N]>& v);
 };
 
-template <typename T, size_t N>
-void JitConverter<T[N]>::generate() {
+template <typename T, size_t N, typename TOut>
+void JitConverter<T[N], TOut>::generate() {
     preamble();
 
     // Get arguments addresses
     auto src_y = arg<const T*>(&Params::y);
     auto src_u = arg<const T*>(&Params::u);
     auto src_v = arg<const T*>(&Params::v);
-    auto dst = arg<T*>(&Params::dst);
+    auto dst = arg<TOut*>(&Params::dst);
     auto width = arg(&Params::width);
     auto colorFormat = arg(&Params::colorFormat);
+    auto scales = arg<const float*>(&Params::scales);
+    auto shifts = arg<const float*>(&Params::shifts);
 
     static const float data[8] = {16.F, 128.F, 1.164F, 1.596F, 0.391F, 2.018F, 0.813F, 255.F};
     _consts = data;
 
     const auto reg_capacity_log = static_cast<size_t>(std::logb(N));
-    const size_t step = N * sizeof(T);
+    const size_t step = N * sizeof(TOut);
 
     width >>= reg_capacity_log;
 
@@ -790,6 +851,9 @@ void JitConverter<T[N]>::generate() {
         const auto& v = std::get<2>(yuv);
 
         yuv_to_rgb(y, u, v, colorFormat, std::is_integral_v<T>);
+        if constexpr (std::is_same_v<TOut, float>) {
+            scale_shift(y, u, v, scales, shifts);
+        }
 
         store(dst, y);
         dst += step;
@@ -817,6 +881,9 @@ void JitConverter<T[N]>::generate() {
         unpack_uv(u, v);
 
         yuv_to_rgb(y, u, v, colorFormat, std::is_integral_v<T>);
+        if constexpr (std::is_same_v<TOut, float>) {
+            scale_shift(y, u, v, scales, shifts);
+        }
 
         store_tail(dst, y, u, v, width);
     });
@@ -824,9 +891,9 @@ void JitConverter<T[N]>::generate() {
     postamble();
 }
 
-template <typename T, size_t N>
+template <typename T, size_t N, typename TOut>
 std::tuple<jit_kernel::variable<float[N]>, jit_kernel::variable<float[N]>, jit_kernel::variable<float[N]>>
-JitConverter<T[N]>::load_yuv(const variable<const T*>& src_y,
+JitConverter<T[N], TOut>::load_yuv(const variable<const T*>& src_y,
                              const variable<const T*>& src_u,
                              const variable<const T*>& src_v) {
     auto y = var<float[N]>();
@@ -846,28 +913,28 @@ JitConverter<T[N]>::load_yuv(const variable<const T*>& src_y,
     return std::make_tuple(std::move(y), std::move(u), std::move(v));
 }
 
-template <typename T, size_t N>
-void JitConverter<T[N]>::unpack_uv(const variable<float[N]>& u, const variable<float[N]>& v) {
+template <typename T, size_t N, typename TOut>
+void JitConverter<T[N], TOut>::unpack_uv(const variable<float[N]>& u, const variable<float[N]>& v) {
     static const uint8_t order[] = {0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7};
     u = u.permute(order);
     v = v.permute(order);
 }
 
-template <typename T>
+template <typename T, typename TOut = T>
 const jit_uni_converter& jit_converter_create() {
     auto createKernel = []() {
         std::unique_ptr<jit_uni_converter> kernel;
 
         if (mayiuse(cpu_isa_t::avx512_core)) {
-            auto converter = new JitConverter<T[16]>;
+            auto converter = new JitConverter<T[16], TOut>;
             kernel.reset(converter);
             converter->init();
         } else if (mayiuse(cpu_isa_t::avx2)) {
-            auto converter = new JitConverter<T[8]>;
+            auto converter = new JitConverter<T[8], TOut>;
             kernel.reset(converter);
             converter->init();
         } else if (mayiuse(cpu_isa_t::sse41)) {
-            auto converter = new JitConverter<T[4]>;
+            auto converter = new JitConverter<T[4], TOut>;
             kernel.reset(converter);
             converter->init();
         } else {
@@ -882,20 +949,20 @@ const jit_uni_converter& jit_converter_create() {
     return *kernel;
 }
 
-template <typename T>
+template <typename T, typename TOut = T>
 const jit_uni_converter& jit_converter_get() {
-    return jit_converter_create<T>();
+    return jit_converter_create<T, TOut>();
 }
 
-template <typename T>
-class SinglePlaneConvert<T, impl_desc_type::jit_uni> : public Converter {
+template <typename T, typename TOut>
+class SinglePlaneConvert<T, impl_desc_type::jit_uni, TOut> : public Converter {
 public:
     explicit SinglePlaneConvert(Node* node) : Converter(node) {
-        jit_converter_create<T>();
+        jit_converter_create<T, TOut>();
     }
 
     void execute([[maybe_unused]] const dnnl::stream& strm) override {
-        const auto& kernel = jit_converter_get<T>();
+        const auto& kernel = jit_converter_get<T, TOut>();
         const auto& dims = inputDims(0);
 
         const size_t batch_size = dims[N_DIM];
@@ -905,7 +972,7 @@ public:
         const T* y = static_cast<const T*>(input(0));
         const T* u = y + width * height;
         const T* v = y + 5 * width * height / 4;
-        T* dst = static_cast<T*>(output(0));
+        TOut* dst = static_cast<TOut*>(output(0));
 
         const size_t stride_y = height * width * 3 / 2;
         const size_t stride_uv = height * width * 3 / 2;
@@ -917,28 +984,30 @@ public:
                 v + batch * stride_uv + (h / 2) * (width / 2),   // v
                 dst + (batch * width * height + h * width) * 3,  // dst
                 width,                                           // width
-                _colorFormat[0]                                  // colorFormat - RGB or BGR format
+                _colorFormat[0],                                 // colorFormat - RGB or BGR format
+                fusedScales(),                                   // scales
+                fusedShifts()                                    // shifts
             };
             kernel(args);
         });
     }
 };
 
-template <typename T>
-class ThreePlaneConvert<T, impl_desc_type::jit_uni> : public Converter {
+template <typename T, typename TOut>
+class ThreePlaneConvert<T, impl_desc_type::jit_uni, TOut> : public Converter {
 public:
     explicit ThreePlaneConvert(Node* node) : Converter(node) {
-        jit_converter_create<T>();
+        jit_converter_create<T, TOut>();
     }
 
     void execute([[maybe_unused]] const dnnl::stream& strm) override {
-        const auto& kernel = jit_converter_get<T>();
+        const auto& kernel = jit_converter_get<T, TOut>();
         const auto& dims = inputDims(0);
 
         const T* y = static_cast<const T*>(input(0));
         const T* u = static_cast<const T*>(input(1));
         const T* v = static_cast<const T*>(input(2));
-        T* dst = static_cast<T*>(output(0));
+        TOut* dst = static_cast<TOut*>(output(0));
 
         const size_t batch_size = dims[N_DIM];
         const size_t height = dims[H_DIM];
@@ -954,7 +1023,9 @@ public:
                 v + batch * stride_uv + (h / 2) * (width / 2),   // v
                 dst + (batch * width * height + h * width) * 3,  // dst
                 width,                                           // width
-                _colorFormat[0]                                  // colorFormat - RGB or BGR format
+                _colorFormat[0],                                 // colorFormat - RGB or BGR format
+                fusedScales(),                                   // scales
+                fusedShifts()                                    // shifts
             };
             kernel(args);
         });
@@ -989,6 +1060,14 @@ const VectorDims& ColorConvert::Converter::inputDims(size_t idx) const {
     return _node->getParentEdgeAt(idx)->getMemory().getStaticDims();
 }
 
+const float* ColorConvert::Converter::fusedScales() const {
+    return static_cast<const ColorConvert*>(_node)->_fusedScales.data();
+}
+
+const float* ColorConvert::Converter::fusedShifts() const {
+    return static_cast<const ColorConvert*>(_node)->_fusedShifts.data();
+}
+
 bool ColorConvert::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     Algorithm alg{};
     std::tie(alg, errorMessage) = getAlgorithmFor(op);
@@ -1040,56 +1119,76 @@ void ColorConvert::initSupportedPrimitiveDescriptors() {
 }
 
 void ColorConvert::initSupportedNV12Impls() {
-#define SUPPORTED_IMPL(Impl, type, desc_type)                         \
-    [](Node* node) {                                                  \
-        return new nv12::Impl<type, impl_desc_type::desc_type>(node); \
+#define SUPPORTED_IMPL(Impl, type, desc_type, out_type)                         \
+    [](Node* node) {                                                            \
+        return new nv12::Impl<type, impl_desc_type::desc_type, out_type>(node); \
     };
 
     // ref
     {
         auto& impls = _supportedImpls[impl_desc_type::ref][algorithm];
-        impls[ov::element::Type_t::u8][true] = SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, ref);
-        impls[ov::element::Type_t::u8][false] = SUPPORTED_IMPL(TwoPlaneConvert, uint8_t, ref);
-        impls[ov::element::Type_t::f32][true] = SUPPORTED_IMPL(SinglePlaneConvert, float, ref);
-        impls[ov::element::Type_t::f32][false] = SUPPORTED_IMPL(TwoPlaneConvert, float, ref);
+        auto& u8Impls = impls[ov::element::Type_t::u8];
+        u8Impls[ov::element::Type_t::u8][true] = SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, ref, uint8_t);
+        u8Impls[ov::element::Type_t::u8][false] = SUPPORTED_IMPL(TwoPlaneConvert, uint8_t, ref, uint8_t);
+        // fused Convert to f32 and scale/shift
+        u8Impls[ov::element::Type_t::f32][true] = SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, ref, float);
+        u8Impls[ov::element::Type_t::f32][false] = SUPPORTED_IMPL(TwoPlaneConvert, uint8_t, ref, float);
+        auto& f32Impls = impls[ov::element::Type_t::f32];
+        f32Impls[ov::element::Type_t::f32][true] = SUPPORTED_IMPL(SinglePlaneConvert, float, ref, float);
+        f32Impls[ov::element::Type_t::f32][false] = SUPPORTED_IMPL(TwoPlaneConvert, float, ref, float);
     }
 
 #if defined(OPENVINO_ARCH_X86_64)
     // jit_uni
     {
         auto& impls = _supportedImpls[impl_desc_type::jit_uni][algorithm];
-        impls[ov::element::Type_t::u8][true] = SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, jit_uni);
-        impls[ov::element::Type_t::u8][false] = SUPPORTED_IMPL(TwoPlaneConvert, uint8_t, jit_uni);
-        impls[ov::element::Type_t::f32][true] = SUPPORTED_IMPL(SinglePlaneConvert, float, jit_uni);
-        impls[ov::element::Type_t::f32][false] = SUPPORTED_IMPL(TwoPlaneConvert, float, jit_uni);
+        auto& u8Impls = impls[ov::element::Type_t::u8];
+        u8Impls[ov::element::Type_t::u8][true] = SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, jit_uni, uint8_t);
+        u8Impls[ov::element::Type_t::u8][false] = SUPPORTED_IMPL(TwoPlaneConvert, uint8_t, jit_uni, uint8_t);
+        // fused Convert to f32 and scale/shift
+        u8Impls[ov::element::Type_t::f32][true] = SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, jit_uni, float);
+        u8Impls[ov::element::Type_t::f32][false] = SUPPORTED_IMPL(TwoPlaneConvert, uint8_t, jit_uni, float);
+        auto& f32Impls = impls[ov::element::Type_t::f32];
+        f32Impls[ov::element::Type_t::f32][true] = SUPPORTED_IMPL(SinglePlaneConvert, float, jit_uni, float);
+        f32Impls[ov::element::Type_t::f32][false] = SUPPORTED_IMPL(TwoPlaneConvert, float, jit_uni, float);
     }
 #endif
 #undef SUPPORTED_IMPL
 }
 
 void ColorConvert::initSupportedI420Impls() {
-#define SUPPORTED_IMPL(Impl, type, desc_type)                         \
-    [](Node* node) {                                                  \
-        return new i420::Impl<type, impl_desc_type::desc_type>(node); \
+#define SUPPORTED_IMPL(Impl, type, desc_type, out_type)                         \
+    [](Node* node) {                                                            \
+        return new i420::Impl<type, impl_desc_type::desc_type, out_type>(node); \
     };
 
     // ref
     {
         auto& impls = _supportedImpls[impl_desc_type::ref][algorithm];
-        impls[ov::element::Type_t::u8][true] = SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, ref);
-        impls[ov::element::Type_t::u8][false] = SUPPORTED_IMPL(ThreePlaneConvert, uint8_t, ref);
-        impls[ov::element::Type_t::f32][true] = SUPPORTED_IMPL(SinglePlaneConvert, float, ref);
-        impls[ov::element::Type_t::f32][false] = SUPPORTED_IMPL(ThreePlaneConvert, float, ref);
+        auto& u8Impls = impls[ov::element::Type_t::u8];
+        u8Impls[ov::element::Type_t::u8][true] = SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, ref, uint8_t);
+        u8Impls[ov::element::Type_t::u8][false] = SUPPORTED_IMPL(ThreePlaneConvert, uint8_t, ref, uint8_t);
+        // fused Convert to f32 and scale/shift
+        u8Impls[ov::element::Type_t::f32][true] = SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, ref, float);
+        u8Impls[ov::element::Type_t::f32][false] = SUPPORTED_IMPL(ThreePlaneConvert, uint8_t, ref, float);
+        auto& f32Impls = impls[ov::element::Type_t::f32];
+        f32Impls[ov::element::Type_t::f32][true] = SUPPORTED_IMPL(SinglePlaneConvert, float, ref, float);
+        f32Impls[ov::element::Type_t::f32][false] = SUPPORTED_IMPL(ThreePlaneConvert, float, ref, float);
     }
 
 #if defined(OPENVINO_ARCH_X86_64)
     // jit_uni
     {
         auto& impls = _supportedImpls[impl_desc_type::jit_uni][algorithm];
-        impls[ov::element::Type_t::u8][true] = SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, jit_uni);
-        impls[ov::element::Type_t::u8][false] = SUPPORTED_IMPL(ThreePlaneConvert, uint8_t, jit_uni);
-        impls[ov::element::Type_t::f32][true] = SUPPORTED_IMPL(SinglePlaneConvert, float, jit_uni);
-        impls[ov::element::Type_t::f32][false] = SUPPORTED_IMPL(ThreePlaneConvert, float, jit_uni);
+        auto& u8Impls = impls[ov::element::Type_t::u8];
+        u8Impls[ov::element::Type_t::u8][true] = SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, jit_uni, uint8_t);
+        u8Impls[ov::element::Type_t::u8][false] = SUPPORTED_IMPL(ThreePlaneConvert, uint8_t, jit_uni, uint8_t);
+        // fused Convert to f32 and scale/shift
+        u8Impls[ov::element::Type_t::f32][true] = SUPPORTED_IMPL(SinglePlaneConvert, uint8_t, jit_uni, float);
+        u8Impls[ov::element::Type_t::f32][false] = SUPPORTED_IMPL(ThreePlaneConvert, uint8_t, jit_uni, float);
+        auto& f32Impls = impls[ov::element::Type_t::f32];
+        f32Impls[ov::element::Type_t::f32][true] = SUPPORTED_IMPL(SinglePlaneConvert, float, jit_uni, float);
+        f32Impls[ov::element::Type_t::f32][false] = SUPPORTED_IMPL(ThreePlaneConvert, float, jit_uni, float);
     }
 #endif
 #undef SUPPORTED_IMPL
@@ -1102,11 +1201,58 @@ void ColorConvert::createPrimitive() {
     if (!_impl) {
         const auto& cfg = desc->getConfig();
         const auto precision = cfg.inConfs[0].getMemDesc()->getPrecision();
+        const auto outPrecision = cfg.outConfs[0].getMemDesc()->getPrecision();
         const bool isSinglePlane = cfg.inConfs.size() == 1;
 
-        _impl = std::unique_ptr<Converter>(
-            _supportedImpls.at(desc->getImplementationType()).at(algorithm).at(precision).at(isSinglePlane)(this));
+        initFusedScaleShift();
+        _impl = std::unique_ptr<Converter>(_supportedImpls.at(desc->getImplementationType())
+                                               .at(algorithm)
+                                               .at(precision)
+                                               .at(outPrecision)
+                                               .at(isSinglePlane)(this));
+    }
+}
+
+void ColorConvert::initFusedScaleShift() {
+    std::array<float, 3> scales{1.F, 1.F, 1.F};
+    std::array<float, 3> shifts{0.F, 0.F, 0.F};
+    for (const auto& node : fusedWith) {
+        const auto* eltwise = dynamic_cast<const Eltwise*>(node.get());
+        if (!eltwise) {
+            continue;  // Convert
+        }
+        const auto& eltwiseScales = eltwise->getScales();
+        const auto& eltwiseShifts = eltwise->getShifts();
+        for (size_t c = 0; c < scales.size(); c++) {
+            const float scale = eltwiseScales.empty() ? 1.F : eltwiseScales[eltwiseScales.size() == 1 ? 0 : c];
+            const float shift = eltwiseShifts.empty() ? 0.F : eltwiseShifts[eltwiseShifts.size() == 1 ? 0 : c];
+            scales[c] *= scale;
+            shifts[c] = shifts[c] * scale + shift;
+        }
+    }
+    for (size_t i = 0; i < _fusedScales.size(); i++) {
+        _fusedScales[i] = scales[i % 3];
+        _fusedShifts[i] = shifts[i % 3];
+    }
+}
+
+bool ColorConvert::canFuse(const NodePtr& node) const {
+    const auto precision = getOriginalInputPrecisionAtPort(0);
+    if (none_of(precision, ov::element::u8, ov::element::f32)) {
+        return false;
+    }
+    // u8 output is converted to f32 first. The following per channel Eltwise nodes are folded into a single scale
+    // and shift, f32 output (the input is converted before the color conversion) takes them right away
+    if (precision == ov::element::u8 && fusedWith.empty()) {
+        return node->getType() == Type::Convert && node->getOriginalOutputPrecisionAtPort(0) == ov::element::f32;
     }
+    return node->getType() == Type::Eltwise && node->getAlgorithm() != Algorithm::EltwisePrelu &&
+           node->getParentEdgeAt(0)->getParent().get() == this &&
+           node->getOriginalOutputPrecisionAtPort(0) == ov::element::f32 && node->canBePerformedAsScaleShift(this);
+}
+
+int ColorConvert::getFusingAxis() const {
+    return 3;  // NHWC
 }
 
 void ColorConvert::execute(const dnnl::stream& strm) {
@@ -37,22 +37,30 @@ public:
     bool created() const override;
     bool needPrepareParams() const override;
     void executeDynamicImpl(const dnnl::stream& strm) override;
+    bool canFuse(const NodePtr& node) const override;
+    int getFusingAxis() const override;
 
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
 
 private:
     void initSupportedNV12Impls();
     void initSupportedI420Impls();
+    void initFusedScaleShift();
 
     using ConverterBuilder = std::function<Converter*(Node*)>;
     using SupportedImpls = multidim_map<impl_desc_type,       // Implementation type
                                         Algorithm,            // Algorithm: ColorConvertXXX
-                                        ov::element::Type_t,  // element type: f32/u8
+                                        ov::element::Type_t,  // input element type: f32/u8
+                                        ov::element::Type_t,  // output element type: f32/u8
                                         bool,  // true - SinglePlaneConvert, false - TwoPlaneConvert/ThreePlaneConvert
                                         ConverterBuilder>;
 
     std::unique_ptr<Converter> _impl;
     SupportedImpls _supportedImpls;
+    // Per channel scale and shift of the fused Eltwise nodes, replicated to cover 3 vectors of up to 16 interleaved
+    // RGB values, so that the jit kernel can apply them to the blended output registers directly
+    std::array<float, 48> _fusedScales{};
+    std::array<float, 48> _fusedShifts{};
 };
 
 class ColorConvert::Converter {
@@ -78,6 +86,8 @@ public:
     [[nodiscard]] const void* input(size_t idx) const;
     [[nodiscard]] void* output(size_t idx) const;
     [[nodiscard]] const VectorDims& inputDims(size_t idx) const;
+    [[nodiscard]] const float* fusedScales() const;
+    [[nodiscard]] const float* fusedShifts() const;
     virtual void execute(const dnnl::stream& strm) = 0;
 
 protected:
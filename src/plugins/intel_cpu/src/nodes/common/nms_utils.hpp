@@ -0,0 +1,178 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "openvino/core/parallel.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Box given by its corners, y coordinates go first as in the boxes of NMS operations.
+ */
+struct NmsBox {
+    float ymin = 0.0F;
+    float xmin = 0.0F;
+    float ymax = 0.0F;
+    float xmax = 0.0F;
+};
+
+/**
+ * @brief Collects indices of the scores passing the threshold.
+ *
+ * Scores are checked by blocks: blocks without passing scores, which are most of the blocks for typical thresholds
+ * of detection models, are skipped after a vectorized count, the rest are compacted without branches.
+ *
+ * @tparam inclusive  If true, scores equal to the threshold pass as well.
+ *
+ * @param scores     Scores of the boxes.
+ * @param num        Number of the boxes.
+ * @param threshold  Score threshold.
+ * @param indices    Indices of the passing boxes in ascending order.
+ */
+template <bool inclusive>
+inline void nms_filter_scores(const float* scores, size_t num, float threshold, std::vector<int32_t>& indices) {
+    constexpr size_t block = 16;
+    indices.resize(num);
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + block <= num; i += block) {
+        int passed = 0;
+        for (size_t j = 0; j < block; j++) {
+            passed += static_cast<int>(inclusive ? scores[i + j] >= threshold : scores[i + j] > threshold);
+        }
+        if (passed == 0) {
+            continue;
+        }
+        for (size_t j = i; j < i + block; j++) {
+            indices[count] = static_cast<int32_t>(j);
+            count += static_cast<size_t>(inclusive ? scores[j] >= threshold : scores[j] > threshold);
+        }
+    }
+    for (; i < num; i++) {
+        indices[count] = static_cast<int32_t>(i);
+        count += static_cast<size_t>(inclusive ? scores[i] >= threshold : scores[i] > threshold);
+    }
+    indices.resize(count);
+}
+
+/**
+ * @brief Boxes selected by the greedy NMS of one class, stored as a structure of arrays.
+ *
+ * A candidate is compared with all selected boxes by a loop without branches over the coordinate arrays, which the
+ * compiler vectorizes. The IoU is computed by the same expressions as the scalar IoU of the NMS nodes, so the
+ * selection doesn't change on the threshold boundary.
+ */
+class NmsSelectedBoxes {
+public:
+    /**
+     * @param norm  Value added to the box sides: 0 for normalized coordinates, 1 for the pixel ones.
+     */
+    explicit NmsSelectedBoxes(float norm = 0.0F) : m_norm(norm) {}
+
+    void reserve(size_t num) {
+        m_ymin.reserve(num);
+        m_xmin.reserve(num);
+        m_ymax.reserve(num);
+        m_xmax.reserve(num);
+        m_area.reserve(num);
+    }
+
+    [[nodiscard]] size_t size() const {
+        return m_area.size();
+    }
+
+    void push_back(const NmsBox& box) {
+        m_ymin.push_back(box.ymin);
+        m_xmin.push_back(box.xmin);
+        m_ymax.push_back(box.ymax);
+        m_xmax.push_back(box.xmax);
+        m_area.push_back(area(box));
+    }
+
+    /**
+     * @brief Checks whether the candidate has IoU not less than the threshold with any of the selected boxes
+     * starting from the given one.
+     *
+     * The latest selected boxes are checked first by blocks, so an overlapping box stops the search early.
+     */
+    [[nodiscard]] bool overlaps(const NmsBox& candidate, float threshold, size_t begin = 0) const {
+        constexpr size_t block = 16;
+        const float candidateArea = area(candidate);
+        size_t end = size();
+        for (; end >= begin + block; end -= block) {
+            int overlapped = 0;
+            for (size_t i = end - block; i < end; i++) {
+                overlapped |= static_cast<int>(iou(candidate, candidateArea, i) >= threshold);
+            }
+            if (overlapped != 0) {
+                return true;
+            }
+        }
+        for (size_t i = begin; i < end; i++) {
+            if (iou(candidate, candidateArea, i) >= threshold) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    [[nodiscard]] float area(const NmsBox& box) const {
+        return (box.ymax - box.ymin + m_norm) * (box.xmax - box.xmin + m_norm);
+    }
+
+    [[nodiscard]] float iou(const NmsBox& candidate, const float candidateArea, const size_t i) const {
+        const float height =
+            std::max(std::min(candidate.ymax, m_ymax[i]) - std::max(candidate.ymin, m_ymin[i]) + m_norm, 0.0F);
+        const float width =
+            std::max(std::min(candidate.xmax, m_xmax[i]) - std::max(candidate.xmin, m_xmin[i]) + m_norm, 0.0F);
+        const float intersection = height * width;
+        const float value = intersection / (candidateArea + m_area[i] - intersection);
+        return (candidateArea <= 0.0F || m_area[i] <= 0.0F) ? 0.0F : value;
+    }
+
+    float m_norm;
+    std::vector<float> m_ymin;
+    std::vector<float> m_xmin;
+    std::vector<float> m_ymax;
+    std::vector<float> m_xmax;
+    std::vector<float> m_area;
+};
+
+/**
+ * @brief Runs independent work items in parallel, splitting them between threads by their work amount.
+ *
+ * Number of candidates differs a lot between the classes of detection models, so splitting the classes by count
+ * leaves most of the threads waiting for the one processing the largest classes.
+ *
+ * @param work  Work amounts of the items, every amount must be positive.
+ * @param func  Function called with the index of every work item.
+ */
+template <class F>
+void nms_parallel_balanced(const std::vector<size_t>& work, const F& func) {
+    std::vector<size_t> workPrefix(work.size() + 1, 0);
+    for (size_t i = 0; i < work.size(); i++) {
+        workPrefix[i + 1] = workPrefix[i] + work[i];
+    }
+    // every amount is positive, so the bounds are unique and ranges of threads don't intersect
+    const auto itemsBound = [&](const int ithr, const int nthr) {
+        const size_t amount = workPrefix.back() * ithr / nthr;
+        return static_cast<size_t>(std::lower_bound(workPrefix.begin(), workPrefix.end(), amount) -
+                                   workPrefix.begin());
+    };
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        const size_t end = std::min(itemsBound(ithr + 1, nthr), work.size());
+        for (size_t i = itemsBound(ithr, nthr); i < end; i++) {
+            func(i);
+        }
+    });
+}
+
+}  // namespace ov::intel_cpu
@@ -4,6 +4,7 @@
 
 #include "embedding_bag.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
@@ -12,14 +13,53 @@
 
 #include "cpu_memory.h"
 #include "cpu_types.h"
+#include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/parallel.hpp"
+#include "openvino/core/type/bfloat16.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "utils/general_utils.h"
+
+#if defined(OPENVINO_ARCH_X86_64)
+#    include <cpu/x64/cpu_isa_traits.hpp>
+
+#    include "nodes/kernels/x64/embedding_bag.hpp"
+#endif  // OPENVINO_ARCH_X86_64
 
 namespace ov::intel_cpu::node {
 
+namespace {
+
+bool isJitSupported([[maybe_unused]] const ov::element::Type& precision) {
+#if defined(OPENVINO_ARCH_X86_64)
+    return any_of(precision, ov::element::f32, ov::element::bf16, ov::element::f16) &&
+           dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2);
+#else
+    return false;
+#endif  // OPENVINO_ARCH_X86_64
+}
+
+// Bag without per sample weights is reduced by the kernel compiled with weights using single unit weight,
+// such bags are empty bags replaced with the default index, so they have exactly one row
+const uint8_t* getUnitWeight(const ov::element::Type& precision) {
+    static const float f32One = 1.0F;
+    static const ov::bfloat16 bf16One{1.0F};
+    static const ov::float16 f16One{1.0F};
+    switch (precision) {
+    case ov::element::bf16:
+        return reinterpret_cast<const uint8_t*>(&bf16One);
+    case ov::element::f16:
+        return reinterpret_cast<const uint8_t*>(&f16One);
+    default:
+        return reinterpret_cast<const uint8_t*>(&f32One);
+    }
+}
+
+}  // namespace
+
 EmbeddingBag::EmbeddingBag(const std::shared_ptr<ov::Node>& op,
                            size_t requiredInputNum,
                            size_t indicesIdx,
@@ -43,11 +83,71 @@ EmbeddingBag::EmbeddingBag(const std::shared_ptr<ov::Node>& op,
     }
 }
 
-void EmbeddingBag::prepareParams(const VectorDims& indexStaticShape) {
+ov::element::Type EmbeddingBag::getTablePrecision(const ov::element::Type& originalPrecision) {
+    if (any_of(originalPrecision, ov::element::bf16, ov::element::f16) && !isJitSupported(originalPrecision)) {
+        return ov::element::f32;
+    }
+    return originalPrecision;
+}
+
+impl_desc_type EmbeddingBag::getImplType(const ov::element::Type& tablePrecision) {
+#if defined(OPENVINO_ARCH_X86_64)
+    if (isJitSupported(tablePrecision)) {
+        return dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core) ? impl_desc_type::jit_avx512
+                                                                                 : impl_desc_type::jit_avx2;
+    }
+#endif  // OPENVINO_ARCH_X86_64
+    return impl_desc_type::ref_any;
+}
+
+void EmbeddingBag::prepareParams(const VectorDims& indexStaticShape, const ov::element::Type& tablePrecision) {
     _embDepth = 1LU;
     for (size_t i = 1LU; i < indexStaticShape.size(); i++) {
         _embDepth *= indexStaticShape[i];
     }
+
+#if defined(OPENVINO_ARCH_X86_64)
+    if (!isJitSupported(tablePrecision) || (_kernel && _kernelEmbDepth == _embDepth)) {
+        return;
+    }
+    kernel::jit_embedding_bag_compile_params jcp;
+    jcp.prc = tablePrecision;
+    jcp.emb_depth = _embDepth;
+    jcp.with_weights = _withWeights;
+    jcp.mean = _reduction == Reduction::MEAN;
+    if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core)) {
+        _kernel = std::make_shared<kernel::jit_embedding_bag_kernel<dnnl::impl::cpu::x64::avx512_core>>(jcp);
+    } else {
+        _kernel = std::make_shared<kernel::jit_embedding_bag_kernel<dnnl::impl::cpu::x64::avx2>>(jcp);
+    }
+    _kernel->create_kernel();
+    _kernelEmbDepth = _embDepth;
+#endif  // OPENVINO_ARCH_X86_64
+}
+
+void EmbeddingBag::initBagsWork(size_t bagsNum) {
+    _bagsWork.resize(bagsNum + 1LU);
+    _bagsWork[0] = 0LU;
+
+    size_t indicesSize = 0LU;
+    const int* indices = nullptr;
+    int weightsIdx = 0;
+    bool withWeights = false;
+    for (size_t obi = 0LU; obi < bagsNum; obi++) {
+        getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+        // output row is written for empty bag as well
+        _bagsWork[obi + 1LU] = _bagsWork[obi] + (indices != nullptr ? indicesSize : 0LU) + 1LU;
+    }
+}
+
+void EmbeddingBag::getBagsRange(int ithr, int nthr, size_t& start, size_t& end) const {
+    // work of every bag is positive, so the bounds are unique and ranges of threads don't intersect
+    const auto bagsBound = [&](int thr) {
+        const size_t work = _bagsWork.back() * thr / nthr;
+        return static_cast<size_t>(std::lower_bound(_bagsWork.begin(), _bagsWork.end(), work) - _bagsWork.begin());
+    };
+    start = bagsBound(ithr);
+    end = bagsBound(ithr + 1);
 }
 
 template <typename T>
@@ -62,10 +162,12 @@ void EmbeddingBag::processData(const T* srcData,
     const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
     auto* dstData = outMemory->getDataAs<T>();
 
+    initBagsWork(outputBagsNum);
+
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0LU);
         size_t end(0LU);
-        splitter(outputBagsNum, nthr, ithr, start, end);
+        getBagsRange(ithr, nthr, start, end);
         if (start >= end) {
             return;
         }
@@ -84,7 +186,7 @@ void EmbeddingBag::processData(const T* srcData,
 
                 size_t inIdx = 0LU;
                 OPENVINO_ASSERT(static_cast<size_t>(indices[inIdx]) < inDataDims[0],
-                                msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
+                                msgPrefix + "has invalid embedding bag index: " + std::to_string(indices[inIdx]));
                 size_t srcIndex = indices[inIdx] * _embDepth;
 
                 if (withWeights) {
@@ -100,7 +202,7 @@ void EmbeddingBag::processData(const T* srcData,
 
                 for (inIdx = 1LU; inIdx < indicesSize; inIdx++) {
                     OPENVINO_ASSERT(static_cast<size_t>(indices[inIdx]) < inDataDims[0],
-                                    msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
+                                    msgPrefix + "has invalid embedding bag index: " + std::to_string(indices[inIdx]));
                     size_t srcIndex = indices[inIdx] * _embDepth;
 
                     if (withWeights) {
@@ -130,11 +232,68 @@ void EmbeddingBag::processData(const T* srcData,
     parallel_nt(0, threadBody);
 }
 
+void EmbeddingBag::processDataJit([[maybe_unused]] const uint8_t* srcData,
+                                  [[maybe_unused]] const uint8_t* weightsData,
+                                  [[maybe_unused]] const ov::element::Type& srcPrc,
+                                  [[maybe_unused]] const VectorDims& inDataDims,
+                                  [[maybe_unused]] const MemoryPtr& outMemory) {
+#if defined(OPENVINO_ARCH_X86_64)
+    std::string msgPrefix = std::string("Node EmbeddingBag with name '") + _layerName + "' ";
+    OPENVINO_ASSERT(_kernel && _kernelEmbDepth == _embDepth, msgPrefix, "has no compiled kernel.");
+
+    initFromInputs();
+
+    const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
+    const size_t rowSize = _embDepth * srcPrc.size();
+    auto* dstData = outMemory->getDataAs<uint8_t>();
+    const auto* unitWeight = getUnitWeight(srcPrc);
+
+    initBagsWork(outputBagsNum);
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start(0LU);
+        size_t end(0LU);
+        getBagsRange(ithr, nthr, start, end);
+
+        size_t indicesSize = 0LU;
+        const int* indices = nullptr;
+        int weightsIdx = 0;
+        bool withWeights = _withWeights;
+        kernel::jit_embedding_bag_call_args args{srcData, nullptr, unitWeight, nullptr, 0LU, 1.0F};
+
+        for (size_t obi = start; obi < end; obi++) {
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            if (indices == nullptr) {
+                indicesSize = 0LU;
+            }
+            for (size_t inIdx = 0LU; inIdx < indicesSize; inIdx++) {
+                OPENVINO_ASSERT(static_cast<size_t>(indices[inIdx]) < inDataDims[0],
+                                msgPrefix + "has invalid embedding bag index: " + std::to_string(indices[inIdx]));
+            }
+
+            args.indices = indices;
+            args.indices_num = indicesSize;
+            args.weights = withWeights && _withWeights ? weightsData + weightsIdx * srcPrc.size() : unitWeight;
+            args.dst = dstData + obi * rowSize;
+            if (_reduction == Reduction::MEAN && indicesSize != 0LU) {
+                args.scale = 1.0F / static_cast<float>(indicesSize);
+            }
+            (*_kernel)(&args);
+        }
+    });
+#endif  // OPENVINO_ARCH_X86_64
+}
+
 void EmbeddingBag::execute(const uint8_t* srcData,
                            const uint8_t* weightsData,
                            const ov::element::Type& srcPrc,
                            const VectorDims& inDims,
                            const MemoryPtr& outMemory) {
+    if (_kernel) {
+        processDataJit(srcData, weightsData, srcPrc, inDims, outMemory);
+        return;
+    }
+
     switch (srcPrc) {
     case ov::element::f32: {
         processData<element_type_traits<ov::element::f32>::value_type>(reinterpret_cast<const float*>(srcData),
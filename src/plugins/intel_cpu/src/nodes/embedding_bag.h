@@ -8,9 +8,12 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "cpu_memory.h"
 #include "cpu_types.h"
+#include "nodes/kernels/x64/jit_kernel_base.hpp"
+#include "onednn/iml_type_mapper.h"
 #include "openvino/core/node.hpp"
 #include "openvino/core/type/element_type.hpp"
 
@@ -33,6 +36,13 @@ public:
 
     virtual ~EmbeddingBag() = default;
 
+    /**
+     * @brief Returns precision of embedding table used by node. bf16 and f16 tables are reduced by jit kernel with f32
+     * accumulation, without conversion of the whole table, if the kernel is supported on the platform.
+     */
+    static ov::element::Type getTablePrecision(const ov::element::Type& originalPrecision);
+    static impl_desc_type getImplType(const ov::element::Type& tablePrecision);
+
 protected:
     virtual void initFromInputs() = 0;
     virtual void getIndices(size_t embIndex,
@@ -41,10 +51,19 @@ protected:
                             int& weightsIdx,
                             bool& withWeights) = 0;
 
-    void prepareParams(const VectorDims& indexStaticShape);
+    void prepareParams(const VectorDims& indexStaticShape, const ov::element::Type& tablePrecision);
 
     template <typename T>
     void processData(const T* srcData, const T* weightsData, const VectorDims& inDataDims, const MemoryPtr& outMemory);
+    void processDataJit(const uint8_t* srcData,
+                        const uint8_t* weightsData,
+                        const ov::element::Type& srcPrc,
+                        const VectorDims& inDataDims,
+                        const MemoryPtr& outMemory);
+
+    // Bags are split between threads by the number of reduced rows, so a few long bags don't stall a single thread
+    void initBagsWork(size_t bagsNum);
+    void getBagsRange(int ithr, int nthr, size_t& start, size_t& end) const;
 
     const size_t EMB_TABLE_IDX = 0LU;
     const size_t INDICES_IDX;
@@ -55,6 +74,10 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+    // prefix sums of bags work, see initBagsWork
+    std::vector<size_t> _bagsWork;
+    std::shared_ptr<kernel::JitKernelBase> _kernel;
+    size_t _kernelEmbDepth = 0;
 };
 
 }  // namespace ov::intel_cpu::node
@@ -28,7 +28,6 @@
 #include "openvino/op/embeddingbag_offsets_sum.hpp"
 #include "openvino/op/util/embeddingbag_offsets_base.hpp"
 #include "shape_inference/shape_inference_cpu.hpp"
-#include "utils/general_utils.h"
 
 namespace ov::intel_cpu::node {
 
@@ -81,14 +80,13 @@ void EmbeddingBagOffset::initSupportedPrimitiveDescriptors() {
     }
 
     static const std::set<ov::element::Type> supportedPrecisions = {ov::element::f32,
+                                                                    ov::element::bf16,
+                                                                    ov::element::f16,
                                                                     ov::element::i8,
                                                                     ov::element::u8,
                                                                     ov::element::i32};
 
-    auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (any_of(inDataPrecision, ov::element::bf16, ov::element::f16)) {
-        inDataPrecision = ov::element::f32;
-    }
+    const auto inDataPrecision = getTablePrecision(getOriginalInputPrecisionAtPort(EMB_TABLE_IDX));
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end()) {
             CPU_NODE_THROW("has unsupported precision: ", inDataPrecision.get_type_name());
@@ -113,13 +111,14 @@ void EmbeddingBagOffset::initSupportedPrimitiveDescriptors() {
         inDataConfigurators.emplace_back(LayoutType::ncsp, inDataPrecision);
     }
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, getImplType(inDataPrecision));
 }
 
 void EmbeddingBagOffset::prepareParams() {
     _indicesLen = getParentEdgeAt(INDICES_IDX)->getMemory().getStaticDims()[0];
     _offsetsLen = getParentEdgeAt(OFFSETS_IDX)->getMemory().getStaticDims()[0];
-    EmbeddingBag::prepareParams(getParentEdgeAt(EMB_TABLE_IDX)->getMemory().getStaticDims());
+    const auto& tableMemory = getParentEdgeAt(EMB_TABLE_IDX)->getMemory();
+    EmbeddingBag::prepareParams(tableMemory.getStaticDims(), tableMemory.getDesc().getPrecision());
 }
 
 void EmbeddingBagOffset::initFromInputs() {
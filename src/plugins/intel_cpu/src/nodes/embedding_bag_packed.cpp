@@ -28,7 +28,6 @@
 #include "openvino/op/embeddingbag_packedsum.hpp"
 #include "openvino/op/util/embeddingbag_packed_base.hpp"
 #include "shape_inference/shape_inference_cpu.hpp"
-#include "utils/general_utils.h"
 
 namespace ov::intel_cpu::node {
 
@@ -79,14 +78,13 @@ void EmbeddingBagPacked::initSupportedPrimitiveDescriptors() {
     }
 
     static const std::set<ov::element::Type> supportedPrecisions = {ov::element::f32,
+                                                                    ov::element::bf16,
+                                                                    ov::element::f16,
                                                                     ov::element::i8,
                                                                     ov::element::u8,
                                                                     ov::element::i32};
 
-    auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (any_of(inDataPrecision, ov::element::bf16, ov::element::f16)) {
-        inDataPrecision = ov::element::f32;
-    }
+    const auto inDataPrecision = getTablePrecision(getOriginalInputPrecisionAtPort(EMB_TABLE_IDX));
     if (!supportedPrecisions.empty()) {
         CPU_NODE_ASSERT(supportedPrecisions.find(inDataPrecision) != supportedPrecisions.end(),
                         "has unsupported precision: ",
@@ -107,13 +105,14 @@ void EmbeddingBagPacked::initSupportedPrimitiveDescriptors() {
         inDataConfigurators.emplace_back(LayoutType::ncsp, inDataPrecision);
     }
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, getImplType(inDataPrecision));
 }
 
 void EmbeddingBagPacked::prepareParams() {
     _batch = getParentEdgeAt(INDICES_IDX)->getMemory().getStaticDims()[0];
     _indicesPerBag = getParentEdgeAt(INDICES_IDX)->getMemory().getStaticDims()[1];
-    EmbeddingBag::prepareParams(getParentEdgeAt(EMB_TABLE_IDX)->getMemory().getStaticDims());
+    const auto& tableMemory = getParentEdgeAt(EMB_TABLE_IDX)->getMemory();
+    EmbeddingBag::prepareParams(tableMemory.getStaticDims(), tableMemory.getDesc().getPrecision());
 }
 
 void EmbeddingBagPacked::initFromInputs() {
@@ -4,9 +4,11 @@
 
 #include "embedding_segments_sum.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <set>
@@ -25,7 +27,6 @@
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/embedding_segments_sum.hpp"
 #include "shape_inference/shape_inference_cpu.hpp"
-#include "utils/general_utils.h"
 
 namespace ov::intel_cpu::node {
 
@@ -66,14 +67,13 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
     }
 
     static const std::set<ov::element::Type> supportedPrecisions = {ov::element::f32,
+                                                                    ov::element::bf16,
+                                                                    ov::element::f16,
                                                                     ov::element::i8,
                                                                     ov::element::u8,
                                                                     ov::element::i32};
 
-    auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (any_of(inDataPrecision, ov::element::bf16, ov::element::f16)) {
-        inDataPrecision = ov::element::f32;
-    }
+    const auto inDataPrecision = getTablePrecision(getOriginalInputPrecisionAtPort(EMB_TABLE_IDX));
     if (!supportedPrecisions.empty()) {
         CPU_NODE_ASSERT(supportedPrecisions.find(inDataPrecision) != supportedPrecisions.end(),
                         "has unsupported precision: ",
@@ -99,11 +99,12 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
         inDataConfigurators.emplace_back(LayoutType::ncsp, inDataPrecision);
     }
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, getImplType(inDataPrecision));
 }
 
 void EmbeddingSegmentsSum::prepareParams() {
-    EmbeddingBag::prepareParams(getParentEdgeAt(EMB_TABLE_IDX)->getMemory().getStaticDims());
+    const auto& tableMemory = getParentEdgeAt(EMB_TABLE_IDX)->getMemory();
+    EmbeddingBag::prepareParams(tableMemory.getStaticDims(), tableMemory.getDesc().getPrecision());
 }
 
 void EmbeddingSegmentsSum::initFromInputs() {
@@ -129,14 +130,14 @@ void EmbeddingSegmentsSum::getIndices(size_t embIndex,
     size = 0;
     withWeight = true;
 
-    for (int si = 0; si < static_cast<int>(indicesSize_); si++) {
-        if (static_cast<size_t>(segmentIds_[si]) == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
+    // segment ids are sorted, so the bag is a contiguous range of indices
+    const auto* const segmentIdsEnd = segmentIds_ + indicesSize_;
+    const auto range = std::equal_range(segmentIds_, segmentIdsEnd, static_cast<int>(embIndex));
+    if (range.first != range.second) {
+        const auto si = std::distance(segmentIds_, range.first);
+        size = static_cast<size_t>(std::distance(range.first, range.second));
+        indices = indices_ + si;
+        weightsIdx = static_cast<int>(si);
     }
 
     // Empty bag
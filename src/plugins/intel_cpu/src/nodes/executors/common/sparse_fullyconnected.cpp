@@ -0,0 +1,229 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_fullyconnected.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "cpu_types.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/executors/debug_messages.hpp"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/implementation_utils.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/memory_util.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu {
+
+using namespace executor;
+using namespace ov::element;
+
+namespace {
+// batch rows multiplied by a nonzero weight at once, accumulators of a block fit a vector register
+constexpr size_t BATCH_BLOCK = 8;
+// output channels processed by a parallel task
+constexpr size_t CHANNELS_CHUNK = 64;
+// input channels transposed by a parallel task
+constexpr size_t TRANSPOSE_CHUNK = 64;
+}  // namespace
+
+static Dim batchDim(const VectorDims& dims) {
+    return std::accumulate(dims.begin(), dims.end() - 1, 1, std::multiplies<>());
+}
+
+/**
+ * CSR weights are stored in a single memory: offsets of the rows [N + 1], input channels of the nonzero weights [nnz]
+ * and the nonzero weights [nnz].
+ */
+static MemoryPtr prepareCsrWeights(const MemoryPtr& weightsMemory,
+                                   const ExecutorContext::CPtr& context,
+                                   const bool weightsTransposed) {
+    DEBUG_LOG("SparseFCExecutor: prepare CSR weights");
+    const auto& wgtDims = weightsMemory->getStaticDims();
+    const size_t N = weightsTransposed ? wgtDims[0] : wgtDims[1];
+    const size_t K = weightsTransposed ? wgtDims[1] : wgtDims[0];
+
+    auto create = [&]() {
+        const auto* weights = weightsMemory->getDataAs<const float>();
+        const auto weight = [&](const size_t n, const size_t k) {
+            return weightsTransposed ? weights[n * K + k] : weights[k * N + n];
+        };
+        const auto& cpuParallel = context->getCpuParallel();
+
+        std::vector<size_t> rowNnz(N);
+        cpuParallel->parallel_for(N, [&](size_t n) {
+            size_t nnz = 0;
+            for (size_t k = 0; k < K; k++) {
+                nnz += static_cast<size_t>(weight(n, k) != 0.0F);
+            }
+            rowNnz[n] = nnz;
+        });
+        const size_t nnz = std::accumulate(rowNnz.begin(), rowNnz.end(), size_t{0});
+        OPENVINO_ASSERT(nnz <= static_cast<size_t>(std::numeric_limits<int32_t>::max()),
+                        "SparseFCExecutor: too many nonzero weights: ",
+                        nnz);
+
+        const size_t csrSize = (N + 1 + nnz) * sizeof(int32_t) + nnz * sizeof(float);
+        MemoryPtr csr = std::make_shared<Memory>(context->getEngine(),
+                                                 intel_cpu::CpuBlockedMemoryDesc(i8, intel_cpu::Shape{csrSize}));
+        auto* rowPtr = csr->getDataAs<int32_t>();
+        auto* cols = rowPtr + N + 1;
+        auto* values = reinterpret_cast<float*>(cols + nnz);
+
+        rowPtr[0] = 0;
+        for (size_t n = 0; n < N; n++) {
+            rowPtr[n + 1] = rowPtr[n] + static_cast<int32_t>(rowNnz[n]);
+        }
+        cpuParallel->parallel_for(N, [&](size_t n) {
+            auto j = static_cast<size_t>(rowPtr[n]);
+            for (size_t k = 0; k < K; k++) {
+                const float w = weight(n, k);
+                if (w != 0.0F) {
+                    cols[j] = static_cast<int32_t>(k);
+                    values[j] = w;
+                    j++;
+                }
+            }
+        });
+        DEBUG_LOG("SparseFCExecutor: nnzCount = ", nnz, ", elementsCount = ", N * K);
+        // the original weights are not read anymore, drop their pages if they are mapped from the model file
+        ov::util::release_mapped_memory(weightsMemory->getData(), weightsMemory->getSize());
+        return csr;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        std::string format = "gemm_sparse_csr_" + std::to_string(N) + "_" + std::to_string(K) + "_" +
+                             std::to_string(static_cast<int>(weightsTransposed));
+        const std::string string_hash = format + "_" + std::to_string(weightsMemory->getSize()) + "_" +
+                                        std::to_string(reinterpret_cast<uint64_t>(weightsMemory->getData()));
+        DEBUG_LOG("SparseFCExecutor: findOrCreate, string_hash: ", string_hash);
+        return MemoryPtr(*weightCache->findOrCreate(string_hash, create));
+    }
+
+    DEBUG_LOG("SparseFCExecutor: Weights cache is not available");
+    return create();
+}
+
+bool SparseFCExecutor::supports(const FCConfig& config) {
+    VERIFY(config.attrs.sparseFloatWeights, UNSUPPORTED_SPARSE_WEIGHTS);
+    VERIFY(config.attrs.constantWeights, UNSUPPORTED_BY_EXECUTOR);
+    VERIFY(config.attrs.postOps.empty(), UNSUPPORTED_POST_OPS);
+    VERIFY(all_of(f32, srcType(config), weiType(config), dstType(config)), UNSUPPORTED_SRC_PRECISIONS);
+    VERIFY(config.descs.at(ARG_BIAS)->empty() || biaType(config) == f32, UNSUPPORTED_BIAS_PRECISIONS);
+    VERIFY(weiRank(config) == 2U, UNSUPPORTED_WEI_RANK);
+    return true;
+}
+
+SparseFCExecutor::SparseFCExecutor(const FCAttrs& attrs, const MemoryArgs& memory, const ExecutorContext::CPtr& context)
+    : m_memoryArgs(memory),
+      m_context(context),
+      m_csrWeights(prepareCsrWeights(memory.at(ARG_WEI), context, !attrs.weightsNonTransposed)),
+      N(attrs.weightsNonTransposed ? memory.at(ARG_WEI)->getStaticDims()[1] : memory.at(ARG_WEI)->getStaticDims()[0]),
+      K(attrs.weightsNonTransposed ? memory.at(ARG_WEI)->getStaticDims()[0] : memory.at(ARG_WEI)->getStaticDims()[1]) {}
+
+bool SparseFCExecutor::update(const MemoryArgs& memory) {
+    const auto& outDims = memory.at(ARG_DST)->getDescPtr()->getShape().getStaticDims();
+    M = batchDim(outDims);
+    if (M > maxBatch) {
+        return false;
+    }
+
+    if (M > 1) {
+        m_paddedM = rnd_up(M, BATCH_BLOCK);
+        // padding rows stay zero, so the kernel processes whole blocks
+        m_transposedSrc.assign(K * m_paddedM, 0.0F);
+    }
+
+    return true;
+}
+
+void SparseFCExecutor::execute(const MemoryArgs& memory) {
+    if (M == 0) {
+        return;
+    }
+
+    const auto* rowPtr = m_csrWeights->getDataAs<const int32_t>();
+    const auto* cols = rowPtr + N + 1;
+    const auto* values = reinterpret_cast<const float*>(cols + rowPtr[N]);
+    const auto* src = memory.at(ARG_SRC)->getDataAs<const float>();
+    auto* dst = memory.at(ARG_DST)->getDataAs<float>();
+    const auto* bias = memory.at(ARG_BIAS)->getDesc().empty() ? nullptr : memory.at(ARG_BIAS)->getDataAs<const float>();
+    const auto& cpuParallel = m_context->getCpuParallel();
+
+    if (M == 1) {
+        cpuParallel->parallel_for(div_up(N, CHANNELS_CHUNK), [&](size_t chunk) {
+            const size_t end = std::min(N, (chunk + 1) * CHANNELS_CHUNK);
+            for (size_t n = chunk * CHANNELS_CHUNK; n < end; n++) {
+                float acc = bias != nullptr ? bias[n] : 0.0F;
+                for (auto j = rowPtr[n]; j < rowPtr[n + 1]; j++) {
+                    acc += values[j] * src[cols[j]];
+                }
+                dst[n] = acc;
+            }
+        });
+        return;
+    }
+
+    // [M, K] -> [K, paddedM], so the batch multiplied by a weight is contiguous
+    auto* srcT = m_transposedSrc.data();
+    const size_t paddedM = m_paddedM;
+    cpuParallel->parallel_for(div_up(K, TRANSPOSE_CHUNK), [&](size_t chunk) {
+        const size_t end = std::min(K, (chunk + 1) * TRANSPOSE_CHUNK);
+        for (size_t m = 0; m < M; m++) {
+            for (size_t k = chunk * TRANSPOSE_CHUNK; k < end; k++) {
+                srcT[k * paddedM + m] = src[m * K + k];
+            }
+        }
+    });
+
+    cpuParallel->parallel_for(div_up(N, CHANNELS_CHUNK), [&](size_t chunk) {
+        std::array<float, maxBatch> acc{};
+        const size_t end = std::min(N, (chunk + 1) * CHANNELS_CHUNK);
+        for (size_t n = chunk * CHANNELS_CHUNK; n < end; n++) {
+            std::fill(acc.begin(), acc.begin() + paddedM, 0.0F);
+            for (auto j = rowPtr[n]; j < rowPtr[n + 1]; j++) {
+                const float w = values[j];
+                const float* srcBatch = srcT + static_cast<size_t>(cols[j]) * paddedM;
+                for (size_t mb = 0; mb < paddedM; mb += BATCH_BLOCK) {
+                    for (size_t i = 0; i < BATCH_BLOCK; i++) {
+                        acc[mb + i] += w * srcBatch[mb + i];
+                    }
+                }
+            }
+            const float b = bias != nullptr ? bias[n] : 0.0F;
+            for (size_t m = 0; m < M; m++) {
+                dst[m * N + n] = acc[m] + b;
+            }
+        }
+    });
+}
+
+void SparseFCExecutor::moveMemToNumaNode(int numaNodeID) {
+    if (curNumaNode == numaNodeID) {
+        return;
+    }
+    curNumaNode = numaNodeID;
+    mbind_move(m_csrWeights, numaNodeID);
+    if (!m_memoryArgs.at(ARG_BIAS)->getDesc().empty()) {
+        mbind_move(m_memoryArgs.at(ARG_BIAS), numaNodeID);
+    }
+}
+
+}  // namespace ov::intel_cpu
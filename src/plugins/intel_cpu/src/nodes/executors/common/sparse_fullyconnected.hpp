@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "onednn/iml_type_mapper.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief FullyConnected with sparse f32 weights.
+ *
+ * Weights are converted into the compressed sparse row (CSR) format once, when the executor is created, so only
+ * nonzero weights are multiplied. Rows of the source are transposed into blocks, so every nonzero weight is
+ * multiplied with the whole batch by a vectorized loop. The executor is used for batches up to maxBatch, larger
+ * batches are compute bound and are executed by the dense implementations.
+ */
+class SparseFCExecutor : public Executor {
+public:
+    SparseFCExecutor(const FCAttrs& attrs, const MemoryArgs& memory, const ExecutorContext::CPtr& context);
+
+    void execute(const MemoryArgs& memory) override;
+
+    [[nodiscard]] impl_desc_type implType() const override {
+        return impl_desc_type::gemm_sparse;
+    }
+
+    // offloads execution data preparation from the exec call
+    bool update(const MemoryArgs& memory) override;
+
+    static bool supports(const FCConfig& config);
+
+    void moveMemToNumaNode(int numaNodeID) override;
+
+    static constexpr size_t maxBatch = 64;
+
+private:
+    const MemoryArgs& m_memoryArgs;
+    ExecutorContext::CPtr m_context;
+    const MemoryCPtr m_csrWeights;
+    size_t M = 0, N, K;
+    // batch padded to the block of the kernel
+    size_t m_paddedM = 0;
+    std::vector<float> m_transposedSrc;
+    int curNumaNode = -1;
+};
+
+}  // namespace ov::intel_cpu
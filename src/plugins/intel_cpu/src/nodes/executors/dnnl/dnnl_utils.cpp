@@ -21,6 +21,7 @@
 #include "nodes/executors/executor.hpp"
 #include "nodes/reorder.h"
 #include "openvino/core/except.hpp"
+#include "openvino/core/memory_util.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "thread_pool_imp.hpp"
 #include "weights_cache.hpp"
@@ -75,6 +76,7 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
             Memory srcMemory{eng, srcWeightDesc->cloneWithNewPrecision(dst_wdt), weightsMem->getData()};
             MemoryPtr _ptr = std::make_shared<Memory>(eng, dstWeightDesc);
             node::Reorder::reorderData(srcMemory, *_ptr, rtCache, threadPool);
+            ov::util::release_mapped_memory(weightsMem->getData(), weightsMem->getSize());
 
             // do shift
             auto count = _ptr->getSize() / _ptr->getDesc().getPrecision().size();
@@ -99,6 +101,8 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
         Memory srcMemory{eng, srcWeightDesc, weightsMem->getData()};
         MemoryPtr _ptr = std::make_shared<Memory>(eng, dstWeightDesc);
         node::Reorder::reorderData(srcMemory, *_ptr, rtCache, threadPool);
+        // the original weights are not read anymore, drop their pages if they are mapped from the model file
+        ov::util::release_mapped_memory(weightsMem->getData(), weightsMem->getSize());
 
         return _ptr;
     };
@@ -97,6 +97,10 @@ public:
         return cpuParallel->get_thread_pool();
     }
 
+    [[nodiscard]] const std::shared_ptr<CpuParallel>& getCpuParallel() const {
+        return cpuParallel;
+    }
+
 private:
     // weak_ptr is required to avoid cycle dependencies with MultiCache
     // since ExecutorContext is stored in Executor itself
@@ -16,6 +16,8 @@ namespace ov::intel_cpu {
 struct FCAttrs {
     bool weightsNonTransposed = false;
     bool sparseWeights = false;
+    // constant f32 weights with the sparse rate not less than ov::intel_cpu::sparse_float_weights_rate
+    bool sparseFloatWeights = false;
     uint64_t dynamicQuantizationGroupSize = 0;
     bool constantWeights = true;
 
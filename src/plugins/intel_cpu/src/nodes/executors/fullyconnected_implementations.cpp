@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <vector>
 
@@ -10,6 +13,7 @@
 #include "debug_messages.hpp"
 #include "implementation_utils.hpp"
 #include "memory_desc/cpu_memory_desc.h"
+#include "nodes/executors/common/sparse_fullyconnected.hpp"
 #include "nodes/executors/convolution_config.hpp"
 #include "nodes/executors/dnnl/dnnl_executor.hpp"
 #include "nodes/executors/dnnl/dnnl_fullyconnected_primitive.hpp"
@@ -195,6 +199,26 @@ struct CreateOptimalConfigDefault {
 template <>
 const std::vector<ExecutorImplementation<FCAttrs>>& getImplementations() {
     static const std::vector<ExecutorImplementation<FCAttrs>> fullyconnectedImplementations {
+        OV_CPU_INSTANCE_COMMON(
+            "fullyconnected_sparse",
+            ExecutorType::Common,
+            OperationType::FullyConnected,
+            // supports
+            [](const FCConfig& config) -> bool {
+                return SparseFCExecutor::supports(config);
+            },
+            HasNoOptimalConfig<FCAttrs>{},
+            // acceptsShapes
+            []([[maybe_unused]] const FCAttrs& attrs,
+               const MemoryArgs& memory) -> bool {
+                // larger batches are compute bound, so the dense implementations are faster
+                const auto& srcDims = memory.at(ARG_SRC)->getShape().getStaticDims();
+                const auto batch = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t{1}, std::multiplies<>());
+                VERIFY(batch <= SparseFCExecutor::maxBatch, HEURISTICS_MISMATCH);
+                return true;
+            },
+            CreateDefault<SparseFCExecutor, FCAttrs>{}
+            )
         OV_CPU_INSTANCE_MLAS_X64(
             "fullyconnected_mlas",
             ExecutorType::Mlas,
@@ -20,6 +20,7 @@
 #include "nodes/executors/fullyconnected_config.hpp"
 #include "nodes/executors/memory_arguments.hpp"
 #include "nodes/executors/mlas/mlas_gemm.hpp"
+#include "openvino/core/memory_util.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "utils/debug_capabilities.h"
 
@@ -55,6 +56,8 @@ static MemoryPtr prepareWeightMemory(const MemoryPtr weightsMemory,
         auto* prepackedDst = _ptr->getDataAs<float>();
         DEBUG_LOG("MlasGemmExecutor: cache miss, perform packing");
         mlas_sgemm_pack(weightsTransposed ? "T" : "F", N, K, ldb, weightPtr, prepackedDst);
+        // the original weights are not read anymore, drop their pages if they are mapped from the model file
+        ov::util::release_mapped_memory(weightsMemory->getData(), weightsMemory->getSize());
         return _ptr;
     };
 
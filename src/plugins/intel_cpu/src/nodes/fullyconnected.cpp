@@ -506,6 +506,38 @@ const std::vector<impl_desc_type>& FullyConnected::getDefaultImplPriority() {
     return priorities;
 }
 
+template <typename T>
+static float weightsSparseRate(const MemoryPtr& weiMemory) {
+    const auto* const weightsData = weiMemory->getDataAs<const T>();
+    auto elementsCount = weiMemory->getDescWithType<BlockedMemoryDesc>()->getPaddedElementsCount();
+    size_t zerosCount = 0;
+    for (size_t i = 0; i < elementsCount; i++) {
+        if (weightsData[i] == static_cast<T>(0)) {
+            zerosCount++;
+        }
+    }
+
+    DEBUG_LOG("elementsCount = ",
+              elementsCount,
+              ", zerosCount = ",
+              zerosCount,
+              ", nnzCount = ",
+              elementsCount - zerosCount);
+
+    return static_cast<float>(zerosCount) / static_cast<float>(elementsCount);
+}
+
+static MemoryPtr constWeightsMemory(const NodePtr& weightsInput) {
+    const auto constNode = std::dynamic_pointer_cast<Input>(weightsInput);
+    if (!constNode) {
+        return nullptr;
+    }
+
+    const auto weiMemory = constNode->getMemoryPtr();
+    OPENVINO_ASSERT(weiMemory, "Cannot get const blob");
+    return weiMemory;
+}
+
 // @todo Should be moved to the transformations / optimization stages?
 static bool useSparseWeightsDecompression(const NodePtr& weightsInput,
                                           const ov::element::Type inputType,
@@ -520,14 +552,11 @@ static bool useSparseWeightsDecompression(const NodePtr& weightsInput,
         return false;
     }
 
-    const auto constNode = std::dynamic_pointer_cast<Input>(weightsInput);
-    if (!constNode) {
+    const auto weiMemory = constWeightsMemory(weightsInput);
+    if (!weiMemory) {
         return false;
     }
 
-    const auto weiMemory = constNode->getMemoryPtr();
-    OPENVINO_ASSERT(weiMemory, "Cannot get const blob");
-
     const auto weiDims = weiMemory->getShape().getStaticDims();
     if (weiDims.size() != 2 || weiDims[0] % 64 != 0 || weiDims[1] % 64 != 0) {
         return false;
@@ -538,29 +567,40 @@ static bool useSparseWeightsDecompression(const NodePtr& weightsInput,
         return false;
     }
 
-    const auto* const weightsData = weiMemory->getDataAs<const int8_t>();
-    auto elementsCount = weiMemory->getDescWithType<BlockedMemoryDesc>()->getPaddedElementsCount();
-    size_t zerosCount = 0;
-    for (size_t i = 0; i < elementsCount; i++) {
-        if (weightsData[i] == 0) {
-            zerosCount++;
-        }
+    const auto sparseRate = weightsSparseRate<int8_t>(weiMemory);
+
+    DEBUG_LOG("Sparse rate = ",
+              sparseRate * 100,
+              "%, min sparse rate = ",
+              minSparseRate * 100,
+              "%, use sparse weights = ",
+              sparseRate >= minSparseRate);
+
+    return sparseRate >= minSparseRate;
+}
+
+// float weights are executed in the compressed sparse row format on any ISA, unlike int8 ones decompressed by oneDNN
+static bool useSparseFloatWeights(const NodePtr& weightsInput,
+                                  const ov::element::Type inputType,
+                                  const float sparseFloatWeightsRate) {
+    const auto minSparseRate = sparseFloatWeightsRate;
+
+    if (minSparseRate == 1.F || inputType != f32) {
+        return false;
     }
 
-    DEBUG_LOG("elementsCount = ",
-              elementsCount,
-              ", zerosCount = ",
-              zerosCount,
-              ", nnzCount = ",
-              elementsCount - zerosCount);
+    const auto weiMemory = constWeightsMemory(weightsInput);
+    if (!weiMemory || weiMemory->getPrecision() != f32 || weiMemory->getShape().getRank() != 2) {
+        return false;
+    }
 
-    auto sparseRate = static_cast<float>(zerosCount) / static_cast<float>(elementsCount);
+    const auto sparseRate = weightsSparseRate<float>(weiMemory);
 
     DEBUG_LOG("Sparse rate = ",
               sparseRate * 100,
               "%, min sparse rate = ",
               minSparseRate * 100,
-              "%, use sparse weights = ",
+              "%, use sparse float weights = ",
               sparseRate >= minSparseRate);
 
     return sparseRate >= minSparseRate;
@@ -570,6 +610,9 @@ void FullyConnected::initSupportedPrimitiveDescriptors() {
     attrs.sparseWeights = useSparseWeightsDecompression(getParentEdgeAt(WEIGHTS)->getParent(),
                                                         getOriginalInputPrecisionAtPort(DATA),
                                                         context->getConfig().fcSparseWeiDecompressionRate);
+    attrs.sparseFloatWeights = useSparseFloatWeights(getParentEdgeAt(WEIGHTS)->getParent(),
+                                                     getOriginalInputPrecisionAtPort(DATA),
+                                                     context->getConfig().fcSparseFloatWeightsRate);
     attrs.dynamicQuantizationGroupSize = context->getConfig().fcDynamicQuantizationGroupSize;
     attrs.modelType = context->getConfig().modelType;
 
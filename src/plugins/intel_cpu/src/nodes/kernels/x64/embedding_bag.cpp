@@ -0,0 +1,191 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag.hpp"
+
+#include <xbyak/xbyak.h>
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cpu/x64/jit_generator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "emitters/plugin/x64/jit_load_store_emitters.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+using namespace dnnl::impl::cpu::x64;
+using namespace Xbyak;
+
+namespace ov::intel_cpu::kernel {
+
+#define GET_OFF(field) offsetof(jit_embedding_bag_call_args, field)
+
+template <cpu_isa_t isa>
+void jit_embedding_bag_kernel<isa>::generate() {
+    OPENVINO_ASSERT(m_jcp.emb_depth * m_jcp.prc.size() <= static_cast<size_t>(std::numeric_limits<int32_t>::max()),
+                    "Embedding table row is too large for jit kernel");
+
+    this->preamble();
+    mov(reg_src, ptr[abi_param1 + GET_OFF(src)]);
+    mov(reg_indices, ptr[abi_param1 + GET_OFF(indices)]);
+    mov(reg_weights, ptr[abi_param1 + GET_OFF(weights)]);
+    mov(reg_dst, ptr[abi_param1 + GET_OFF(dst)]);
+    mov(reg_indices_num, ptr[abi_param1 + GET_OFF(indices_num)]);
+    if (m_jcp.mean) {
+        uni_vbroadcastss(vmm_scale, ptr[abi_param1 + GET_OFF(scale)]);
+    }
+
+    const size_t block_size = vec_size * unroll;
+    const size_t full_blocks = m_jcp.emb_depth / block_size;
+    if (full_blocks != 0) {
+        mov(reg_blocks, full_blocks);
+        Xbyak::Label loop_blocks;
+        L(loop_blocks);
+        {
+            reduce_block(unroll, vec_size);
+            add(reg_src, block_size * m_jcp.prc.size());
+            add(reg_dst, block_size * m_jcp.prc.size());
+            dec(reg_blocks);
+            jnz(loop_blocks, T_NEAR);
+        }
+    }
+    // tail
+    if (const auto tail = m_jcp.emb_depth % block_size; tail != 0) {
+        const auto last_vmm_elt_num = tail % vec_size;
+        reduce_block(dnnl::impl::utils::div_up(tail, vec_size), last_vmm_elt_num != 0 ? last_vmm_elt_num : vec_size);
+    }
+
+    this->postamble();
+    for (const auto& emitter : emitters) {
+        if (emitter.second) {
+            emitter.second->emit_data();
+        }
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_embedding_bag_kernel<isa>::reduce_block(size_t vmm_num, size_t last_vmm_elt_num) {
+    const auto row_stride = static_cast<int32_t>(m_jcp.emb_depth * m_jcp.prc.size());
+    const auto elt_num = [&](size_t i) {
+        return static_cast<int>(i == vmm_num - 1 ? last_vmm_elt_num : vec_size);
+    };
+    const auto offset = [&](size_t i) {
+        return i * vec_size * m_jcp.prc.size();
+    };
+    // cache lines of the block in a row
+    const size_t block_bytes = offset(vmm_num - 1) + elt_num(vmm_num - 1) * m_jcp.prc.size();
+    const size_t prefetch_lines = dnnl::impl::utils::div_up(block_bytes, static_cast<size_t>(64));
+
+    for (size_t i = 0; i < vmm_num; i++) {
+        uni_vpxor(vmm_acc(i), vmm_acc(i), vmm_acc(i));
+    }
+
+    Xbyak::Label loop_indices;
+    Xbyak::Label loop_indices_end;
+    Xbyak::Label skip_prefetch;
+    xor_(reg_iter, reg_iter);
+    align(16);
+    L(loop_indices);
+    {
+        cmp(reg_iter, reg_indices_num);
+        jge(loop_indices_end, T_NEAR);
+
+        movsxd(reg_row, dword[reg_indices + reg_iter * static_cast<int>(sizeof(int32_t))]);
+        imul(reg_row, reg_row, row_stride);
+        add(reg_row, reg_src);
+
+        lea(reg_tmp, ptr[reg_iter + prefetch_distance]);
+        cmp(reg_tmp, reg_indices_num);
+        jge(skip_prefetch, T_NEAR);
+        movsxd(reg_tmp, dword[reg_indices + reg_tmp * static_cast<int>(sizeof(int32_t))]);
+        imul(reg_tmp, reg_tmp, row_stride);
+        add(reg_tmp, reg_src);
+        for (size_t line = 0; line < prefetch_lines; line++) {
+            prefetcht0(ptr[reg_tmp + line * 64]);
+        }
+        L(skip_prefetch);
+
+        if (m_jcp.with_weights) {
+            load_weight();
+        }
+        for (size_t i = 0; i < vmm_num; i++) {
+            load(vmm_src, reg_row, elt_num(i), offset(i));
+            if (m_jcp.with_weights) {
+                vfmadd231ps(vmm_acc(i), vmm_src, vmm_weight);
+            } else {
+                uni_vaddps(vmm_acc(i), vmm_acc(i), vmm_src);
+            }
+        }
+
+        inc(reg_iter);
+        jmp(loop_indices, T_NEAR);
+    }
+    L(loop_indices_end);
+
+    for (size_t i = 0; i < vmm_num; i++) {
+        if (m_jcp.mean) {
+            uni_vmulps(vmm_acc(i), vmm_acc(i), vmm_scale);
+        }
+        store(reg_dst, vmm_acc(i), elt_num(i), offset(i));
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_embedding_bag_kernel<isa>::load_weight() {
+    const auto weight = reg_weights + reg_iter * static_cast<int>(m_jcp.prc.size());
+    if (m_jcp.prc == ov::element::f32) {
+        uni_vbroadcastss(vmm_weight, ptr[weight]);
+        return;
+    }
+    movzx(reg_tmp.cvt32(), word[weight]);
+    if (m_jcp.prc == ov::element::bf16) {
+        shl(reg_tmp.cvt32(), 16);
+        vmovd(xmm_weight, reg_tmp.cvt32());
+    } else {
+        OPENVINO_ASSERT(m_jcp.prc == ov::element::f16, "Unsupported embedding table precision: ", m_jcp.prc);
+        vmovd(xmm_weight, reg_tmp.cvt32());
+        vcvtph2ps(xmm_weight, xmm_weight);
+    }
+    vbroadcastss(vmm_weight, xmm_weight);
+}
+
+template <cpu_isa_t isa>
+void jit_embedding_bag_kernel<isa>::load(const Vmm& vmm_dst,
+                                         const Xbyak::Reg64& reg_src,
+                                         const int& elt_num,
+                                         size_t offset) {
+    // lanes of partial load are zeroed to keep unused accumulator lanes finite
+    const bool fill = static_cast<size_t>(elt_num) != vec_size;
+    const auto seed = load_emitter_params(m_jcp.prc, ov::element::f32, elt_num, fill).hash();
+    if (!emitters[seed]) {
+        emitters[seed] =
+            std::make_unique<jit_load_emitter>(this, isa, m_jcp.prc, ov::element::f32, elt_num, ov::element::f32, fill);
+    }
+    emitters[seed]->emit_code({static_cast<size_t>(reg_src.getIdx()), offset},
+                              {static_cast<size_t>(vmm_dst.getIdx())},
+                              pool_aux_vmm_idxs,
+                              pool_aux_gpr_idxs);
+}
+
+template <cpu_isa_t isa>
+void jit_embedding_bag_kernel<isa>::store(const Xbyak::Reg64& reg_dst,
+                                          const Vmm& vmm_src,
+                                          const int& elt_num,
+                                          size_t offset) {
+    const auto seed = store_emitter_params(ov::element::f32, m_jcp.prc, elt_num).hash();
+    if (!emitters[seed]) {
+        emitters[seed] = std::make_unique<jit_store_emitter>(this, isa, ov::element::f32, m_jcp.prc, elt_num);
+    }
+    emitters[seed]->emit_code({static_cast<size_t>(vmm_src.getIdx())},
+                              {static_cast<size_t>(reg_dst.getIdx()), offset},
+                              pool_aux_vmm_idxs,
+                              pool_aux_gpr_idxs);
+}
+
+template struct jit_embedding_bag_kernel<cpu_isa_t::avx512_core>;
+template struct jit_embedding_bag_kernel<cpu_isa_t::avx2>;
+
+}  // namespace ov::intel_cpu::kernel
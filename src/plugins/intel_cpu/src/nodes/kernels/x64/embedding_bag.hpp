@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <xbyak/xbyak.h>
+
+#include <common/utils.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cpu/x64/jit_generator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "emitters/plugin/x64/jit_emitter.hpp"
+#include "jit_kernel_base.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::intel_cpu::kernel {
+
+struct jit_embedding_bag_compile_params {
+    // precision of embedding table, per sample weights and output
+    ov::element::Type prc;
+    size_t emb_depth = 0UL;
+    bool with_weights = false;
+    bool mean = false;
+};
+
+struct jit_embedding_bag_call_args {
+    const uint8_t* src;       // embedding table
+    const int32_t* indices;   // indices of the bag rows, validated by the caller
+    const uint8_t* weights;   // per sample weights of the bag rows
+    uint8_t* dst;             // output row of the bag
+    size_t indices_num;       // empty bag produces zero row
+    float scale;              // applied to the sum for MEAN reduction
+};
+
+/**
+ * Reduces embedding table rows of one bag into the output row. The row is processed by blocks of up to
+ * `unroll` vector registers, f32 accumulators of a block stay in registers while all indices of the bag are walked.
+ * Rows of upcoming indices are prefetched, since random access to large tables is bound by memory latency.
+ */
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_embedding_bag_kernel : public JitKernel<jit_embedding_bag_compile_params, jit_embedding_bag_call_args> {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_embedding_bag_kernel)
+
+    static constexpr size_t vec_size = dnnl::impl::cpu::x64::cpu_isa_traits_t<isa>::vlen / sizeof(float);
+    static constexpr size_t unroll = 4;
+    static constexpr size_t prefetch_distance = 8;
+
+    explicit jit_embedding_bag_kernel(const jit_embedding_bag_compile_params& jcp)
+        : JitKernel(jit_name(), jcp, isa) {}
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                                         Xbyak::Xmm,
+                                                         isa == dnnl::impl::cpu::x64::avx2,
+                                                         Xbyak::Ymm,
+                                                         Xbyak::Zmm>::type;
+
+    void generate() override;
+    void reduce_block(size_t vmm_num, size_t last_vmm_elt_num);
+    void load_weight();
+    void load(const Vmm& vmm_dst, const Xbyak::Reg64& reg_src, const int& elt_num, size_t offset);
+    void store(const Xbyak::Reg64& reg_dst, const Vmm& vmm_src, const int& elt_num, size_t offset);
+
+    Vmm vmm_acc(size_t idx) const {
+        return Vmm(idx);
+    }
+
+    const Vmm vmm_src = Vmm(unroll);
+    const Vmm vmm_weight = Vmm(unroll + 1);
+    const Xbyak::Xmm xmm_weight = Xbyak::Xmm(unroll + 1);
+    const Vmm vmm_scale = Vmm(unroll + 2);
+    const Xbyak::Reg64 reg_src = r8;
+    const Xbyak::Reg64 reg_dst = r10;
+    const Xbyak::Reg64 reg_indices = r11;
+    const Xbyak::Reg64 reg_weights = r12;
+    const Xbyak::Reg64 reg_indices_num = r13;
+    const Xbyak::Reg64 reg_iter = r14;
+    const Xbyak::Reg64 reg_row = r15;
+    const Xbyak::Reg64 reg_blocks = rsi;
+    const Xbyak::Reg64 reg_tmp = rdx;
+
+    std::unordered_map<size_t, std::unique_ptr<jit_emitter>> emitters;
+    const std::vector<size_t> pool_aux_gpr_idxs = {static_cast<size_t>(rax.getIdx()), static_cast<size_t>(r9.getIdx())};
+    const std::vector<size_t> pool_aux_vmm_idxs = {unroll + 3, unroll + 4};
+};
+
+}  // namespace ov::intel_cpu::kernel
@@ -15,10 +15,12 @@
 #include <string>
 #include <vector>
 
+#include "cpu_parallel.hpp"
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
+#include "nodes/common/nms_utils.hpp"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/enum_names.hpp"
 #include "openvino/core/except.hpp"
@@ -104,15 +106,6 @@ MatrixNms::MatrixNms(const std::shared_ptr<ov::Node>& op, const GraphContext::CP
     m_gaussianSigma = attrs.gaussian_sigma;
     m_postThreshold = attrs.post_threshold;
     m_normalized = attrs.normalized;
-    if (m_decayFunction == MatrixNmsDecayFunction::LINEAR) {
-        m_decay_fn = [](float iou, float max_iou, [[maybe_unused]] float sigma) -> float {
-            return (1.F - iou) / (1.F - max_iou + 1e-10F);
-        };
-    } else {
-        m_decay_fn = [](float iou, float max_iou, float sigma) -> float {
-            return std::exp((max_iou * max_iou - iou * iou) * sigma);
-        };
-    }
 
     const auto& boxes_dims = getInputShapeAtPort(NMS_BOXES).getDims();
     CPU_NODE_ASSERT(boxes_dims.size() == 3, "has unsupported 'boxes' input rank: ", boxes_dims.size());
@@ -158,48 +151,44 @@ bool MatrixNms::created() const {
 
 namespace {
 
-inline float boxArea(const float* bbox, const bool normalized) {
-    if (bbox[2] < bbox[0] || bbox[3] < bbox[1]) {
-        return static_cast<float>(0.);
-    }
-    const float width = bbox[2] - bbox[0];
-    const float height = bbox[3] - bbox[1];
-    if (normalized) {
-        return width * height;
+template <MatrixNmsDecayFunction decayFunction>
+inline float decay(const float iou, const float max_iou, [[maybe_unused]] const float sigma) {
+    if constexpr (decayFunction == MatrixNmsDecayFunction::LINEAR) {
+        return (1.F - iou) / (1.F - max_iou + 1e-10F);
+    } else {
+        return std::exp((max_iou * max_iou - iou * iou) * sigma);
     }
-    return (width + 1) * (height + 1);
 }
 
-inline float intersectionOverUnion(const float* bbox1, const float* bbox2, const bool normalized) {
-    if (bbox2[0] > bbox1[2] || bbox2[2] < bbox1[0] || bbox2[1] > bbox1[3] || bbox2[3] < bbox1[1]) {
-        return static_cast<float>(0.);
-    }
-    const float xMin = std::max(bbox1[0], bbox2[0]);
-    const float yMin = std::max(bbox1[1], bbox2[1]);
-    const float xMax = std::min(bbox1[2], bbox2[2]);
-    const float yMax = std::min(bbox1[3], bbox2[3]);
-    float norm = normalized ? static_cast<float>(0.) : static_cast<float>(1.);
-    float width = xMax - xMin + norm;
-    float height = yMax - yMin + norm;
-    const float interArea = width * height;
-    const float bbox1Area = boxArea(bbox1, normalized);
-    const float bbox2Area = boxArea(bbox2, normalized);
-    return interArea / (bbox1Area + bbox2Area - interArea);
+// Decays the scores of the candidates sorted by score, the first candidate keeps its score.
+template <MatrixNmsDecayFunction decayFunction>
+void decayScores(const std::shared_ptr<CpuParallel>& cpu_parallel,
+                 const std::vector<float>& iouMatrix,
+                 const std::vector<float>& iouMax,
+                 const float sigma,
+                 std::vector<float>& scores) {
+    // scores of the candidates are decayed independently, only the selection of the boxes is sequential
+    cpu_parallel->parallel_for(scores.size() - 1, [&](size_t k) {
+        const size_t i = k + 1;
+        const float* iouRow = iouMatrix.data() + i * (i - 1) / 2;
+        float minDecay = 1.;
+        for (size_t j = 0; j < i; j++) {
+            minDecay = std::min(minDecay, decay<decayFunction>(iouRow[j], iouMax[j], sigma));
+        }
+        scores[i] *= minDecay;
+    });
 }
+
 }  // namespace
 
 size_t MatrixNms::nmsMatrix(const float* boxesData,
                             const float* scoresData,
                             BoxInfo* filterBoxes,
                             const int64_t batchIdx,
-                            const int64_t classIdx) {
-    std::vector<int32_t> candidateIndex(m_numBoxes);
-    std::iota(candidateIndex.begin(), candidateIndex.end(), 0);
-    auto end = std::remove_if(candidateIndex.begin(), candidateIndex.end(), [&scoresData, this](int32_t idx) {
-        return scoresData[idx] <= m_scoreThreshold;
-    });
+                            const int64_t classIdx,
+                            std::vector<int32_t>& candidateIndex) {
     int64_t numDet = 0;
-    int64_t originalSize = std::distance(candidateIndex.begin(), end);
+    int64_t originalSize = static_cast<int64_t>(candidateIndex.size());
     if (originalSize <= 0) {
         return 0;
     }
@@ -209,62 +198,66 @@ size_t MatrixNms::nmsMatrix(const float* boxesData,
 
     std::partial_sort(candidateIndex.begin(),
                       candidateIndex.begin() + originalSize,
-                      end,
+                      candidateIndex.end(),
                       [&scoresData](int32_t a, int32_t b) {
                           return scoresData[a] > scoresData[b];
                       });
 
+    // coordinates of the sorted candidates are gathered into separate arrays, so IoU of a candidate with all
+    // preceding ones is computed by a vectorized loop
+    const float norm = m_normalized ? 0.F : 1.F;
+    std::vector<float> x1(originalSize), y1(originalSize), x2(originalSize), y2(originalSize), area(originalSize);
+    for (int64_t i = 0; i < originalSize; i++) {
+        const float* box = boxesData + candidateIndex[i] * 4;
+        x1[i] = box[0];
+        y1[i] = box[1];
+        x2[i] = box[2];
+        y2[i] = box[3];
+        area[i] = (x2[i] < x1[i] || y2[i] < y1[i]) ? 0.F : (x2[i] - x1[i] + norm) * (y2[i] - y1[i] + norm);
+    }
+
     std::vector<float> iouMatrix((originalSize * (originalSize - 1)) >> 1);
     std::vector<float> iouMax(originalSize);
     const auto& cpu_parallel = context->getCpuParallel();
 
     iouMax[0] = 0.;
     cpu_parallel->parallel_for(originalSize - 1, [&](size_t i) {
+        const size_t a = i + 1;
+        float* iouRow = iouMatrix.data() + a * (a - 1) / 2;
+        for (size_t b = 0; b < a; b++) {
+            const bool disjoint = x1[b] > x2[a] || x2[b] < x1[a] || y1[b] > y2[a] || y2[b] < y1[a];
+            const float interArea = (std::min(x2[a], x2[b]) - std::max(x1[a], x1[b]) + norm) *
+                                    (std::min(y2[a], y2[b]) - std::max(y1[a], y1[b]) + norm);
+            const float iou = interArea / (area[a] + area[b] - interArea);
+            iouRow[b] = disjoint ? 0.F : iou;
+        }
         float max_iou = 0.;
-        size_t actual_index = i + 1;
-        auto idx_a = candidateIndex[actual_index];
-        for (size_t j = 0; j < actual_index; j++) {
-            auto idx_b = candidateIndex[j];
-            auto iou = intersectionOverUnion(boxesData + idx_a * 4, boxesData + idx_b * 4, m_normalized);
-            max_iou = std::max(max_iou, iou);
-            iouMatrix[actual_index * (actual_index - 1) / 2 + j] = iou;
+        for (size_t b = 0; b < a; b++) {
+            max_iou = std::max(max_iou, iouRow[b]);
         }
-        iouMax[actual_index] = max_iou;
+        iouMax[a] = max_iou;
     });
 
-    if (scoresData[candidateIndex[0]] > m_postThreshold) {
-        auto box_index = candidateIndex[0];
-        const auto* box = boxesData + box_index * 4;
-        filterBoxes[0].box.x1 = box[0];
-        filterBoxes[0].box.y1 = box[1];
-        filterBoxes[0].box.x2 = box[2];
-        filterBoxes[0].box.y2 = box[3];
-        filterBoxes[0].index = batchIdx * m_numBoxes + box_index;
-        filterBoxes[0].score = scoresData[candidateIndex[0]];
-        filterBoxes[0].batchIndex = batchIdx;
-        filterBoxes[0].classIndex = classIdx;
-        numDet++;
+    std::vector<float> decayedScores(originalSize);
+    for (int64_t i = 0; i < originalSize; i++) {
+        decayedScores[i] = scoresData[candidateIndex[i]];
+    }
+    if (m_decayFunction == MatrixNmsDecayFunction::LINEAR) {
+        decayScores<MatrixNmsDecayFunction::LINEAR>(cpu_parallel, iouMatrix, iouMax, m_gaussianSigma, decayedScores);
+    } else {
+        decayScores<MatrixNmsDecayFunction::GAUSSIAN>(cpu_parallel, iouMatrix, iouMax, m_gaussianSigma, decayedScores);
     }
 
-    for (int64_t i = 1; i < originalSize; i++) {
-        float minDecay = 1.;
-        for (int64_t j = 0; j < i; j++) {
-            auto maxIou = iouMax[j];
-            auto iou = iouMatrix[i * (i - 1) / 2 + j];
-            auto decay = m_decay_fn(iou, maxIou, m_gaussianSigma);
-            minDecay = std::min(minDecay, decay);
-        }
-        auto ds = minDecay * scoresData[candidateIndex[i]];
+    for (int64_t i = 0; i < originalSize; i++) {
+        const auto ds = decayedScores[i];
         if (ds <= m_postThreshold) {
             continue;
         }
-        auto boxIndex = candidateIndex[i];
-        const auto* box = boxesData + boxIndex * 4;
-        filterBoxes[numDet].box.x1 = box[0];
-        filterBoxes[numDet].box.y1 = box[1];
-        filterBoxes[numDet].box.x2 = box[2];
-        filterBoxes[numDet].box.y2 = box[3];
-        filterBoxes[numDet].index = batchIdx * m_numBoxes + boxIndex;
+        filterBoxes[numDet].box.x1 = x1[i];
+        filterBoxes[numDet].box.y1 = y1[i];
+        filterBoxes[numDet].box.x2 = x2[i];
+        filterBoxes[numDet].box.y2 = y2[i];
+        filterBoxes[numDet].index = batchIdx * m_numBoxes + candidateIndex[i];
         filterBoxes[numDet].score = ds;
         filterBoxes[numDet].batchIndex = batchIdx;
         filterBoxes[numDet].classIndex = classIdx;
@@ -341,7 +334,23 @@ void MatrixNms::execute([[maybe_unused]] const dnnl::stream& strm) {
     const auto* boxes = getSrcDataAtPortAs<const float>(NMS_BOXES);
     const auto* scores = getSrcDataAtPortAs<const float>(NMS_SCORES);
 
+    // boxes passing the score threshold are collected first to split the classes by the amount of nms work
+    m_candidates.resize(m_numBatches * m_numClasses);
+    std::vector<size_t> work(m_candidates.size());
     cpu_parallel->parallel_for2d(m_numBatches, m_numClasses, [&](size_t batchIdx, size_t classIdx) {
+        auto& candidates = m_candidates[batchIdx * m_numClasses + classIdx];
+        candidates.clear();
+        if (classIdx != static_cast<size_t>(m_backgroundClass)) {
+            const float* scoresPtr = scores + batchIdx * (m_numClasses * m_numBoxes) + classIdx * m_numBoxes;
+            nms_filter_scores<false>(scoresPtr, m_numBoxes, m_scoreThreshold, candidates);
+        }
+        const size_t size = std::min(candidates.size(), m_realNumBoxes);
+        work[batchIdx * m_numClasses + classIdx] = candidates.size() + size * size + 1;
+    });
+
+    nms_parallel_balanced(work, [&](size_t item) {
+        const size_t batchIdx = item / m_numClasses;
+        const size_t classIdx = item % m_numClasses;
         if (classIdx == static_cast<size_t>(m_backgroundClass)) {
             m_numPerBatchClass[batchIdx][classIdx] = 0;
             return;
@@ -354,7 +363,8 @@ void MatrixNms::execute([[maybe_unused]] const dnnl::stream& strm) {
                                 scoresPtr,
                                 m_filteredBoxes.data() + batchOffset + m_classOffset[classIdx],
                                 batchIdx,
-                                classIdx);
+                                classIdx,
+                                m_candidates[item]);
         m_numPerBatchClass[batchIdx][classIdx] = classNumDet;
     });
 
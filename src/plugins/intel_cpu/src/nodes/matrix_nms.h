@@ -9,6 +9,7 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <vector>
 
 #include "graph_context.h"
 #include "node.h"
@@ -111,7 +112,7 @@ private:
     std::vector<int> m_classOffset;
     size_t m_realNumClasses = 0;
     size_t m_realNumBoxes = 0;
-    float (*m_decay_fn)(float, float, float) = nullptr;
+    std::vector<std::vector<int32_t>> m_candidates;  // boxes passing score threshold for each class in each batch
     void checkPrecision(ov::element::Type prec,
                         const std::vector<ov::element::Type>& precList,
                         const std::string& name,
@@ -121,7 +122,8 @@ private:
                      const float* scoresData,
                      BoxInfo* filterBoxes,
                      int64_t batchIdx,
-                     int64_t classIdx);
+                     int64_t classIdx,
+                     std::vector<int32_t>& candidateIndex);
 };
 
 }  // namespace ov::intel_cpu::node
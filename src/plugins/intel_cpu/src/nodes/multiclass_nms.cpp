@@ -12,10 +12,7 @@
 #include <memory>
 #include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
-#include <queue>
 #include <string>
-#include <tuple>
-#include <utility>
 #include <vector>
 
 #include "cpu_types.h"
@@ -23,6 +20,7 @@
 #include "memory_desc/blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
+#include "nodes/common/nms_utils.hpp"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
@@ -283,11 +281,7 @@ void MultiClassNms::execute([[maybe_unused]] const dnnl::stream& strm) {
         roisnumStrides = getParentEdgeAt(NMS_ROISNUM)->getMemory().getDescWithType<BlockedMemoryDesc>()->getStrides();
     }
 
-    if ((m_nmsEta >= 0) && (m_nmsEta < 1)) {
-        nmsWithEta(boxes, scores, roisnum, boxesStrides, scoresStrides, roisnumStrides, shared);
-    } else {
-        nmsWithoutEta(boxes, scores, roisnum, boxesStrides, scoresStrides, roisnumStrides, shared);
-    }
+    nmsClasses(boxes, scores, roisnum, boxesStrides, scoresStrides, roisnumStrides, shared);
 
     size_t startOffset = m_numFiltBox[0][0];
     m_numBoxOffset[0] = 0;
@@ -465,111 +459,6 @@ bool MultiClassNms::created() const {
     return getType() == Type::MulticlassNms;
 }
 
-float MultiClassNms::intersectionOverUnion(const float* boxesI, const float* boxesJ, const bool normalized) {
-    auto [yminI, xminI, ymaxI, xmaxI] =
-        std::tuple<float, float, float, float>{boxesI[0], boxesI[1], boxesI[2], boxesI[3]};
-    auto [yminJ, xminJ, ymaxJ, xmaxJ] =
-        std::tuple<float, float, float, float>{boxesJ[0], boxesJ[1], boxesJ[2], boxesJ[3]};
-    const auto norm = static_cast<float>(!normalized);
-
-    float areaI = (ymaxI - yminI + norm) * (xmaxI - xminI + norm);
-    float areaJ = (ymaxJ - yminJ + norm) * (xmaxJ - xminJ + norm);
-    if (areaI <= 0.F || areaJ <= 0.F) {
-        return 0.F;
-    }
-
-    float intersection_area = (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ) + norm, 0.F) *
-                              (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ) + norm, 0.F);
-    return intersection_area / (areaI + areaJ - intersection_area);
-}
-
-void MultiClassNms::nmsWithEta(const float* boxes,
-                               const float* scores,
-                               const int* roisnum,
-                               const VectorDims& boxesStrides,
-                               const VectorDims& scoresStrides,
-                               const VectorDims& roisnumStrides,
-                               const bool shared) {
-    const auto& cpu_parallel = context->getCpuParallel();
-    auto less = [](const boxInfo& l, const boxInfo& r) {
-        return l.score < r.score || ((l.score == r.score) && (l.idx > r.idx));
-    };
-
-    auto func = [](float iou, float adaptive_threshold) {
-        return iou <= adaptive_threshold ? 1.0F : 0.0F;
-    };
-
-    cpu_parallel->parallel_for2d(m_numBatches, m_numClasses, [&](int batch_idx, int class_idx) {
-        if (!shared) {
-            if (roisnum[batch_idx] <= 0) {
-                m_numFiltBox[batch_idx][class_idx] = 0;
-                return;
-            }
-        }
-        if (class_idx != m_backgroundClass) {
-            std::vector<filteredBoxes> fb;
-            const float* boxesPtr =
-                slice_class(batch_idx, class_idx, boxes, boxesStrides, true, roisnum, roisnumStrides, shared);
-            const float* scoresPtr =
-                slice_class(batch_idx, class_idx, scores, scoresStrides, false, roisnum, roisnumStrides, shared);
-
-            std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
-            int cur_numBoxes = shared ? m_numBoxes : roisnum[batch_idx];
-            for (int box_idx = 0; box_idx < cur_numBoxes; box_idx++) {
-                if (scoresPtr[box_idx] >= m_scoreThreshold) {  // algin with ref
-                    sorted_boxes.emplace(boxInfo({scoresPtr[box_idx], box_idx, 0}));
-                }
-            }
-            fb.reserve(sorted_boxes.size());
-            if (!sorted_boxes.empty()) {
-                auto adaptive_threshold = m_iouThreshold;
-                int max_out_box =
-                    (static_cast<size_t>(m_nmsRealTopk) > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
-                while (max_out_box && !sorted_boxes.empty()) {
-                    boxInfo currBox = sorted_boxes.top();
-                    float origScore = currBox.score;
-                    sorted_boxes.pop();
-                    max_out_box--;
-
-                    bool box_is_selected = true;
-                    for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[currBox.idx * 4],
-                                                          &boxesPtr[fb[idx].box_index * 4],
-                                                          m_normalized);
-                        currBox.score *= func(iou, adaptive_threshold);
-                        if (iou >= adaptive_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                        if (currBox.score <= m_scoreThreshold) {
-                            break;
-                        }
-                    }
-
-                    currBox.suppress_begin_index = fb.size();
-                    if (box_is_selected) {
-                        if (m_nmsEta < 1 && adaptive_threshold > 0.5) {
-                            adaptive_threshold *= m_nmsEta;
-                        }
-                        if (currBox.score == origScore) {
-                            fb.emplace_back(currBox.score, batch_idx, class_idx, currBox.idx);
-                            continue;
-                        }
-                        if (currBox.score > m_scoreThreshold) {
-                            sorted_boxes.push(currBox);
-                        }
-                    }
-                }
-            }
-            m_numFiltBox[batch_idx][class_idx] = fb.size();
-            size_t offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
-            for (size_t i = 0; i < fb.size(); i++) {
-                m_filtBoxes[offset + i] = fb[i];
-            }
-        }
-    });
-}
-
 /* get boxes/scores for current class and image
 //                  shared         not-shared
 // boxes:      [in] N, M, 4         C, M, 4    -> [out] num_priors, 4
@@ -602,76 +491,81 @@ const float* MultiClassNms::slice_class(const int batch_idx,
     return boxesPtr_cls + boxes_idx * dataStrides[1];
 }
 
-void MultiClassNms::nmsWithoutEta(const float* boxes,
-                                  const float* scores,
-                                  const int* roisnum,
-                                  const VectorDims& boxesStrides,
-                                  const VectorDims& scoresStrides,
-                                  const VectorDims& roisnumStrides,
-                                  const bool shared) {
+void MultiClassNms::nmsClasses(const float* boxes,
+                               const float* scores,
+                               const int* roisnum,
+                               const VectorDims& boxesStrides,
+                               const VectorDims& scoresStrides,
+                               const VectorDims& roisnumStrides,
+                               const bool shared) {
     const auto& cpu_parallel = context->getCpuParallel();
+    const bool withEta = (m_nmsEta >= 0) && (m_nmsEta < 1);
+    const auto topK = static_cast<size_t>(m_nmsRealTopk);
+
+    // boxes passing the score threshold are collected first to split the classes by the amount of nms work
+    m_candidates.resize(m_numBatches * m_numClasses);
+    std::vector<size_t> work(m_candidates.size());
     cpu_parallel->parallel_for2d(m_numBatches, m_numClasses, [&](int batch_idx, int class_idx) {
-        /*
-        // nms over a class over an image
-        // boxes:       num_priors, 4
-        // scores:      num_priors, 1
-        */
-        if (!shared) {
-            if (roisnum[batch_idx] <= 0) {
-                m_numFiltBox[batch_idx][class_idx] = 0;
-                return;
-            }
-        }
-        if (class_idx != m_backgroundClass) {
-            const float* boxesPtr =
-                slice_class(batch_idx, class_idx, boxes, boxesStrides, true, roisnum, roisnumStrides, shared);
+        auto& candidates = m_candidates[batch_idx * m_numClasses + class_idx];
+        candidates.clear();
+        if ((shared || roisnum[batch_idx] > 0) && class_idx != m_backgroundClass) {
             const float* scoresPtr =
                 slice_class(batch_idx, class_idx, scores, scoresStrides, false, roisnum, roisnumStrides, shared);
+            const size_t cur_numBoxes = shared ? m_numBoxes : roisnum[batch_idx];
+            nms_filter_scores<true>(scoresPtr, cur_numBoxes, m_scoreThreshold, candidates);  // align with ref
+        }
+        const size_t maxOutBox = std::min(candidates.size(), topK);
+        work[batch_idx * m_numClasses + class_idx] = candidates.size() + maxOutBox * maxOutBox + 1;
+    });
 
-            std::vector<std::pair<float, int>> sorted_boxes;
-            int cur_numBoxes = shared ? m_numBoxes : roisnum[batch_idx];
-            for (int box_idx = 0; box_idx < cur_numBoxes; box_idx++) {
-                if (scoresPtr[box_idx] >= m_scoreThreshold) {  // align with ref
-                    sorted_boxes.emplace_back(scoresPtr[box_idx], box_idx);
-                }
+    /*
+    // nms over a class over an image
+    // boxes:       num_priors, 4
+    // scores:      num_priors, 1
+    */
+    nms_parallel_balanced(work, [&](size_t item) {
+        const auto batch_idx = static_cast<int>(item / m_numClasses);
+        const auto class_idx = static_cast<int>(item % m_numClasses);
+        auto& candidates = m_candidates[item];
+        const size_t max_out_box = std::min(candidates.size(), topK);
+        if (max_out_box == 0) {
+            m_numFiltBox[batch_idx][class_idx] = 0;
+            return;
+        }
+        const float* boxesPtr =
+            slice_class(batch_idx, class_idx, boxes, boxesStrides, true, roisnum, roisnumStrides, shared);
+        const float* scoresPtr =
+            slice_class(batch_idx, class_idx, scores, scoresStrides, false, roisnum, roisnumStrides, shared);
+
+        // only top k candidates are processed, so the rest are not sorted
+        std::partial_sort(candidates.begin(),
+                          candidates.begin() + max_out_box,
+                          candidates.end(),
+                          [scoresPtr](const int32_t l, const int32_t r) {
+                              return scoresPtr[l] > scoresPtr[r] || ((scoresPtr[l] == scoresPtr[r]) && (l < r));
+                          });
+
+        NmsSelectedBoxes selected(m_normalized ? 0.0F : 1.0F);
+        selected.reserve(max_out_box);
+        auto adaptive_threshold = m_iouThreshold;
+        const size_t offset = item * topK;
+        for (size_t i = 0; i < max_out_box; i++) {
+            const int32_t box_idx = candidates[i];
+            const float* box = boxesPtr + box_idx * 4;
+            const NmsBox candidate{box[0], box[1], box[2], box[3]};
+            // with eta the box with the score equal to the threshold is compared with the last selected box only
+            const size_t begin =
+                (withEta && scoresPtr[box_idx] <= m_scoreThreshold && selected.size() != 0) ? selected.size() - 1 : 0;
+            if (selected.overlaps(candidate, adaptive_threshold, begin)) {
+                continue;
             }
-
-            int io_selection_size = 0;
-            if (!sorted_boxes.empty()) {
-                parallel_sort(sorted_boxes.begin(),
-                              sorted_boxes.end(),
-                              [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                                  return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                              });
-                int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
-                m_filtBoxes[offset + 0] =
-                    filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-                io_selection_size++;
-                int max_out_box =
-                    (static_cast<size_t>(m_nmsRealTopk) > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
-                for (int box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4],
-                                                          &boxesPtr[m_filtBoxes[offset + idx].box_index * 4],
-                                                          m_normalized);
-                        if (iou >= m_iouThreshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
-
-                    if (box_is_selected) {
-                        m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first,
-                                                                                batch_idx,
-                                                                                class_idx,
-                                                                                sorted_boxes[box_idx].second);
-                        io_selection_size++;
-                    }
-                }
+            m_filtBoxes[offset + selected.size()] = filteredBoxes(scoresPtr[box_idx], batch_idx, class_idx, box_idx);
+            selected.push_back(candidate);
+            if (withEta && adaptive_threshold > 0.5) {
+                adaptive_threshold *= m_nmsEta;
             }
-            m_numFiltBox[batch_idx][class_idx] = io_selection_size;
         }
+        m_numFiltBox[batch_idx][class_idx] = selected.size();
     });
 }
 
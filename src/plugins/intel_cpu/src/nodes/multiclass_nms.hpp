@@ -9,6 +9,7 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <vector>
 
 #include "cpu_types.h"
 #include "graph_context.h"
@@ -92,22 +93,15 @@ private:
               box_index(_box_index) {}
     };
 
-    struct boxInfo {
-        float score;
-        int idx;
-        int suppress_begin_index;
-    };
-
     std::vector<filteredBoxes> m_filtBoxes;  // rois after nms for each class in each image
+    std::vector<std::vector<int32_t>> m_candidates;  // rois passing score threshold for each class in each image
 
     void checkPrecision(ov::element::Type prec,
                         const std::vector<ov::element::Type>& precList,
                         const std::string& name,
                         const std::string& type);
 
-    static float intersectionOverUnion(const float* boxesI, const float* boxesJ, bool normalized);
-
-    void nmsWithEta(const float* boxes,
+    void nmsClasses(const float* boxes,
                     const float* scores,
                     const int* roisnum,
                     const VectorDims& boxesStrides,
@@ -115,14 +109,6 @@ private:
                     const VectorDims& roisnumStrides,
                     bool shared);
 
-    void nmsWithoutEta(const float* boxes,
-                       const float* scores,
-                       const int* roisnum,
-                       const VectorDims& boxesStrides,
-                       const VectorDims& scoresStrides,
-                       const VectorDims& roisnumStrides,
-                       bool shared);
-
     static const float* slice_class(int batch_idx,
                                     int class_idx,
                                     const float* dataPtr,
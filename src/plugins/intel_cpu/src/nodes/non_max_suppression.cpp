@@ -14,11 +14,11 @@
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <queue>
 #include <string>
-#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -27,6 +27,7 @@
 #include "memory_desc/blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "node.h"
+#include "nodes/common/nms_utils.hpp"
 #include "nodes/kernels/x64/non_max_suppression.hpp"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
@@ -48,6 +49,27 @@
 
 namespace ov::intel_cpu::node {
 
+namespace {
+
+inline float sigmoid(const float x) {
+    return 1.F / (1.F + std::exp(-x));
+}
+
+// Logit bound, below which the sigmoid of the score doesn't pass the threshold. The threshold is lowered to cover
+// the rounding errors of the sigmoid, the exact check is done for the activated scores.
+float sigmoidInverseBound(const float threshold) {
+    const double lowered = static_cast<double>(threshold) - 1e-6;
+    if (lowered <= 0.0) {
+        return -std::numeric_limits<float>::infinity();
+    }
+    if (lowered >= 1.0) {
+        return std::numeric_limits<float>::infinity();
+    }
+    return static_cast<float>(std::log(lowered / (1.0 - lowered)));
+}
+
+}  // namespace
+
 bool NonMaxSuppression::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
                                              std::string& errorMessage) noexcept {
     try {
@@ -281,6 +303,18 @@ void NonMaxSuppression::execute([[maybe_unused]] const dnnl::stream& strm) {
     const auto& boxes_strides = boxes_memory->getDescWithType<BlockedMemoryDesc>()->getStrides();
     const auto& scores_strides = scores_memory->getDescWithType<BlockedMemoryDesc>()->getStrides();
 
+    if (m_scores_sigmoid) {
+        m_activated_scores.resize(m_batches_num * scores_strides[0]);
+        // hard suppression activates only the scores passing the threshold, the other modes read all scores
+        if (m_rotated_boxes || m_soft_nms_sigma != 0.F) {
+            const auto& cpu_parallel = context->getCpuParallel();
+            cpu_parallel->parallel_for(m_activated_scores.size(), [&](size_t i) {
+                m_activated_scores[i] = sigmoid(scores[i]);
+            });
+            scores = m_activated_scores.data();
+        }
+    }
+
     if (m_rotated_boxes) {
         nmsRotated(boxes, scores, boxes_strides, scores_strides, m_filtered_boxes);
     } else if (m_soft_nms_sigma == 0.F) {
@@ -519,16 +553,46 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float* boxes,
                                             std::vector<FilteredBox>& filtBoxes) {
     const auto& cpu_parallel = context->getCpuParallel();
     auto max_out_box = static_cast<int>(m_output_boxes_per_class);
-    cpu_parallel->parallel_for2d(m_batches_num, m_classes_num, [&](int batch_idx, int class_idx) {
+
+    // boxes passing the score threshold are collected first to split the classes by the amount of nms work
+    m_candidates.resize(m_batches_num * m_classes_num);
+    std::vector<size_t> work(m_candidates.size());
+    const float logitThreshold = m_scores_sigmoid ? sigmoidInverseBound(m_score_threshold) : 0.F;
+    cpu_parallel->parallel_for2d(m_batches_num, m_classes_num, [&](size_t batch_idx, size_t class_idx) {
+        const float* scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
+        auto& candidates = m_candidates[batch_idx * m_classes_num + class_idx];
+        if (m_scores_sigmoid) {
+            // only the logits which may pass the threshold are activated
+            float* activatedPtr = m_activated_scores.data() + (scoresPtr - scores);
+            nms_filter_scores<false>(scoresPtr, m_boxes_num, logitThreshold, candidates);
+            size_t count = 0;
+            for (const auto box_idx : candidates) {
+                activatedPtr[box_idx] = sigmoid(scoresPtr[box_idx]);
+                candidates[count] = box_idx;
+                count += static_cast<size_t>(activatedPtr[box_idx] > m_score_threshold);
+            }
+            candidates.resize(count);
+        } else {
+            nms_filter_scores<false>(scoresPtr, m_boxes_num, m_score_threshold, candidates);
+        }
+        // every candidate is compared with up to max_out_box selected boxes
+        work[batch_idx * m_classes_num + class_idx] =
+            candidates.size() * (std::min(candidates.size(), m_output_boxes_per_class) + 1) + 1;
+    });
+
+    if (m_scores_sigmoid) {
+        scores = m_activated_scores.data();
+    }
+    nms_parallel_balanced(work, [&](size_t item) {
+        const auto batch_idx = static_cast<int>(item / m_classes_num);
+        const auto class_idx = static_cast<int>(item % m_classes_num);
         const float* boxesPtr = boxes + batch_idx * boxesStrides[0];
         const float* scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
         std::vector<std::pair<float, int>> sorted_boxes;  // score, box_idx
-        sorted_boxes.reserve(m_boxes_num);
-        for (size_t box_idx = 0; box_idx < m_boxes_num; box_idx++) {
-            if (scoresPtr[box_idx] > m_score_threshold) {
-                sorted_boxes.emplace_back(scoresPtr[box_idx], box_idx);
-            }
+        sorted_boxes.reserve(m_candidates[item].size());
+        for (const auto box_idx : m_candidates[item]) {
+            sorted_boxes.emplace_back(scoresPtr[box_idx], box_idx);
         }
 
         int io_selection_size = 0;
@@ -589,20 +653,15 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float* boxes,
                     }
 #endif  // OPENVINO_ARCH_X86_64
                 } else {
+                    NmsSelectedBoxes selectedBoxes;
+                    selectedBoxes.reserve(max_out_box);
+                    selectedBoxes.push_back(getCornerBox(&boxesPtr[sorted_boxes[0].second * m_coord_num]));
                     for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box);
                          candidate_idx++) {
-                        int candidateStatus = NMSCandidateStatus::SELECTED;  // 0 for suppressed, 1 for selected
-                        for (int selected_idx = io_selection_size - 1; selected_idx >= 0; selected_idx--) {
-                            float iou = intersectionOverUnion(
-                                &boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num],
-                                &boxesPtr[filtBoxes[offset + selected_idx].box_index * m_coord_num]);
-                            if (iou >= m_iou_threshold) {
-                                candidateStatus = NMSCandidateStatus::SUPPRESSED;
-                                break;
-                            }
-                        }
-
-                        if (candidateStatus == NMSCandidateStatus::SELECTED) {
+                        const auto candidateBox =
+                            getCornerBox(&boxesPtr[sorted_boxes[candidate_idx].second * m_coord_num]);
+                        if (!selectedBoxes.overlaps(candidateBox, m_iou_threshold)) {
+                            selectedBoxes.push_back(candidateBox);
                             filtBoxes[offset + io_selection_size] = FilteredBox(sorted_boxes[candidate_idx].first,
                                                                                 batch_idx,
                                                                                 class_idx,
@@ -940,29 +999,21 @@ void NonMaxSuppression::nmsRotated(const float* boxes,
 
 /////////////// End of Rotated boxes ///////////////
 
+NmsBox NonMaxSuppression::getCornerBox(const float* box) const {
+    if (boxEncodingType == NMSBoxEncodeType::CENTER) {
+        // box format: x_center, y_center, width, height
+        return {box[1] - box[3] / 2.F, box[0] - box[2] / 2.F, box[1] + box[3] / 2.F, box[0] + box[2] / 2.F};
+    }
+    // box format: y1, x1, y2, x2
+    return {(std::min)(box[0], box[2]),
+            (std::min)(box[1], box[3]),
+            (std::max)(box[0], box[2]),
+            (std::max)(box[1], box[3])};
+}
+
 float NonMaxSuppression::intersectionOverUnion(const float* boxesI, const float* boxesJ) {
-    auto [yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ] = [&] {
-        if (boxEncodingType == NMSBoxEncodeType::CENTER) {
-            // box format: x_center, y_center, width, height
-            return std::tuple{boxesI[1] - boxesI[3] / 2.F,
-                              boxesI[0] - boxesI[2] / 2.F,
-                              boxesI[1] + boxesI[3] / 2.F,
-                              boxesI[0] + boxesI[2] / 2.F,
-                              boxesJ[1] - boxesJ[3] / 2.F,
-                              boxesJ[0] - boxesJ[2] / 2.F,
-                              boxesJ[1] + boxesJ[3] / 2.F,
-                              boxesJ[0] + boxesJ[2] / 2.F};
-        }
-        // box format: y1, x1, y2, x2
-        return std::tuple{(std::min)(boxesI[0], boxesI[2]),
-                          (std::min)(boxesI[1], boxesI[3]),
-                          (std::max)(boxesI[0], boxesI[2]),
-                          (std::max)(boxesI[1], boxesI[3]),
-                          (std::min)(boxesJ[0], boxesJ[2]),
-                          (std::min)(boxesJ[1], boxesJ[3]),
-                          (std::max)(boxesJ[0], boxesJ[2]),
-                          (std::max)(boxesJ[1], boxesJ[3])};
-    }();
+    const auto [yminI, xminI, ymaxI, xmaxI] = getCornerBox(boxesI);
+    const auto [yminJ, xminJ, ymaxJ, xmaxJ] = getCornerBox(boxesJ);
 
     float areaI = (ymaxI - yminI) * (xmaxI - xminI);
     float areaJ = (ymaxJ - yminJ) * (xmaxJ - xminJ);
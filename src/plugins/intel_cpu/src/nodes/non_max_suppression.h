@@ -5,9 +5,11 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <vector>
 
 #include "cpu_shape.h"
 #include "cpu_types.h"
@@ -15,6 +17,7 @@
 #include "kernels/x64/jit_kernel_base.hpp"
 #include "kernels/x64/non_max_suppression.hpp"
 #include "node.h"
+#include "nodes/common/nms_utils.hpp"
 #include "nodes/kernels/x64/jit_kernel_base.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/shape.hpp"
@@ -39,6 +42,13 @@ public:
 
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
 
+    /**
+     * @brief Makes the node apply Sigmoid to the scores input, see GraphOptimizer::FuseSigmoidAndNonMaxSuppression.
+     */
+    void fuseScoresSigmoid() {
+        m_scores_sigmoid = true;
+    }
+
     struct FilteredBox {
         float score;
         int batch_index;
@@ -100,6 +110,8 @@ private:
     // output
     enum : uint8_t { NMS_SELECTED_INDICES, NMS_SELECTED_SCORES, NMS_VALID_OUTPUTS };
 
+    [[nodiscard]] NmsBox getCornerBox(const float* box) const;
+
     float intersectionOverUnion(const float* boxesI, const float* boxesJ);
 
     float rotatedIntersectionOverUnion(const Point2D (&vertices_0)[4], float area_0, const float* box_1) const;
@@ -148,8 +160,12 @@ private:
     bool m_is_soft_suppressed_by_iou = false;
 
     bool m_out_static_shape = false;
+    // the scores input holds logits, sigmoid is applied by the node
+    bool m_scores_sigmoid = false;
+    std::vector<float> m_activated_scores;
 
     std::vector<std::vector<size_t>> m_num_filtered_boxes;
+    std::vector<std::vector<int32_t>> m_candidates;  // boxes passing score threshold for each class in each batch
     const std::string inType = "input";
     const std::string outType = "output";
     bool m_defined_outputs[NMS_VALID_OUTPUTS + 1] = {false, false, false};
@@ -21,6 +21,7 @@
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/shape.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "shape_inference/shape_inference_cpu.hpp"
@@ -28,6 +29,26 @@
 
 namespace ov::intel_cpu::node {
 
+namespace {
+
+/**
+ * Updates tensor to wrap the port memory. Zero-sized tensors don't reference the memory, so they own their (empty)
+ * data.
+ */
+void updatePortTensor(ov::Tensor& tensor, const ov::element::Type& type, const ov::Shape& shape, void* data) {
+    if (ov::shape_size(shape) == 0) {
+        if (!tensor || tensor.get_element_type() != type || tensor.get_shape() != shape) {
+            tensor = ov::Tensor(type, shape);
+        }
+        return;
+    }
+    if (!tensor || tensor.data() != data || tensor.get_element_type() != type || tensor.get_shape() != shape) {
+        tensor = ov::Tensor(type, shape, data);
+    }
+}
+
+}  // namespace
+
 Reference::Reference(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context, std::string errorMessage)
     : Node(op, context, NgraphShapeInferFactory(op)),
       ovCoreNode(op),
@@ -69,8 +90,8 @@ void Reference::createPrimitive() {
 }
 
 void Reference::execute([[maybe_unused]] const dnnl::stream& strm) {
-    auto inputs = prepareInputs();
-    auto outputs = prepareOutputs();
+    const auto& inputs = prepareInputs();
+    auto& outputs = prepareOutputs();
     if (!ovCoreNode->evaluate(outputs, inputs)) {
         CPU_NODE_THROW("evaluation failed for core operation: ", std::string(ovCoreNode->get_type_name()));
     }
@@ -85,38 +106,30 @@ void Reference::executeDynamicImpl(const dnnl::stream& strm) {
     }
 
     // if there is data dependency, we need to perform shape inference first
-    auto inputs = prepareInputs();
-    ov::TensorVector outputs;
+    const auto& inputs = prepareInputs();
     auto result = Node::shapeInfer();
+    ov::TensorVector* outputs = nullptr;
     if (ShapeInferStatus::success == result.status) {
         Node::redefineOutputMemory(result.dims);
-        outputs = prepareOutputs();
+        outputs = &prepareOutputs();
     } else if (ShapeInferStatus::skip == result.status) {
-        outputs.reserve(outputShapes.size());
-        for (size_t i = 0; i < outputShapes.size(); ++i) {
-            auto mem_desc = getBaseMemDescAtOutputPort(i);
-            if (mem_desc->isDefined()) {
-                outputs.emplace_back(ovCoreNode->get_output_element_type(i), mem_desc->getShape().getStaticDims());
-            } else {
-                outputs.emplace_back(ovCoreNode->get_output_element_type(i), ov::Shape{0});
-            }
-        }
+        outputs = &prepareDynamicOutputs();
     } else {
         CPU_NODE_THROW("got unexpected shape infer result status during the inference.");
     }
-    if (!ovCoreNode->evaluate(outputs, inputs)) {
+    if (!ovCoreNode->evaluate(*outputs, inputs)) {
         CPU_NODE_THROW("evaluation failed for core operation: ", std::string(ovCoreNode->get_type_name()));
     }
     if (ShapeInferStatus::skip == result.status) {
         std::vector<VectorDims> newOutputDims;
-        newOutputDims.reserve(outputs.size());
-        for (auto& tensor : outputs) {
+        newOutputDims.reserve(outputs->size());
+        for (auto& tensor : *outputs) {
             newOutputDims.emplace_back(tensor.get_shape());
         }
         Node::redefineOutputMemory(newOutputDims);
         for (size_t i = 0; i < outputShapes.size(); ++i) {
             auto memory = getDstMemoryAtPort(i);
-            auto& tensor = outputs[i];
+            auto& tensor = (*outputs)[i];
             if (memory->getSize() != tensor.get_byte_size()) {
                 CPU_NODE_THROW("output tensor data size mismatch occurred during the inference on output port number ",
                                i);
@@ -142,44 +155,49 @@ bool Reference::needShapeInfer() const {
     return !hasOutputShapeDataDependency && Node::needShapeInfer();
 }
 
-ov::TensorVector Reference::prepareInputs() const {
-    ov::TensorVector inputs;
+const ov::TensorVector& Reference::prepareInputs() {
+    inputTensors.resize(inputShapes.size());
     for (size_t i = 0LU; i < inputShapes.size(); i++) {
         void* srcDataPtr = getSrcDataAtPort(i);
         ov::Shape shape = ovCoreNode->get_input_partial_shape(i).rank().get_length() == 0
                               ? ov::Shape{}
                               : getParentEdgeAt(i)->getMemory().getStaticDims();
 
-        if (std::any_of(shape.begin(), shape.end(), [](const size_t dim) {
-                return dim == 0LU;
-            })) {
-            inputs.emplace_back(ovCoreNode->get_input_element_type(i), shape);
-        } else {
-            CPU_NODE_ASSERT(srcDataPtr, "has empty input data on port ", i);
-            inputs.emplace_back(ovCoreNode->get_input_element_type(i), shape, srcDataPtr);
-        }
+        CPU_NODE_ASSERT(srcDataPtr || ov::shape_size(shape) == 0LU, "has empty input data on port ", i);
+        updatePortTensor(inputTensors[i], ovCoreNode->get_input_element_type(i), shape, srcDataPtr);
     }
-    return inputs;
+    return inputTensors;
 }
 
-ov::TensorVector Reference::prepareOutputs() const {
-    ov::TensorVector outputs;
+ov::TensorVector& Reference::prepareOutputs() {
+    outputTensors.resize(outputShapes.size());
     for (size_t i = 0LU; i < outputShapes.size(); i++) {
         void* dstDataPtr = getDstDataAtPort(i);
         ov::Shape shape = ovCoreNode->get_output_partial_shape(i).rank().get_length() == 0
                               ? ov::Shape{}
                               : getChildEdgeAt(i)->getMemory().getStaticDims();
 
-        if (std::any_of(shape.begin(), shape.end(), [](const size_t dim) {
-                return dim == 0LU;
-            })) {
-            outputs.emplace_back(ovCoreNode->get_output_element_type(i), shape);
+        CPU_NODE_ASSERT(dstDataPtr || ov::shape_size(shape) == 0LU, "has empty output data on port ", i);
+        updatePortTensor(outputTensors[i], ovCoreNode->get_output_element_type(i), shape, dstDataPtr);
+    }
+    return outputTensors;
+}
+
+ov::TensorVector& Reference::prepareDynamicOutputs() {
+    dynamicOutputTensors.resize(outputShapes.size());
+    for (size_t i = 0; i < outputShapes.size(); ++i) {
+        auto mem_desc = getBaseMemDescAtOutputPort(i);
+        const auto shape = mem_desc->isDefined() ? ov::Shape(mem_desc->getShape().getStaticDims()) : ov::Shape{0};
+        const auto& type = ovCoreNode->get_output_element_type(i);
+        auto& tensor = dynamicOutputTensors[i];
+        if (!tensor || tensor.get_element_type() != type) {
+            tensor = ov::Tensor(type, shape);
         } else {
-            CPU_NODE_ASSERT(dstDataPtr, "has empty output data on port ", i);
-            outputs.emplace_back(ovCoreNode->get_output_element_type(i), shape, dstDataPtr);
+            // owning tensor keeps its allocation if the new shape fits
+            tensor.set_shape(shape);
         }
     }
-    return outputs;
+    return dynamicOutputTensors;
 }
 
 }  // namespace ov::intel_cpu::node
@@ -39,12 +39,19 @@ public:
     void executeDynamicImpl(const dnnl::stream& strm) override;
 
 private:
-    ov::TensorVector prepareInputs() const;
-    ov::TensorVector prepareOutputs() const;
+    const ov::TensorVector& prepareInputs();
+    ov::TensorVector& prepareOutputs();
+    ov::TensorVector& prepareDynamicOutputs();
 
     const std::shared_ptr<ov::Node> ovCoreNode;
     const std::string additionalErrorMessage;
     bool hasOutputShapeDataDependency = false;  // flag to cache the output shape data dependency check result
+
+    // tensors wrapping memory of the node ports, rebuilt only when the memory or the shape of the port changes
+    ov::TensorVector inputTensors;
+    ov::TensorVector outputTensors;
+    // owning tensors for outputs with shapes known after the evaluation, reused to keep their allocations
+    ov::TensorVector dynamicOutputTensors;
 };
 
 }  // namespace ov::intel_cpu::node
@@ -1084,8 +1084,21 @@ void RNN::fillBiases() {
 }
 
 void RNN::prepareMemory(const DnnlMemoryDescPtr& new_desc, size_t idx) {
+    internalBlobMemory[idx] = getPackedWeights(new_desc, idx);
+}
+
+MemoryPtr RNN::getPackedWeights(const DnnlMemoryDescPtr& new_desc, size_t idx) {
     CPU_NODE_ASSERT(idx < 3LU, "got invalid weights index: ", idx);
 
+    // primitives of different sequence lengths mostly share the weights layout, so each layout is packed once
+    auto& packed = m_packed_weights[idx];
+    auto it = std::find_if(packed.begin(), packed.end(), [&](const MemoryPtr& mem) {
+        return new_desc->isCompatible(mem->getDesc());
+    });
+    if (it != packed.end()) {
+        return *it;
+    }
+
     auto create = [&]() {
         Memory memory{getEngine(), m_initial_weights[idx]->getDescPtr(), m_initial_weights[idx]->getData()};
         MemoryPtr res_ptr = std::make_shared<Memory>(getEngine(), new_desc);
@@ -1096,18 +1109,17 @@ void RNN::prepareMemory(const DnnlMemoryDescPtr& new_desc, size_t idx) {
         return res_ptr;
     };
 
-    MemoryPtr res_ptr;
     if (auto weight_cache = context->getWeightsCache()) {
         const std::string hash_str =
             getName() + "_" + std::to_string(idx) + "_" +
             std::to_string(dnnl::impl::primitive_hashing::get_md_hash(*new_desc->getDnnlDesc().get()));
-        res_ptr = MemoryPtr(*weight_cache->findOrCreate(hash_str, create));
+        auto res_ptr = MemoryPtr(*weight_cache->findOrCreate(hash_str, create));
         m_weights_pull.insert(res_ptr);
-    } else {
-        res_ptr = MemoryPtr(create());
+        packed.push_back(res_ptr);
+        return res_ptr;
     }
-
-    internalBlobMemory[idx] = std::move(res_ptr);
+    packed.push_back(create());
+    return packed.back();
 }
 
 void RNN::copyWeightsData() {
@@ -1356,19 +1368,7 @@ Node::AttrPtr RNN::initPrimitiveAttr() {
     return attr;
 }
 
-void RNN::prepareParams() {
-    for (size_t i = 0; i < wIdx; i++) {
-        auto memPtr = getSrcMemoryAtPort(i);
-        CPU_NODE_ASSERT(memPtr && memPtr->isDefined(), "has uninitialized memory at port ", i);
-    }
-    if ((is_cell && DC != getParentEdgeAt(0)->getMemory().getDesc().getShape().getStaticDims()[1]) ||
-        (!is_cell && DC != getParentEdgeAt(0)->getMemory().getDesc().getShape().getStaticDims()[2])) {
-        CPU_NODE_THROW("has incorrect input size value in the first input.");
-    }
-
-    auto dataMemPtr = getSrcMemoryAtPort(0);
-    const size_t B = dataMemPtr->getShape().getStaticDims()[0];
-    const size_t SL = is_cell ? 1LU : dataMemPtr->getShape().getStaticDims()[1];
+RNN::executorPtr RNN::createExecutor(const size_t SL, const size_t B) {
     const Shape shapeS_4D{L, D, B, SC};
 
     inDataDescs[0] =
@@ -1408,8 +1408,33 @@ void RNN::prepareParams() {
 
     auto cache = context->getParamsCache();
     auto result = cache->getOrCreate(key, builder);
+    return result.first;
+}
+
+void RNN::prepareParams() {
+    for (size_t i = 0; i < wIdx; i++) {
+        auto memPtr = getSrcMemoryAtPort(i);
+        CPU_NODE_ASSERT(memPtr && memPtr->isDefined(), "has uninitialized memory at port ", i);
+    }
+    if ((is_cell && DC != getParentEdgeAt(0)->getMemory().getDesc().getShape().getStaticDims()[1]) ||
+        (!is_cell && DC != getParentEdgeAt(0)->getMemory().getDesc().getShape().getStaticDims()[2])) {
+        CPU_NODE_THROW("has incorrect input size value in the first input.");
+    }
+
+    auto dataMemPtr = getSrcMemoryAtPort(0);
+    const size_t B = dataMemPtr->getShape().getStaticDims()[0];
+    const size_t SL = is_cell ? 1LU : dataMemPtr->getShape().getStaticDims()[1];
+
+    m_sequenceChunks.clear();
+    if (canSplitSequence()) {
+        prepareSequenceChunks(SL, B);
+        if (!m_sequenceChunks.empty()) {
+            return;
+        }
+    }
+
     auto prevExecPtr = execPtr;
-    execPtr = result.first;
+    execPtr = createExecutor(SL, B);
 
     CPU_NODE_ASSERT(execPtr, "does not have primitive descriptor.");
 
@@ -1453,12 +1478,18 @@ std::shared_ptr<MemoryDesc> RNN::getDstMemDesc([[maybe_unused]] const dnnl::prim
 }
 
 void RNN::execute(const dnnl::stream& strm) {
+    if (!m_sequenceChunks.empty()) {
+        executeSequenceChunks(strm);
+        return;
+    }
+
     CPU_NODE_ASSERT(execPtr, "does not have initialized primitive to execute.");
 
     const auto src_data_mem = getSrcMemoryAtPort(0);
     const auto dst_data_mem = getDstMemoryAtPort(0);
 
-    auto args = primArgs;
+    // the arguments are updated in place, so the argument map isn't copied on every step of a streaming model
+    auto& args = primArgs;
 
     args[DNNL_ARG_SRC_LAYER] = src_data_mem->getPrimitive();
     args[DNNL_ARG_DST_LAYER] = dst_data_mem->getPrimitive();
@@ -1489,6 +1520,97 @@ void RNN::execute(const dnnl::stream& strm) {
     execPtr->exec(args, strm);
 }
 
+bool RNN::canSplitSequence() const {
+    // the chunks pass the states through the memory of the state data type, which is exact for floating point states
+    // of a single direction only
+    const bool sameStateTypes = inDataTypes[hIdx] == outDataTypes[hoIdx] &&
+                                (!haveCellState(cell_type) || inDataTypes[cIdx] == outDataTypes[coIdx]);
+    return !is_cell && !is_augru && !T.isStatic() && sameStateTypes &&
+           none_of(inDataTypes[xIdx], memory::data_type::u8, memory::data_type::s8) &&
+           any_of(direction, rnn_direction::unidirectional_left2right, rnn_direction::unidirectional_right2left);
+}
+
+void RNN::prepareSequenceChunks(const size_t SL, const size_t B) {
+    std::vector<size_t> lengths;
+    for (size_t rest = SL; rest != 0;) {
+        size_t length = 1;
+        while (length * 2 <= rest) {
+            length *= 2;
+        }
+        lengths.push_back(length);
+        rest -= length;
+    }
+    if (lengths.size() < 2) {
+        return;
+    }
+
+    const size_t srcStep = B * DC * DnnlExtensionUtils::sizeOfDataType(inDataTypes[xIdx]);
+    const size_t dstStep = B * D * SC * DnnlExtensionUtils::sizeOfDataType(outDataTypes[yIdx]);
+    DnnlMemoryDescPtr scratchpadDesc;
+    size_t offset = 0;
+    for (const auto length : lengths) {
+        SequenceChunk chunk;
+        chunk.exec = createExecutor(length, B);
+        CPU_NODE_ASSERT(chunk.exec, "does not have primitive descriptor.");
+        chunk.srcOffset = offset * srcStep;
+        chunk.dstOffset = offset * dstStep;
+        chunk.weights = {getPackedWeights(chunk.exec->getWeightDesc(), 0),
+                         getPackedWeights(chunk.exec->getWeightIterDesc(), 1),
+                         getPackedWeights(chunk.exec->getBiasDesc(), 2)};
+        chunk.args[DNNL_ARG_WEIGHTS_LAYER] = chunk.weights[0]->getPrimitive();
+        chunk.args[DNNL_ARG_WEIGHTS_ITER] = chunk.weights[1]->getPrimitive();
+        chunk.args[DNNL_ARG_BIAS] = chunk.weights[2]->getPrimitive();
+        chunk.args[DNNL_ARG_SRC_LAYER] = dnnl::memory(chunk.exec->getDnnlSrcDesc(), getEngine(), nullptr);
+        chunk.args[DNNL_ARG_DST_LAYER] = dnnl::memory(chunk.exec->getDnnlDstDesc(), getEngine(), nullptr);
+
+        const auto& chunkScratchpadDesc = chunk.exec->getScratchPadDesc();
+        if (!scratchpadDesc || chunkScratchpadDesc->getCurrentMemSize() > scratchpadDesc->getCurrentMemSize()) {
+            scratchpadDesc = chunkScratchpadDesc;
+        }
+        m_sequenceChunks.push_back(std::move(chunk));
+        offset += length;
+    }
+    // right to left direction starts from the end of the sequence
+    if (direction == rnn_direction::unidirectional_right2left) {
+        std::reverse(m_sequenceChunks.begin(), m_sequenceChunks.end());
+    }
+
+    // the chunks are executed one by one, so they share the largest scratchpad
+    auto scratchpadMem = getScratchPadMem(scratchpadDesc);
+    for (auto& chunk : m_sequenceChunks) {
+        chunk.args[DNNL_ARG_SCRATCHPAD] = scratchpadMem->getPrimitive();
+    }
+
+    m_chunkStates.clear();
+    for (size_t s = 0; s < S; s++) {
+        m_chunkStates.push_back(std::make_shared<Memory>(getEngine(), outDataDescs[s + 1]));
+        m_chunkStates.push_back(std::make_shared<Memory>(getEngine(), outDataDescs[s + 1]));
+    }
+}
+
+void RNN::executeSequenceChunks(const dnnl::stream& strm) {
+    auto* src = getSrcDataAtPortAs<uint8_t>(0);
+    auto* dst = getDstDataAtPortAs<uint8_t>(0);
+
+    int state_i_tags[]{DNNL_ARG_SRC_ITER, DNNL_ARG_SRC_ITER_C};
+    int state_o_tags[]{DNNL_ARG_DST_ITER, DNNL_ARG_DST_ITER_C};
+    const size_t n_ports_with_init_states = outputShapes.size() - 1;  // first is a sequence data
+    for (size_t i = 0; i < m_sequenceChunks.size(); i++) {
+        auto& chunk = m_sequenceChunks[i];
+        const bool isLast = i + 1 == m_sequenceChunks.size();
+        chunk.args[DNNL_ARG_SRC_LAYER].set_data_handle(src + chunk.srcOffset);
+        chunk.args[DNNL_ARG_DST_LAYER].set_data_handle(dst + chunk.dstOffset);
+        for (size_t s = 0; s < S; s++) {
+            chunk.args[state_i_tags[s]] = i == 0 ? getSrcMemoryAtPort(s + 1)->getPrimitive()
+                                                 : m_chunkStates[2 * s + (i - 1) % 2]->getPrimitive();
+            chunk.args[state_o_tags[s]] = isLast && s < n_ports_with_init_states
+                                              ? getDstMemoryAtPort(s + 1)->getPrimitive()
+                                              : m_chunkStates[2 * s + i % 2]->getPrimitive();
+        }
+        chunk.exec->exec(chunk.args, strm);
+    }
+}
+
 void RNN::executeDynamicImpl(const dnnl::stream& strm) {
     execute(strm);
 }
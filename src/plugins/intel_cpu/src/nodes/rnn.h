@@ -73,6 +73,12 @@ private:
     void copyWeightsData();
 
     void prepareMemory(const DnnlMemoryDescPtr& new_desc, size_t idx) override;
+    MemoryPtr getPackedWeights(const DnnlMemoryDescPtr& new_desc, size_t idx);
+
+    bool canSplitSequence() const;
+    void prepareSequenceChunks(size_t SL, size_t B);
+    void executeSequenceChunks(const dnnl::stream& strm);
+
     class RnnDnnlExecutor : public DnnlExecutorLegacy {
     public:
         explicit RnnDnnlExecutor(const dnnl::primitive_desc& pd);
@@ -93,6 +99,23 @@ private:
     using executorPtr = std::shared_ptr<RnnDnnlExecutor>;
     executorPtr execPtr = nullptr;
 
+    executorPtr createExecutor(size_t SL, size_t B);
+
+    /**
+     * Part of the sequence of dynamic length executed by its own primitive. The chunks have power of two lengths, so
+     * sequences of any length are executed by primitives of at most log2(T) shapes, which are created once.
+     */
+    struct SequenceChunk {
+        executorPtr exec;
+        size_t srcOffset = 0;  // in bytes
+        size_t dstOffset = 0;  // in bytes
+        std::vector<MemoryPtr> weights;
+        std::unordered_map<int, dnnl::memory> args;
+    };
+    std::vector<SequenceChunk> m_sequenceChunks;
+    // ping-pong buffers passing states between the chunks
+    std::vector<MemoryPtr> m_chunkStates;
+
     /** Specify mode Cell or Seq. true - Cell, false - Seq */
     bool is_cell = false;
 
@@ -169,6 +192,8 @@ private:
     MemoryPtr m_initial_weights[3] = {nullptr, nullptr, nullptr};
     // Need to keep cache objects. Otherwise, they will be erased from the global cache.
     std::unordered_set<MemoryPtr> m_weights_pull;
+    // Packed weights, biases and recurrent weights of every layout requested by the primitives.
+    std::vector<MemoryPtr> m_packed_weights[3];
 };
 
 }  // namespace ov::intel_cpu::node
@@ -4,6 +4,8 @@
 
 #include "search_sorted.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
@@ -17,14 +19,15 @@
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/shape.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/op/search_sorted.hpp"
-#include "openvino/reference/search_sorted.hpp"
 #include "selective_build.h"
 #include "shape_inference/shape_inference_cpu.hpp"
 #include "utils/general_utils.h"
+#include "utils/sorted_search.hpp"
 
 namespace ov::intel_cpu::node {
 SearchSorted::SearchSorted(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
@@ -94,12 +97,35 @@ void SearchSorted::executeDynamicImpl(const dnnl::stream& strm) {
 
 template <typename INPUT_TYPE, typename OUTPUT_TYPE>
 void SearchSorted::executeImpl() {
-    ov::reference::search_sorted<INPUT_TYPE, OUTPUT_TYPE>(getSrcDataAtPortAs<const INPUT_TYPE>(0),
-                                                          getSrcDataAtPortAs<const INPUT_TYPE>(1),
-                                                          getDstDataAtPortAs<OUTPUT_TYPE>(0),
-                                                          ov::Shape{getSrcMemoryAtPort(0)->getStaticDims()},
-                                                          ov::Shape{getSrcMemoryAtPort(1)->getStaticDims()},
-                                                          right_mode);
+    const auto* sorted = getSrcDataAtPortAs<const INPUT_TYPE>(0);
+    const auto* values = getSrcDataAtPortAs<const INPUT_TYPE>(1);
+    auto* output = getDstDataAtPortAs<OUTPUT_TYPE>(0);
+    const auto& sortedDims = getSrcMemoryAtPort(0)->getStaticDims();
+    const auto& valuesDims = getSrcMemoryAtPort(1)->getStaticDims();
+
+    const size_t sortedLen = sortedDims.back();
+    const size_t valuesLen = valuesDims.empty() ? 1 : valuesDims.back();
+    const size_t valuesNum = shape_size(valuesDims);
+    if (valuesNum == 0) {
+        return;
+    }
+    // 1D sorted sequence is shared by all values, otherwise leading dimensions of the inputs are equal
+    const bool sharedSorted = sortedDims.size() == 1;
+    const size_t rows = valuesNum / valuesLen;
+    const size_t chunks = div_up(valuesLen, VALUES_CHUNK);
+
+    const auto& cpu_parallel = context->getCpuParallel();
+    cpu_parallel->parallel_for2d(rows, chunks, [&](size_t row, size_t chunk) {
+        const auto* rowSorted = sharedSorted ? sorted : sorted + row * sortedLen;
+        const size_t start = chunk * VALUES_CHUNK;
+        const size_t num = std::min(VALUES_CHUNK, valuesLen - start);
+        const size_t offset = row * valuesLen + start;
+        if (right_mode) {
+            sorted_rank_range<true>(rowSorted, sortedLen, values + offset, num, output + offset);
+        } else {
+            sorted_rank_range<false>(rowSorted, sortedLen, values + offset, num, output + offset);
+        }
+    });
 }
 
 namespace {
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
@@ -34,6 +35,9 @@ private:
     struct SearchSortedExecute;
 
     bool right_mode = false;
+
+    // number of values searched by one task, values of a chunk share the sorted sequence
+    static constexpr size_t VALUES_CHUNK = 256;
 };
 
 }  // namespace ov::intel_cpu::node
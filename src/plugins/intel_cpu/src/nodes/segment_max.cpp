@@ -4,12 +4,16 @@
 
 #include "segment_max.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <vector>
 
 #include "cpu_types.h"
 #include "graph_context.h"
@@ -24,9 +28,9 @@
 #include "openvino/core/type/float16.hpp"
 #include "openvino/op/segment_max.hpp"
 #include "openvino/op/util/attr_types.hpp"
-#include "openvino/reference/segment_max.hpp"
 #include "selective_build.h"
 #include "shape_inference/shape_inference_cpu.hpp"
+#include "utils/general_utils.h"
 
 namespace ov::intel_cpu::node {
 SegmentMax::SegmentMax(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
@@ -134,15 +138,57 @@ bool SegmentMax::needShapeInfer() const {
 
 template <class T>
 void SegmentMax::executeImpl() {
-    const auto& data_shape = getSrcMemoryAtPort(0)->getStaticDims();
-    const auto& output_shape = getDstMemoryAtPort(0)->getShape().getStaticDims();
-    const auto empty_segment_value = fillMode == ov::op::FillMode::ZERO ? T(0) : std::numeric_limits<T>::lowest();
-    ov::reference::segment_max(getSrcDataAtPortAs<const T>(0),
-                               data_shape,
-                               getSrcDataAtPortAs<const int32_t>(1),
-                               getDstDataAtPortAs<T>(0),
-                               output_shape,
-                               empty_segment_value);
+    const auto& dataShape = getSrcMemoryAtPort(0)->getStaticDims();
+    const auto& outputShape = getDstMemoryAtPort(0)->getShape().getStaticDims();
+    const auto* data = getSrcDataAtPortAs<const T>(0);
+    const auto* segmentIds = getSrcDataAtPortAs<const int32_t>(1);
+    auto* output = getDstDataAtPortAs<T>(0);
+    const auto emptySegmentValue = fillMode == ov::op::FillMode::ZERO ? T(0) : std::numeric_limits<T>::lowest();
+
+    const size_t rowsNum = dataShape[0];
+    const size_t segmentsNum = outputShape[0];
+    const size_t innerLen = std::accumulate(dataShape.begin() + 1, dataShape.end(), size_t{1}, std::multiplies<>());
+    if (segmentsNum == 0 || innerLen == 0) {
+        return;
+    }
+
+    // Rows are grouped by segments with counting sort, so every output row is reduced by a single thread
+    // regardless of the order of segment ids. Rows of segments out of range are skipped.
+    std::vector<size_t> segmentRowsBegin(segmentsNum + 1, 0);
+    for (size_t r = 0; r < rowsNum; r++) {
+        if (segmentIds[r] >= 0 && static_cast<size_t>(segmentIds[r]) < segmentsNum) {
+            segmentRowsBegin[segmentIds[r] + 1]++;
+        }
+    }
+    std::partial_sum(segmentRowsBegin.begin(), segmentRowsBegin.end(), segmentRowsBegin.begin());
+    std::vector<size_t> segmentRows(segmentRowsBegin.back());
+    std::vector<size_t> segmentRowsEnd(segmentRowsBegin.begin(), segmentRowsBegin.end() - 1);
+    for (size_t r = 0; r < rowsNum; r++) {
+        if (segmentIds[r] >= 0 && static_cast<size_t>(segmentIds[r]) < segmentsNum) {
+            segmentRows[segmentRowsEnd[segmentIds[r]]++] = r;
+        }
+    }
+
+    const size_t chunksNum = div_up(innerLen, INNER_CHUNK);
+    const auto& cpu_parallel = context->getCpuParallel();
+    cpu_parallel->parallel_for2d(segmentsNum, chunksNum, [&](size_t s, size_t c) {
+        const size_t start = c * INNER_CHUNK;
+        const size_t len = std::min(INNER_CHUNK, innerLen - start);
+        T* dst = output + s * innerLen + start;
+        const size_t rowsBegin = segmentRowsBegin[s];
+        const size_t rowsEnd = segmentRowsBegin[s + 1];
+        if (rowsBegin == rowsEnd) {
+            std::fill(dst, dst + len, emptySegmentValue);
+            return;
+        }
+        std::fill(dst, dst + len, std::numeric_limits<T>::lowest());
+        for (size_t r = rowsBegin; r < rowsEnd; r++) {
+            const T* src = data + segmentRows[r] * innerLen + start;
+            for (size_t i = 0; i < len; i++) {
+                dst[i] = src[i] > dst[i] ? src[i] : dst[i];
+            }
+        }
+    });
 }
 
 namespace {
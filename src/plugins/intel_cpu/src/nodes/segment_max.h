@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <vector>
 
 #include "graph_context.h"
 #include "node.h"
@@ -38,6 +41,9 @@ private:
     ov::op::FillMode fillMode;
     std::vector<int32_t> lastSegmentIds;
     std::vector<int32_t> lastNumSegments;
+
+    // number of elements of output row reduced by one task
+    static constexpr size_t INNER_CHUNK = 1024;
 };
 
 }  // namespace ov::intel_cpu::node
@@ -4,6 +4,8 @@
 
 #include "string_tensor_pack.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
@@ -20,11 +22,16 @@
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/string_tensor_pack.hpp"
-#include "openvino/reference/string_tensor_pack.hpp"
 #include "selective_build.h"
 #include "shape_inference/shape_inference_cpu.hpp"
+#include "utils/general_utils.h"
 
 namespace ov::intel_cpu::node {
+namespace {
+// strings are short, so a thread processes a chunk of them to amortize the scheduling
+constexpr size_t STRINGS_CHUNK = 256;
+}  // namespace
+
 StringTensorPack::StringTensorPack(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
     : Node(op, context, NgraphShapeInferFactory(op)) {
     std::string errorMessage;
@@ -76,12 +83,18 @@ void StringTensorPack::executeDynamicImpl(const dnnl::stream& strm) {
 
 template <class T_idx>
 void StringTensorPack::executeImpl() {
-    const auto& data_shape = getSrcMemoryAtPort(0)->getStaticDims();
-    ov::reference::string_tensor_pack(getSrcDataAtPortAs<const T_idx>(0),
-                                      getSrcDataAtPortAs<const T_idx>(1),
-                                      getSrcDataAtPortAs<const uint8_t>(2),
-                                      getDstDataAtPortAs<std::string>(0),
-                                      ov::shape_size(data_shape));
+    const size_t stringCount = ov::shape_size(getSrcMemoryAtPort(0)->getStaticDims());
+    const auto* begins = getSrcDataAtPortAs<const T_idx>(0);
+    const auto* ends = getSrcDataAtPortAs<const T_idx>(1);
+    const auto* chars = getSrcDataAtPortAs<const char>(2);
+    auto* dstData = getDstDataAtPortAs<std::string>(0);
+    // output strings keep their capacity between inferences, so assigning reallocates only the grown strings
+    context->getCpuParallel()->parallel_for(div_up(stringCount, STRINGS_CHUNK), [&](size_t chunk) {
+        const size_t end = std::min(stringCount, (chunk + 1) * STRINGS_CHUNK);
+        for (size_t i = chunk * STRINGS_CHUNK; i < end; ++i) {
+            dstData[i].assign(chars + begins[i], chars + ends[i]);
+        }
+    });
 }
 
 namespace {
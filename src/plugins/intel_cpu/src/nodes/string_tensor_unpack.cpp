@@ -4,11 +4,10 @@
 
 #include "string_tensor_unpack.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
 #include <memory>
-#include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 
@@ -23,10 +22,15 @@
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/string_tensor_unpack.hpp"
-#include "openvino/reference/string_tensor_unpack.hpp"
 #include "shape_inference/shape_inference_internal_dyn.hpp"
+#include "utils/general_utils.h"
 
 namespace ov::intel_cpu::node {
+namespace {
+// strings are short, so a thread processes a chunk of them to amortize the scheduling
+constexpr size_t STRINGS_CHUNK = 256;
+}  // namespace
+
 StringTensorUnpack::StringTensorUnpack(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
     : Node(op, context, InternalDynShapeInferFactory()) {
     std::string errorMessage;
@@ -74,22 +78,40 @@ bool StringTensorUnpack::needPrepareParams() const {
 void StringTensorUnpack::executeDynamicImpl(const dnnl::stream& strm) {
     const auto& srcMemory = getSrcMemoryAtPort(0);
     const auto& srcDataDims = srcMemory->getStaticDims();
-    const auto& srcData = srcMemory->getDataAs<std::string>();
-    Dim stringCount = std::accumulate(srcDataDims.begin(), srcDataDims.end(), 1, std::multiplies<>());
-    size_t totalCharLength = 0;
-    for (Dim i = 0; i < stringCount; ++i) {
-        totalCharLength += srcData[i].length();
-    }
+    const auto* srcData = srcMemory->getDataAs<const std::string>();
+    const size_t stringCount = ov::shape_size(srcDataDims);
+    const size_t totalCharLength =
+        context->getCpuParallel()->parallel_sum(div_up(stringCount, STRINGS_CHUNK), size_t{0}, [&](size_t chunk) {
+            const size_t end = std::min(stringCount, (chunk + 1) * STRINGS_CHUNK);
+            size_t length = 0;
+            for (size_t i = chunk * STRINGS_CHUNK; i < end; ++i) {
+                length += srcData[i].length();
+            }
+            return length;
+        });
     redefineOutputMemory({srcDataDims, srcDataDims, {totalCharLength}});
     execute(strm);
 }
 
 void StringTensorUnpack::execute([[maybe_unused]] const dnnl::stream& strm) {
-    const auto stringCount = ov::shape_size(getSrcMemoryAtPort(0)->getStaticDims());
-    ov::reference::string_tensor_unpack(getSrcDataAtPortAs<const std::string>(0),
-                                        getDstDataAtPortAs<int32_t>(0),
-                                        getDstDataAtPortAs<int32_t>(1),
-                                        getDstDataAtPortAs<uint8_t>(2),
-                                        stringCount);
+    const size_t stringCount = ov::shape_size(getSrcMemoryAtPort(0)->getStaticDims());
+    const auto* srcData = getSrcDataAtPortAs<const std::string>(0);
+    auto* begins = getDstDataAtPortAs<int32_t>(0);
+    auto* ends = getDstDataAtPortAs<int32_t>(1);
+    auto* symbols = getDstDataAtPortAs<uint8_t>(2);
+
+    // offsets are computed first, so the strings are copied into the symbols independently
+    int32_t offset = 0;
+    for (size_t i = 0; i < stringCount; ++i) {
+        begins[i] = offset;
+        offset += static_cast<int32_t>(srcData[i].length());
+        ends[i] = offset;
+    }
+    context->getCpuParallel()->parallel_for(div_up(stringCount, STRINGS_CHUNK), [&](size_t chunk) {
+        const size_t end = std::min(stringCount, (chunk + 1) * STRINGS_CHUNK);
+        for (size_t i = chunk * STRINGS_CHUNK; i < end; ++i) {
+            std::copy(srcData[i].begin(), srcData[i].end(), symbols + begins[i]);
+        }
+    });
 }
 }  // namespace ov::intel_cpu::node
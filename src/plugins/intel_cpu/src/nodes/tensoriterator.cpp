@@ -11,6 +11,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <exception>
 #include <functional>
 #include <memory>
 #include <numeric>
@@ -37,8 +38,14 @@
 #include "openvino/core/node.hpp"
 #include "openvino/core/parallel.hpp"
 #include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/op/loop.hpp"
+#include "openvino/op/random_uniform.hpp"
 #include "openvino/op/tensor_iterator.hpp"
+#include "openvino/op/util/assign_base.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/op/util/read_value_base.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
 #include "shape_inference/shape_inference_internal_dyn.hpp"
 #include "utils/debug_capabilities.h"
@@ -170,6 +177,81 @@ private:
     int iter_count;
 };
 
+/**
+ * Copies iteration slices between plain dense tensors row by row. Unlike the reorder based PortIteratorHelper it
+ * doesn't use the stream, so bodies executing iterations concurrently may use it.
+ */
+class PortSliceCopyHelper : public PortMapHelper {
+public:
+    PortSliceCopyHelper(MemoryPtr from, MemoryPtr to, bool sliced_src, const PortMap& slice_rule)
+        : full_blob(sliced_src ? from : to),
+          part_blob(sliced_src ? to : from),
+          sliced_src(sliced_src) {
+        const auto axis = slice_rule.axis;
+        const auto abs_stride = static_cast<size_t>(std::abs(slice_rule.stride));
+
+        auto full_dims = full_blob->getStaticDims();
+        const auto& part_dims = part_blob->getStaticDims();
+
+        iter_count = static_cast<int>(full_dims[axis] / abs_stride);
+        const auto inner_size = std::accumulate(full_dims.begin() + axis + 1,
+                                                full_dims.end(),
+                                                full_blob->getDesc().getPrecision().size(),
+                                                std::multiplies<>());
+        rows =
+            std::accumulate(full_dims.begin(), full_dims.begin() + axis, static_cast<size_t>(1), std::multiplies<>());
+        full_row_in_byte = full_dims[axis] * inner_size;
+        chunk_in_byte = abs_stride * inner_size;
+
+        full_dims[axis] = abs_stride;
+        OPENVINO_ASSERT(full_dims == part_dims, "Shape mismatch for tensor iterator port");
+
+        chunk_stride_in_byte = static_cast<ptrdiff_t>(chunk_in_byte);
+        if (slice_rule.stride < 0) {
+            chunk_offset_in_byte = (iter_count - 1) * chunk_stride_in_byte;
+            chunk_stride_in_byte = -chunk_stride_in_byte;
+        }
+    }
+
+    static bool isApplicable(const MemoryPtr& from, const MemoryPtr& to) {
+        const auto isPlainDense = [](const MemoryPtr& mem) {
+            const auto& desc = mem->getDesc();
+            return desc.isDefined() && desc.hasLayoutType(LayoutType::ncsp) &&
+                   desc.getCurrentMemSize() == desc.getShape().getElementsCount() * desc.getPrecision().size();
+        };
+        const auto precision = from->getDesc().getPrecision();
+        return precision == to->getDesc().getPrecision() && precision != ov::element::string && isPlainDense(from) &&
+               isPlainDense(to);
+    }
+
+    void execute([[maybe_unused]] const dnnl::stream& strm, int iter) override {
+        OPENVINO_ASSERT(iter >= 0 && iter < iter_count);
+
+        auto* full = full_blob->getDataAs<uint8_t>() + chunk_offset_in_byte + chunk_stride_in_byte * iter;
+        auto* part = part_blob->getDataAs<uint8_t>();
+        for (size_t i = 0; i < rows; i++) {
+            if (sliced_src) {
+                cpu_memcpy(part + i * chunk_in_byte, full + i * full_row_in_byte, chunk_in_byte);
+            } else {
+                cpu_memcpy(full + i * full_row_in_byte, part + i * chunk_in_byte, chunk_in_byte);
+            }
+        }
+    }
+
+private:
+    MemoryPtr full_blob;
+    MemoryPtr part_blob;
+    bool sliced_src;
+
+    size_t rows = 0;
+    size_t full_row_in_byte = 0;
+    size_t chunk_in_byte = 0;
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    int iter_count = 0;
+};
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(const MultiCachePtr& cache, const MemoryPtr& from, const MemoryPtr& to) {
@@ -427,6 +509,58 @@ void DynamicBuffer::copy(const uint8_t* src,
     });
 }
 
+static void collectBodyMemories(Graph& graph,
+                                const std::shared_ptr<const ov::Model>& body,
+                                std::vector<std::vector<MemoryPtr>>& input_mems,
+                                std::vector<MemoryPtr>& output_mem) {
+    for (const auto& param : body->get_parameters()) {
+        if (auto inNode = graph.getInputNodeByIndex(body->get_parameter_index(param))) {
+            input_mems.push_back(getToMemories(inNode.get(), 0));
+        }
+    }
+
+    for (const auto& out : body->get_results()) {
+        if (auto outNode = graph.getOutputNodeByIndex(body->get_result_index(out))) {
+            output_mem.push_back(outNode->getSrcMemoryAtPort(0));
+        }
+    }
+}
+
+// replicas multiply the memory and the compilation time of the body, and large bodies parallelize inside their nodes
+constexpr int maxParallelBodies = 8;
+constexpr size_t maxParallelBodyOps = 64;
+
+// a condition output computed by a true constant doesn't make iterations depend on each other
+static bool isAlwaysTrueCondition(const std::shared_ptr<const ov::Model>& body, const int conditionOutputIdx) {
+    const auto constant =
+        ov::as_type_ptr<ov::op::v0::Constant>(body->get_results()[conditionOutputIdx]->get_input_node_shared_ptr(0));
+    if (!constant) {
+        return false;
+    }
+    const auto values = constant->cast_vector<bool>();
+    return std::all_of(values.begin(), values.end(), [](const bool value) {
+        return value;
+    });
+}
+
+// iterations of a body with states or random generators depend on the previous ones even without back edges
+static bool hasIterationState(const std::shared_ptr<const ov::Model>& body) {
+    const auto ops = body->get_ops();
+    return std::any_of(ops.begin(), ops.end(), [](const std::shared_ptr<ov::Node>& op) {
+        if (ov::is_type<ov::op::util::ReadValueBase>(op) || ov::is_type<ov::op::util::AssignBase>(op) ||
+            ov::is_type<ov::op::v8::RandomUniform>(op)) {
+            return true;
+        }
+        if (auto multiSubGraphOp = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(op)) {
+            const auto& bodies = multiSubGraphOp->get_functions();
+            return std::any_of(bodies.begin(), bodies.end(), [](const std::shared_ptr<ov::Model>& inner) {
+                return hasIterationState(inner);
+            });
+        }
+        return false;
+    });
+}
+
 bool TensorIterator::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
                                           std::string& errorMessage) noexcept {
     try {
@@ -470,18 +604,7 @@ void TensorIterator::createPrimitive() {
     auto subgraphOp = ov::as_type_ptr<const ov::op::util::SubGraphOp>(ngraphOp);
     CPU_NODE_ASSERT(subgraphOp, "cannot be cast to ov::op::util::SubGraphOp");
 
-    for (const auto& param : subgraphOp->get_function()->get_parameters()) {
-        if (auto inNode = sub_graph.getInputNodeByIndex(subgraphOp->get_function()->get_parameter_index(param))) {
-            input_mems.push_back(getToMemories(inNode.get(), 0));
-        }
-    }
-
-    for (const auto& out : subgraphOp->get_function()->get_results()) {
-        if (auto outNode = sub_graph.getOutputNodeByIndex(subgraphOp->get_function()->get_result_index(out))) {
-            auto outMem = outNode->getSrcMemoryAtPort(0);
-            output_mem.push_back(outMem);
-        }
-    }
+    collectBodyMemories(sub_graph, subgraphOp->get_function(), input_mems, output_mem);
 
     // Port map: outputs
     for (const auto& desc : subgraphOp->get_output_descriptions()) {
@@ -580,6 +703,12 @@ void TensorIterator::createPrimitive() {
 
     if (runAsDynamic()) {
         prepareDynamicBuffers();
+    } else {
+        const auto& body = subgraphOp->get_function();
+        independentIterations =
+            backEdges.empty() &&
+            (loopBodyConditionOutputIdx == -1 || isAlwaysTrueCondition(body, loopBodyConditionOutputIdx)) &&
+            !hasIterationState(body) && body->get_ops().size() <= maxParallelBodyOps;
     }
 
     if (inputShapesDefined() && (getAlgorithm() == Algorithm::TensorIteratorLoop || needPrepareParams())) {
@@ -630,6 +759,8 @@ void TensorIterator::prepareParamsImpl(const bool compileStage) {
 
     first_mappers.clear();
     before_mappers.clear();
+    after_mappers.clear();
+    last_mappers.clear();
     back_mappers.clear();
 
     if ((lastUsedCond && lastUsedTripCount != 0) || !isDynamicNode()) {
@@ -642,6 +773,7 @@ void TensorIterator::prepareParamsImpl(const bool compileStage) {
         if (!runAsDynamic()) {
             prepareOutputPorts();
             prepareBackEdges();
+            prepareParallelIterations();
         }
 
         // reset local states of DynamicBuffer
@@ -668,21 +800,25 @@ void TensorIterator::execute(const dnnl::stream& strm) {
         mapper.second->execute(strm, -1);
     }
 
-    // use  "i != max_num_iter" only to allow "-1" works like infinite loop
-    for (int i = 0; i != max_num_iter && continue_cond; i++) {
-        // copy data to subgraph iteration
-        for (auto& mapper : before_mappers) {
-            mapper->execute(strm, i);
-        }
+    if (parallelWorkers > 1 && max_num_iter > 1 && continue_cond) {
+        executeIterationsInParallel(strm, max_num_iter);
+    } else {
+        // use  "i != max_num_iter" only to allow "-1" works like infinite loop
+        for (int i = 0; i != max_num_iter && continue_cond; i++) {
+            // copy data to subgraph iteration
+            for (auto& mapper : before_mappers) {
+                mapper->execute(strm, i);
+            }
 
-        sub_graph.Infer();
+            sub_graph.Infer();
 
-        continue_cond = (continue_cond_check->getStatus() != 0);
+            continue_cond = (continue_cond_check->getStatus() != 0);
 
-        // copy data from subgraph iteration to outputs
-        // or to the next iteration inputs
-        for (auto& mapper : after_mappers) {
-            mapper->execute(strm, i);
+            // copy data from subgraph iteration to outputs
+            // or to the next iteration inputs
+            for (auto& mapper : after_mappers) {
+                mapper->execute(strm, i);
+            }
         }
     }
 
@@ -741,6 +877,8 @@ void TensorIterator::prepareInputPorts() {
         if (map_rule.axis == -1) {
             first_mappers.emplace(std::make_pair(map_rule.from, map_rule.to),
                                   std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem));
+        } else if (PortSliceCopyHelper::isApplicable(from_mem, to_mem)) {
+            before_mappers.emplace_back(std::make_shared<PortSliceCopyHelper>(from_mem, to_mem, true, map_rule));
         } else {
             before_mappers.emplace_back(
                 std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, true, map_rule, eng));
@@ -757,6 +895,8 @@ void TensorIterator::prepareOutputPorts() {
         if (map_rule.axis == -1) {
             last_mappers.emplace_back(
                 std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem));
+        } else if (PortSliceCopyHelper::isApplicable(from_mem, to_mem)) {
+            after_mappers.emplace_back(std::make_shared<PortSliceCopyHelper>(from_mem, to_mem, false, map_rule));
         } else {
             after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(context->getParamsCache(),
                                                                             from_mem,
@@ -809,6 +949,119 @@ void TensorIterator::prepareLoopBodyCurrentIteration() {
     }
 }
 
+void TensorIterator::prepareParallelIterations() {
+    parallelWorkers = 1;
+    if (!independentIterations || lastUsedTripCount < 2) {
+        return;
+    }
+    // the bodies copy slices concurrently, so all of them have to be copied without the stream
+    const bool plainSlices = std::all_of(inputPortMap.begin(),
+                                         inputPortMap.end(),
+                                         [&](const PortMap& rule) {
+                                             return rule.axis == -1 ||
+                                                    PortSliceCopyHelper::isApplicable(getSrcMemoryAtPort(rule.from),
+                                                                                      input_mems[rule.to].front());
+                                         }) &&
+                             std::all_of(outputPortMap.begin(), outputPortMap.end(), [&](const PortMap& rule) {
+                                 return rule.axis == -1 ||
+                                        PortSliceCopyHelper::isApplicable(output_mem[rule.to],
+                                                                          getDstMemoryAtPort(rule.from));
+                             });
+    const int workers = std::min({parallel_get_max_threads(), lastUsedTripCount, maxParallelBodies});
+    if (!plainSlices || workers < 2) {
+        return;
+    }
+
+    auto subgraphOp = ov::as_type_ptr<const ov::op::util::SubGraphOp>(ngraphOp);
+    const auto& body = subgraphOp->get_function();
+    while (static_cast<int>(replicas.size()) < workers - 1) {
+        // own context provides the replica with its own memory and scratchpad
+        auto replicaContext = std::make_shared<GraphContext>(context->getConfig(),
+                                                             context->getWeightsCache(),
+                                                             context->isGraphQuantized(),
+                                                             context->getCPUStreamExecutor(),
+                                                             context->getCpuParallel(),
+                                                             context->getSubMemory());
+        auto replica = std::make_unique<BodyReplica>();
+        replica->graph.Init(body, replicaContext);
+        replica->graph.Activate();
+        collectBodyMemories(replica->graph, body, replica->input_mems, replica->output_mem);
+        replicas.push_back(std::move(replica));
+    }
+
+    const auto& eng = getEngine();
+    for (auto& replica : replicas) {
+        replica->first_mappers.clear();
+        replica->before_mappers.clear();
+        replica->after_mappers.clear();
+        for (const auto& map_rule : inputPortMap) {
+            auto from_mem = getSrcMemoryAtPort(map_rule.from);
+            const auto& to_mem = replica->input_mems[map_rule.to].front();
+            if (map_rule.axis == -1) {
+                replica->first_mappers.emplace_back(
+                    std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem));
+            } else {
+                replica->before_mappers.emplace_back(
+                    std::make_shared<PortSliceCopyHelper>(from_mem, to_mem, true, map_rule));
+            }
+        }
+        for (auto idx : loopBodyCurrentIterationIdx) {
+            replica->before_mappers.emplace_back(
+                std::make_shared<IterCountPortHelper>(replica->input_mems[idx].front(), eng));
+        }
+        // outputs of the last iteration are taken from the body of the node, see executeIterationsInParallel
+        for (const auto& map_rule : outputPortMap) {
+            if (map_rule.axis != -1) {
+                auto to_mem = getDstMemoryAtPort(map_rule.from);
+                replica->after_mappers.emplace_back(
+                    std::make_shared<PortSliceCopyHelper>(replica->output_mem[map_rule.to], to_mem, false, map_rule));
+            }
+        }
+    }
+    parallelWorkers = workers;
+}
+
+void TensorIterator::executeIterationsInParallel(const dnnl::stream& strm, const int num_iter) {
+    const int workers = std::min(parallelWorkers, num_iter);
+    for (int w = 0; w < workers - 1; w++) {
+        auto& replica = *replicas[w];
+        replica.graph.ResetInferCount();
+        for (auto& mapper : replica.first_mappers) {
+            mapper->execute(strm, -1);
+        }
+    }
+
+    std::vector<std::exception_ptr> errors(workers);
+    parallel_nt(workers, [&](const int ithr, const int nthr) {
+        int begin = 0;
+        int end = 0;
+        splitter(num_iter, nthr, ithr, begin, end);
+        // the body of the node executes the last iterations, so outputs of the last iteration stay in its memory
+        const bool isLast = ithr == nthr - 1;
+        auto& graph = isLast ? sub_graph : replicas[ithr]->graph;
+        const auto& before = isLast ? before_mappers : replicas[ithr]->before_mappers;
+        const auto& after = isLast ? after_mappers : replicas[ithr]->after_mappers;
+        try {
+            for (int i = begin; i < end; i++) {
+                for (const auto& mapper : before) {
+                    mapper->execute(strm, i);
+                }
+                graph.Infer();
+                for (const auto& mapper : after) {
+                    mapper->execute(strm, i);
+                }
+            }
+        } catch (...) {
+            errors[ithr] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
 void TensorIterator::prepareContinueCond() {
     if (loopBodyConditionOutputIdx != -1 || !continue_cond_check) {
         CPU_NODE_ASSERT(
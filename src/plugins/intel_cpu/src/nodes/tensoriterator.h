@@ -166,10 +166,27 @@ private:
     bool runAsDynamic() const;
     void restoreSubgraphInputByBackEdges();
 
+    /* Parallel execution of independent iterations */
+    void prepareParallelIterations();
+    void executeIterationsInParallel(const dnnl::stream& strm, int num_iter);
+
     Graph sub_graph;
     std::vector<std::vector<MemoryPtr>> input_mems;
     std::vector<MemoryPtr> output_mem;
 
+    /**
+     * Copy of the body with its own memory, executing a part of iterations concurrently with the body of the node.
+     */
+    struct BodyReplica {
+        Graph graph;
+        std::vector<std::vector<MemoryPtr>> input_mems;
+        std::vector<MemoryPtr> output_mem;
+        std::vector<std::shared_ptr<PortMapHelper>> first_mappers, before_mappers, after_mappers;
+    };
+    std::vector<std::unique_ptr<BodyReplica>> replicas;
+    bool independentIterations = false;  //!< small body without back edges, state and real condition output
+    int parallelWorkers = 1;             //!< number of bodies executing iterations concurrently
+
     struct PortMapHasher {
         std::size_t operator()(const std::pair<int, int>& p) const {
             std::size_t seed = 0;
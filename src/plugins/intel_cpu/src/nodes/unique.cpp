@@ -5,6 +5,7 @@
 #include "unique.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -14,7 +15,7 @@
 #include <openvino/op/constant.hpp>
 #include <openvino/op/unique.hpp>
 #include <string>
-#include <unordered_map>
+#include <type_traits>
 #include <vector>
 
 #include "common/cpu_memcpy.h"
@@ -26,6 +27,7 @@
 #include "openvino/cc/selective_build.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "selective_build.h"
@@ -86,7 +88,6 @@ void Unique::initSupportedPrimitiveDescriptors() {
     if (none_of(dataPrecision, ov::element::i32, ov::element::i8, ov::element::u8)) {
         dataPrecision = ov::element::f32;
     }
-    dataTypeSize = dataPrecision.size();
     const ov::element::Type axisPrecision = ov::element::i32;
 
     impl_desc_type implType = ref;
@@ -119,13 +120,11 @@ void Unique::prepareParams() {
     }
     CPU_NODE_ASSERT(getSelectedPrimitiveDescriptor(), "has unidentified preferable primitive descriptor.");
 
-    size_t srcLen = 1;
+    // flattened tensor is processed without temporary outputs
     if (flattened) {
-        srcLen = getSrcMemoryAtPort(IN_DATA)->getSize() / dataTypeSize;
-    } else {
-        auto dstDataShape = getSrcMemoryAtPort(IN_DATA)->getStaticDims();
-        srcLen = dstDataShape[axis];
+        return;
     }
+    const size_t srcLen = getSrcMemoryAtPort(IN_DATA)->getStaticDims()[axis];
     firstUniTmp.resize(srcLen, 0);
     inToOutTmp.resize(srcLen);
     occurTmp.resize(srcLen);
@@ -185,113 +184,79 @@ void Unique::executeDynamicImpl(const dnnl::stream& strm) {
 
 template <typename T>
 void Unique::flattenTensorExec() {
+    const auto& cpu_parallel = context->getCpuParallel();
     const T* srcDataPtr = getSrcDataAtPortAs<const T>(IN_DATA);
     const size_t inputLen = getSrcMemoryAtPort(IN_DATA)->getSize() / sizeof(T);
-    std::vector<T> uniDataTmp(inputLen);
-    auto uniDataTmpPtr = uniDataTmp.data();
-    int* firstTmpPtr = nullptr;
-    int* inToOutTmpPtr = nullptr;
-    int* occurTmpPtr = nullptr;
-    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-        firstTmpPtr = firstUniTmp.data();
-    }
-    if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-        inToOutTmpPtr = inToOutTmp.data();
-    }
-    if (definedOutputs[OCCURRENCES_NUM]) {
-        occurTmpPtr = occurTmp.data();
-    }
-    uniqueLen = inputLen;
-
-    if (sorted) {
-        cpu_parallel_memcpy(uniDataTmpPtr, srcDataPtr, inputLen * sizeof(T));
-        std::sort(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        auto* last = std::unique(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        uniqueLen = last - uniDataTmpPtr;
 
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            T* first = uniDataTmpPtr;
-            for (T* it = first; it < last; it++) {
-                for (size_t i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == *it) {
-                        *firstTmpPtr++ = i;
-                        first++;
-                        break;
-                    }
-                }
-            }
-        }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            for (size_t i = 0; i < inputLen; i++) {
-                if (i > 0 && srcDataPtr[i] == srcDataPtr[i - 1]) {
-                    inToOutTmpPtr[i] = inToOutTmpPtr[i - 1];
-                    continue;
-                }
-                for (size_t j = 0; j < uniqueLen; j++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        inToOutTmpPtr[i] = j;
-                        break;
-                    }
-                }
-            }
+    // Elements are sorted together with their positions, so equal elements form runs ordered by the position.
+    // The first element of a run is the first occurrence, and the run length is the number of occurrences.
+    // NaNs are placed after all the numbers and, as they are not equal to anything, each forms its own run.
+    struct OrdEl {
+        T val;
+        int32_t idx;
+    };
+    const auto isNaN = [](T val) {
+        if constexpr (std::is_floating_point_v<T>) {
+            return std::isnan(val);
+        } else {
+            return false;
         }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + uniqueLen, 0);
-            for (size_t j = 0; j < uniqueLen; j++) {
-                for (size_t i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        occurTmpPtr[j]++;
-                    }
-                }
-            }
+    };
+    std::vector<OrdEl> ordered(inputLen);
+    cpu_parallel->parallel_for(inputLen, [&](size_t i) {
+        ordered[i] = {srcDataPtr[i], static_cast<int32_t>(i)};
+    });
+    cpu_parallel->parallel_sort(ordered.begin(), ordered.end(), [&](const OrdEl& el1, const OrdEl& el2) {
+        const bool nan1 = isNaN(el1.val);
+        const bool nan2 = isNaN(el2.val);
+        if (nan1 || nan2) {
+            return nan1 == nan2 ? el1.idx < el2.idx : nan2;
         }
-    } else {
-        std::unordered_map<T, int32_t> uniq;
-        uniq.reserve(inputLen);
-
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + inputLen, 1);
-        }
-
-        for (size_t i = 0, j = 0; i < inputLen; ++i) {
-            auto it = uniq.emplace(srcDataPtr[i], j);
-            if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-                inToOutTmpPtr[i] = it.first->second;
-                if (it.second) {
-                    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-                        firstTmpPtr[j] = i;
-                    }
-                    ++j;
-                } else {
-                    if (definedOutputs[OCCURRENCES_NUM]) {
-                        occurTmpPtr[inToOutTmpPtr[i]]++;
-                    }
-                }
-            }
+        return el1.val < el2.val || (el1.val == el2.val && el1.idx < el2.idx);
+    });
+
+    std::vector<size_t> runs;
+    runs.reserve(inputLen + 1);
+    for (size_t i = 0; i < inputLen; i++) {
+        if (i == 0 || !(ordered[i - 1].val == ordered[i].val)) {
+            runs.push_back(i);
         }
+    }
+    uniqueLen = runs.size();
+    runs.push_back(inputLen);
 
-        uniqueLen = static_cast<int64_t>(uniq.size());
-        for (const auto& it : uniq) {
-            uniDataTmpPtr[it.second] = it.first;
-        }
+    // Unsorted output keeps the order of the first occurrences.
+    std::vector<size_t> runsOrder(uniqueLen);
+    std::iota(runsOrder.begin(), runsOrder.end(), 0);
+    if (!sorted) {
+        cpu_parallel->parallel_sort(runsOrder.begin(), runsOrder.end(), [&](size_t r1, size_t r2) {
+            return ordered[runs[r1]].idx < ordered[runs[r2]].idx;
+        });
     }
 
     redefineOutputMemory({{uniqueLen}, {uniqueLen}, {inputLen}, {uniqueLen}});
 
     T* uniDataPtr = getDstDataAtPortAs<T>(UNIQUE_DATA);
-    cpu_parallel_memcpy(uniDataPtr, uniDataTmpPtr, uniqueLen * sizeof(T));
-    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-        auto* firstPtr = getDstDataAtPortAs<int>(FIRST_UNIQUE_IDX);
-        cpu_parallel_memcpy(firstPtr, firstUniTmp.data(), uniqueLen * sizeof(int));
-    }
-    if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-        auto* inToOutPtr = getDstDataAtPortAs<int>(INPUT_TO_UNIQ_IDX);
-        cpu_parallel_memcpy(inToOutPtr, inToOutTmp.data(), inputLen * sizeof(int));
-    }
-    if (definedOutputs[OCCURRENCES_NUM]) {
-        auto* occurPtr = getDstDataAtPortAs<int>(OCCURRENCES_NUM);
-        cpu_parallel_memcpy(occurPtr, occurTmp.data(), uniqueLen * sizeof(int));
-    }
+    int* firstPtr = definedOutputs[FIRST_UNIQUE_IDX] ? getDstDataAtPortAs<int>(FIRST_UNIQUE_IDX) : nullptr;
+    int* inToOutPtr = definedOutputs[INPUT_TO_UNIQ_IDX] ? getDstDataAtPortAs<int>(INPUT_TO_UNIQ_IDX) : nullptr;
+    int* occurPtr = definedOutputs[OCCURRENCES_NUM] ? getDstDataAtPortAs<int>(OCCURRENCES_NUM) : nullptr;
+
+    cpu_parallel->parallel_for(uniqueLen, [&](size_t u) {
+        const size_t runBegin = runs[runsOrder[u]];
+        const size_t runEnd = runs[runsOrder[u] + 1];
+        uniDataPtr[u] = ordered[runBegin].val;
+        if (firstPtr) {
+            firstPtr[u] = ordered[runBegin].idx;
+        }
+        if (occurPtr) {
+            occurPtr[u] = static_cast<int>(runEnd - runBegin);
+        }
+        if (inToOutPtr) {
+            for (size_t i = runBegin; i < runEnd; i++) {
+                inToOutPtr[ordered[i].idx] = static_cast<int>(u);
+            }
+        }
+    });
 }
 
 template <typename T>
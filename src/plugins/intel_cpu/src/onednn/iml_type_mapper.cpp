@@ -148,6 +148,7 @@ const char* impl_type_to_string(impl_desc_type type) {
     CASE(gemm_acl);
     CASE(winograd_acl);
     CASE(gemm_mlas);
+    CASE(gemm_sparse);
     CASE(jit_asimd);
     CASE(jit_sve128);
     CASE(jit_sve256);
@@ -463,6 +463,9 @@ ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options)
         const auto core_type = engConfig.schedulingCoreType;
         return core_type;
     }
+    if (name == ov::hint::model_priority) {
+        return engConfig.modelPriority;
+    }
     if (name == ov::hint::model_distribution_policy) {
         const auto& distribution_policy = engConfig.modelDistributionPolicy;
         return distribution_policy;
@@ -577,12 +580,14 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
                                                    RW_property(ov::hint::enable_cpu_pinning.name()),
                                                    RW_property(ov::hint::enable_cpu_reservation.name()),
                                                    RW_property(ov::hint::scheduling_core_type.name()),
+                                                   RW_property(ov::hint::model_priority.name()),
                                                    RW_property(ov::hint::model_distribution_policy.name()),
                                                    RW_property(ov::hint::enable_hyper_threading.name()),
                                                    RW_property(ov::device::id.name()),
                                                    RW_property(ov::intel_cpu::denormals_optimization.name()),
                                                    RW_property(ov::log::level.name()),
                                                    RW_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+                                                   RW_property(ov::intel_cpu::sparse_float_weights_rate.name()),
                                                    RW_property(ov::intel_cpu::enable_tensor_parallel.name()),
                                                    RW_property(ov::intel_cpu::tbb_partitioner.name()),
                                                    RW_property(ov::hint::dynamic_quantization_group_size.name()),
@@ -660,6 +665,10 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
         return static_cast<decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type>(
             engConfig.fcSparseWeiDecompressionRate);
     }
+    if (name == ov::intel_cpu::sparse_float_weights_rate) {
+        return static_cast<decltype(ov::intel_cpu::sparse_float_weights_rate)::value_type>(
+            engConfig.fcSparseFloatWeightsRate);
+    }
     if (name == ov::intel_cpu::enable_tensor_parallel) {
         return static_cast<decltype(ov::intel_cpu::enable_tensor_parallel)::value_type>(engConfig.enableTensorParallel);
     }
@@ -0,0 +1,194 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "convert_compressed_conv1x1_to_matmul.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/shape.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/convolution.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
+#include "openvino/pass/pattern/op/pattern.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+namespace {
+bool is_transpose_with_order(const std::shared_ptr<ov::Node>& node, const std::vector<int64_t>& order) {
+    if (!ov::is_type<ov::op::v1::Transpose>(node)) {
+        return false;
+    }
+    const auto order_const = ov::as_type_ptr<ov::op::v0::Constant>(node->get_input_node_shared_ptr(1));
+    return order_const && order_const->cast_vector<int64_t>() == order;
+}
+}  // namespace
+
+ov::intel_cpu::ConvertCompressedConv1x1ToMatMul::ConvertCompressedConv1x1ToMatMul(
+    const ov::element::TypeVector& supported_activation_types,
+    const ov::element::TypeVector& supported_weights_types) {
+    MATCHER_SCOPE(ConvertCompressedConv1x1ToMatMul);
+    using namespace ov::pass::pattern;
+
+    auto activation_m = any_input(type_matches_any(supported_activation_types));
+    auto weights_m = wrap_type<ov::op::v0::Constant>(type_matches_any(supported_weights_types));
+    auto convert_m = wrap_type<ov::op::v0::Convert>({weights_m}, consumers_count(1));
+
+    auto sub_const_m = wrap_type<ov::op::v0::Constant>();
+    auto sub_convert_m = wrap_type<ov::op::v0::Convert>({sub_const_m});
+    auto sub_input_m = std::make_shared<ov::pass::pattern::op::Or>(ov::OutputVector{sub_convert_m, sub_const_m});
+    auto sub_m = wrap_type<ov::op::v1::Subtract>({convert_m, sub_input_m}, consumers_count(1));
+
+    auto mul_const_m = wrap_type<ov::op::v0::Constant>();
+    auto mul_convert_m = wrap_type<ov::op::v0::Convert>({mul_const_m});
+    auto mul_data_m = std::make_shared<ov::pass::pattern::op::Or>(ov::OutputVector{sub_m, convert_m});
+    auto mul_input_m = std::make_shared<ov::pass::pattern::op::Or>(ov::OutputVector{mul_convert_m, mul_const_m});
+    auto mul_m = wrap_type<ov::op::v1::Multiply>({mul_data_m, mul_input_m}, consumers_count(1));
+
+    auto conv_m = wrap_type<ov::op::v1::Convolution>({activation_m, mul_m});
+
+    ov::matcher_pass_callback callback = [=](Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        auto conv = ov::as_type_ptr<ov::op::v1::Convolution>(pattern_map.at(conv_m).get_node_shared_ptr());
+        if (!conv || transformation_callback(conv)) {
+            return false;
+        }
+
+        const auto& weights_shape = conv->get_input_partial_shape(1);
+        if (conv->get_input_partial_shape(0).rank() != 4 || weights_shape.is_dynamic() ||
+            weights_shape[2].get_length() != 1 || weights_shape[3].get_length() != 1) {
+            return false;
+        }
+        const auto is_one = [](size_t v) {
+            return v == 1;
+        };
+        const auto is_zero = [](std::ptrdiff_t v) {
+            return v == 0;
+        };
+        if (!std::all_of(conv->get_strides().begin(), conv->get_strides().end(), is_one) ||
+            !std::all_of(conv->get_dilations().begin(), conv->get_dilations().end(), is_one) ||
+            !std::all_of(conv->get_pads_begin().begin(), conv->get_pads_begin().end(), is_zero) ||
+            !std::all_of(conv->get_pads_end().begin(), conv->get_pads_end().end(), is_zero)) {
+            return false;
+        }
+
+        // MatMul works on the channels-last layout, so the rewrite is applied only when it doesn't add
+        // layout transposes: either the convolution is surrounded by NHWC <-> NCHW transposes which cancel
+        // the ones of the MatMul, or the spatial dimensions are 1 and the layouts differ by a reshape only
+        const auto& activation = pattern_map.at(activation_m);
+        const auto& conv_consumers = conv->get_output_target_inputs(0);
+        const auto conv_consumer =
+            conv_consumers.size() == 1 ? conv_consumers.begin()->get_node()->shared_from_this() : nullptr;
+        const bool transposes_cancel = is_transpose_with_order(activation.get_node_shared_ptr(), {0, 3, 1, 2}) &&
+                                       conv_consumer && is_transpose_with_order(conv_consumer, {0, 2, 3, 1});
+        const auto& input_shape = conv->get_input_partial_shape(0);
+        const bool unit_spatial = input_shape[2].is_static() && input_shape[2].get_length() == 1 &&
+                                  input_shape[3].is_static() && input_shape[3].get_length() == 1;
+        if (!transposes_cancel && !unit_spatial) {
+            return false;
+        }
+
+        const auto OC = static_cast<size_t>(weights_shape[0].get_length());
+        const auto IC = static_cast<size_t>(weights_shape[1].get_length());
+
+        // decompression constants are broadcast to [OC, IC] weights instead of [OC, IC, 1, 1] ones
+        auto reshape_constant = [&](const std::shared_ptr<ov::Node>& constant_node,
+                                    const ov::Shape& shape) -> std::shared_ptr<ov::op::v0::Constant> {
+            auto constant = ov::as_type_ptr<ov::op::v0::Constant>(constant_node);
+            if (!constant || ov::shape_size(constant->get_shape()) != ov::shape_size(shape)) {
+                return nullptr;
+            }
+            auto reshaped = std::make_shared<ov::op::v0::Constant>(*constant, shape);
+            ov::copy_runtime_info(constant, reshaped);
+            return reshaped;
+        };
+        auto decompression_input = [&](const std::shared_ptr<ov::op::v0::Constant>& constant,
+                                       const std::shared_ptr<ov::Node>& convert) -> ov::Output<ov::Node> {
+            if (!convert) {
+                return constant;
+            }
+            auto new_convert = convert->clone_with_new_inputs({constant});
+            ov::copy_runtime_info(convert, new_convert);
+            return new_convert;
+        };
+        auto per_channel_constant =
+            [&](const std::shared_ptr<ov::Node>& constant_node) -> std::shared_ptr<ov::op::v0::Constant> {
+            const auto& shape = constant_node->get_output_shape(0);
+            if (ov::shape_size(shape) == 1) {
+                return reshape_constant(constant_node, ov::Shape{1, 1});
+            }
+            if (shape.size() != 4 || shape[0] != OC) {
+                return nullptr;
+            }
+            return reshape_constant(constant_node, ov::Shape{OC, 1});
+        };
+
+        auto weights = reshape_constant(pattern_map.at(weights_m).get_node_shared_ptr(), ov::Shape{OC, IC});
+        const auto convert = pattern_map.at(convert_m).get_node_shared_ptr();
+        ov::Output<ov::Node> decompressed = decompression_input(weights, convert);
+
+        if (pattern_map.count(sub_m)) {
+            auto zero_point = per_channel_constant(pattern_map.at(sub_const_m).get_node_shared_ptr());
+            if (!zero_point) {
+                return false;
+            }
+            const auto sub_convert =
+                pattern_map.count(sub_convert_m) ? pattern_map.at(sub_convert_m).get_node_shared_ptr() : nullptr;
+            const auto sub = pattern_map.at(sub_m).get_node_shared_ptr();
+            auto new_sub = sub->clone_with_new_inputs({decompressed, decompression_input(zero_point, sub_convert)});
+            ov::copy_runtime_info(sub, new_sub);
+            decompressed = new_sub;
+        }
+
+        auto scale = per_channel_constant(pattern_map.at(mul_const_m).get_node_shared_ptr());
+        if (!scale) {
+            return false;
+        }
+        const auto mul_convert =
+            pattern_map.count(mul_convert_m) ? pattern_map.at(mul_convert_m).get_node_shared_ptr() : nullptr;
+        const auto mul = pattern_map.at(mul_m).get_node_shared_ptr();
+        auto new_mul = mul->clone_with_new_inputs({decompressed, decompression_input(scale, mul_convert)});
+        ov::copy_runtime_info(mul, new_mul);
+
+        if (transposes_cancel) {
+            auto matmul =
+                std::make_shared<ov::op::v0::MatMul>(activation.get_node()->input_value(0), new_mul, false, true);
+            matmul->set_friendly_name(conv_consumer->get_friendly_name());
+            ov::copy_runtime_info(ov::NodeVector{conv, conv_consumer}, matmul);
+            ov::replace_node(conv_consumer, matmul);
+            return true;
+        }
+
+        auto to_nhwc = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{4}, {0, 1, 1, -1});
+        auto to_nchw = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{4}, {0, -1, 1, 1});
+        auto reshape_in = std::make_shared<ov::op::v1::Reshape>(activation, to_nhwc, true);
+        auto matmul = std::make_shared<ov::op::v0::MatMul>(reshape_in, new_mul, false, true);
+        auto reshape_out = std::make_shared<ov::op::v1::Reshape>(matmul, to_nchw, true);
+
+        reshape_out->set_friendly_name(conv->get_friendly_name());
+        ov::copy_runtime_info(conv, {to_nhwc, to_nchw, reshape_in, matmul, reshape_out});
+        ov::replace_node(conv, reshape_out);
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(conv_m, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,34 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Converts 1x1 Convolution with compressed weights into MatMul, so the weights stay compressed and are
+ * decompressed on the fly by FullyConnected instead of being decompressed at the compilation stage.
+ *
+ * The conversion is applied only when it doesn't introduce layout transposes:
+ *   [NHWC] -> Transpose -> [NCHW] -> Convolution 1x1 (weights [OC, IC, 1, 1]) -> [NCHW] -> Transpose -> [NHWO]
+ * is converted into
+ *   [NHWC] -> MatMul (weights [OC, IC], transpose_b) -> [NHWO]
+ * and a convolution with 1x1 spatial dimensions
+ *   [N, C, 1, 1] -> Convolution 1x1 -> [N, OC, 1, 1]
+ * is converted into
+ *   [N, C, 1, 1] -> Reshape -> [N, 1, 1, C] -> MatMul (weights [OC, IC], transpose_b) -> Reshape -> [N, OC, 1, 1]
+ *
+ * Decompression constants must be per output channel or scalar.
+ */
+class ConvertCompressedConv1x1ToMatMul : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("ConvertCompressedConv1x1ToMatMul");
+    ConvertCompressedConv1x1ToMatMul(const ov::element::TypeVector& supported_activation_types,
+                                     const ov::element::TypeVector& supported_weights_types);
+};
+
+}  // namespace ov::intel_cpu
@@ -14,6 +14,7 @@
 #include "openvino/core/node.hpp"
 #include "openvino/core/shape.hpp"
 #include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
 #include "openvino/op/abs.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/assign.hpp"
@@ -27,6 +28,8 @@
 #include "openvino/op/if.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/max_pool.hpp"
+#include "openvino/op/nms_rotated.hpp"
+#include "openvino/op/non_max_suppression.hpp"
 #include "openvino/op/normalize_l2.hpp"
 #include "openvino/op/parameter.hpp"
 #include "openvino/op/read_value.hpp"
@@ -38,6 +41,7 @@
 #include "openvino/op/util/convolution_backprop_base.hpp"
 #include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
+#include "ov_ops/nms_ie_internal.hpp"
 #include "snippets/pass/tokenization.hpp"
 #include "transformations/utils/utils.hpp"
 #include "utils/cpu_utils.hpp"
@@ -249,6 +253,21 @@ bool isSuitableConvert(const std::shared_ptr<const Node>& node) {
     return isSuitableParent(node) || isSuitableChild(node);
 }
 
+// NonMaxSuppression applies Sigmoid to its scores itself, see GraphOptimizer::FuseSigmoidAndNonMaxSuppression
+bool isSuitableNmsScoresSigmoid(const std::shared_ptr<const Node>& node) {
+    if (!ov::is_type<ov::op::v0::Sigmoid>(node) || node->get_output_element_type(0) != ov::element::f32) {
+        return false;
+    }
+    const auto out = node->outputs();
+    if (!all_of(1U, out.size(), out[0].get_target_inputs().size())) {
+        return false;
+    }
+    const auto child = *out[0].get_target_inputs().begin();
+    return child.get_index() == 1 && ov::is_type_any_of<ov::op::v9::NonMaxSuppression,
+                                                        ov::op::internal::NonMaxSuppressionIEInternal,
+                                                        ov::op::v13::NMSRotated>(child.get_node());
+}
+
 auto is_skipped_op(const std::shared_ptr<ov::Node>& op) -> bool {
     return ov::is_type_any_of<ov::op::v0::Constant, ov::op::v0::Parameter, ov::op::v0::Result>(op);
 }
@@ -305,6 +324,9 @@ bool SnippetsMarkSkipped::run_on_model(const std::shared_ptr<ov::Model>& m) {
                     channelAxis = DEFAULT_AXIS;
                 }
             }
+        } else if (isSuitableNmsScoresSigmoid(node)) {
+            SetSnippetsNodeType(node, snippets::pass::SnippetsNodeType::SkippedByPlugin);
+            channelAxis = DEFAULT_AXIS;
         } else if (isSuitableConvert(node)) {
             SetSnippetsNodeType(node, snippets::pass::SnippetsNodeType::SkippedByPlugin);
             channelAxis = DEFAULT_AXIS;
@@ -42,6 +42,8 @@
 #include "openvino/op/mish.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/mvn.hpp"
+#include "openvino/op/nms_rotated.hpp"
+#include "openvino/op/non_max_suppression.hpp"
 #include "openvino/op/normalize_l2.hpp"
 #include "openvino/op/parameter.hpp"
 #include "openvino/op/prelu.hpp"
@@ -55,8 +57,11 @@
 #include "openvino/op/swish.hpp"
 #include "openvino/op/tanh.hpp"
 #include "openvino/op/util/arithmetic_reductions_keep_dims.hpp"
+#include "openvino/op/util/convert_color_i420_base.hpp"
+#include "openvino/op/util/convert_color_nv12_base.hpp"
 #include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
+#include "ov_ops/nms_ie_internal.hpp"
 #include "snippets/pass/tokenization.hpp"
 #include "transformations/utils/utils.hpp"
 #include "utils/cpu_utils.hpp"
@@ -231,6 +236,15 @@ bool isSuitableGatherParent(const std::shared_ptr<const Node>& node) {
     const bool has_only_child = all_of(1U, out.size(), out[0].get_target_inputs().size());
     return is_suitable_node && has_only_child;
 }
+// ColorConvert fuses u8 -> f32 Convert and the following per channel scale / shift Eltwise nodes
+bool isSuitableColorConvertParent(const std::shared_ptr<const Node>& node) {
+    const bool is_suitable_node =
+        ov::is_type_any_of<ov::op::util::ConvertColorNV12Base, ov::op::util::ConvertColorI420Base>(node);
+    // has a single output, connected to a single child
+    const auto out = node->outputs();
+    const bool has_only_child = all_of(1U, out.size(), out[0].get_target_inputs().size());
+    return is_suitable_node && has_only_child;
+}
 bool isSuitableMiscParent(const std::shared_ptr<const Node>& node) {
     const bool is_suitable_node = ov::is_type_any_of<ov::op::v0::MVN,
                                                      ov::op::v6::MVN,
@@ -503,6 +517,13 @@ bool isSuitableGatherChild(const std::shared_ptr<const Node>& node) {
            any_of(node->get_input_element_type(0), element::f16, element::bf16) &&
            node->get_output_element_type(0) == ov::element::f32;
 }
+bool isSuitableColorConvertChild(const std::shared_ptr<const Node>& node, const int channelAxis) {
+    if (ov::is_type<ov::op::v0::Convert>(node)) {
+        return node->get_input_element_type(0) == ov::element::u8 &&
+               node->get_output_element_type(0) == ov::element::f32;
+    }
+    return node->get_output_element_type(0) == ov::element::f32 && canBePerformedAsScaleShift(node, channelAxis);
+}
 bool isSuitableMatMulWithConstantPath(const std::shared_ptr<Node>& node) {
     return ov::is_type<ov::op::v0::MatMul>(node) &&
            !ov::is_type<ov::op::v0::Constant>(node->get_input_node_shared_ptr(1)) &&
@@ -567,6 +588,21 @@ bool isSuitableConvert(const std::shared_ptr<const Node>& node) {
     return false;
 }
 
+// NonMaxSuppression applies Sigmoid to its scores itself, see GraphOptimizer::FuseSigmoidAndNonMaxSuppression
+bool isSuitableNmsScoresSigmoid(const std::shared_ptr<const Node>& node) {
+    if (!ov::is_type<ov::op::v0::Sigmoid>(node) || node->get_output_element_type(0) != ov::element::f32) {
+        return false;
+    }
+    const auto out = node->outputs();
+    if (!all_of(1U, out.size(), out[0].get_target_inputs().size())) {
+        return false;
+    }
+    const auto child = *out[0].get_target_inputs().begin();
+    return child.get_index() == 1 && ov::is_type_any_of<ov::op::v9::NonMaxSuppression,
+                                                        ov::op::internal::NonMaxSuppressionIEInternal,
+                                                        ov::op::v13::NMSRotated>(child.get_node());
+}
+
 auto is_skipped_op(const std::shared_ptr<ov::Node>& op) -> bool {
     return ov::is_type_any_of<ov::op::v0::Constant, ov::op::v0::Parameter, ov::op::v0::Result>(op);
 }
@@ -602,6 +638,9 @@ bool SnippetsMarkSkipped::run_on_model(const std::shared_ptr<ov::Model>& m) {
         } else if (isSuitableGatherParent(node)) {
             SetNodeFusingType(node, NodeFusingType::FusedWithGather);
             channelAxis = DEFAULT_AXIS;
+        } else if (isSuitableColorConvertParent(node)) {
+            SetNodeFusingType(node, NodeFusingType::FusedWithColorConvert);
+            channelAxis = 3;  // NHWC
         } else if (isSuitableMiscParent(node)) {
             if (const auto reduce = ov::as_type_ptr<const ov::op::util::ArithmeticReductionKeepDims>(node)) {
                 channelAxis = getChannelAxis(reduce->get_reduction_axes(), reduce->get_keep_dims());
@@ -625,6 +664,9 @@ bool SnippetsMarkSkipped::run_on_model(const std::shared_ptr<ov::Model>& m) {
                 SetNodeFusingType(node, is_i8 ? NodeFusingType::FusedWithMatMulI8 : NodeFusingType::FusedWithMatMul);
                 channelAxis = out_rank.is_static() ? out_rank.get_length() - 1 : DEFAULT_AXIS;
             }
+        } else if (isSuitableNmsScoresSigmoid(node)) {
+            SetSnippetsNodeType(node, snippets::pass::SnippetsNodeType::SkippedByPlugin);
+            channelAxis = DEFAULT_AXIS;
         } else if (isSuitableSubtractAsZeroPointsParent(node) || (enableBF16 && isSuitableConvert(node))) {
             // CVS-105447
             // This WA skip convert with same I/O precision in Snippets
@@ -642,6 +684,10 @@ bool SnippetsMarkSkipped::run_on_model(const std::shared_ptr<ov::Model>& m) {
                         // can fuse single real16 to f32 convert
                         SetNodeFusingType(node, NodeFusingType::FusedTerminator);
                     }
+                } else if (fusingChainType == NodeFusingType::FusedWithColorConvert) {
+                    if (isSuitableColorConvertChild(node, channelAxis)) {
+                        PropagateIfHasOnlyChild(node, fusingChainType);
+                    }
                 } else if (isSuitableChildForFusingSimple(node, channelAxis)) {
                     PropagateIfHasOnlyChild(node, fusingChainType);
                 } else if (any_of(fusingChainType,
@@ -142,6 +142,7 @@
 #include "transformations/low_precision/mark_dequantization_subgraph.hpp"
 
 // CPU specific transformations
+#include "transformations/cpu_opset/common/pass/convert_compressed_conv1x1_to_matmul.hpp"
 #include "transformations/cpu_opset/common/pass/insert_convert_after_extension.hpp"
 #include "transformations/cpu_opset/common/pass/ngram_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/permute_slice_n_interpolation.hpp"
@@ -469,6 +470,14 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     CPU_REGISTER_PASS_ARM(decompression_handling_manager, ov::pass::TransposeMatMul);
     const auto& decompression_precisions =
         ov::intel_cpu::node::FullyConnected::getSupportedCompressedWeightsTypes(true);
+    // 1x1 Convolution with compressed weights is executed as FullyConnected to keep the weights compressed.
+    // Quantized models are handled by LPT instead
+    if (!useLpt) {
+        CPU_REGISTER_PASS_X64(decompression_handling_manager,
+                              ConvertCompressedConv1x1ToMatMul,
+                              ov::intel_cpu::node::FullyConnected::getSupportedCompressedActivationsTypes(),
+                              decompression_precisions);
+    }
     CPU_REGISTER_PASS_COMMON(decompression_handling_manager,
                              ov::pass::MarkDequantization,
                              decompression_precisions,
@@ -0,0 +1,102 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Number of values to search in lockstep by sorted_rank_block.
+ */
+constexpr size_t sorted_rank_block_size = 8;
+
+template <bool inclusive, typename T, typename V>
+inline bool sorted_rank_before(const T& element, const V& value) {
+    if constexpr (inclusive) {
+        return !(value < element);
+    } else {
+        return element < value;
+    }
+}
+
+/**
+ * @brief Branchless binary search over sorted range.
+ *
+ * The range is halved by conditional moves instead of branches, so the search doesn't suffer from branch
+ * mispredictions on random values.
+ *
+ * @tparam inclusive  If true, elements equal to the value are counted (upper bound), otherwise lower bound.
+ *
+ * @param data   Sorted range.
+ * @param size   Number of elements in the range.
+ * @param value  Value to search.
+ * @return Number of range elements less than the value (less or equal for inclusive search).
+ */
+template <bool inclusive, typename T, typename V>
+inline size_t sorted_rank(const T* data, size_t size, const V& value) {
+    if (size == 0) {
+        return 0;
+    }
+    const T* base = data;
+    while (size > 1) {
+        const size_t half = size / 2;
+        base = sorted_rank_before<inclusive>(base[half], value) ? base + half : base;
+        size -= half;
+    }
+    return static_cast<size_t>(base - data) + static_cast<size_t>(sorted_rank_before<inclusive>(*base, value));
+}
+
+/**
+ * @brief Searches sorted_rank_block_size values in the same sorted range.
+ *
+ * All searches take the same number of steps, so they are interleaved to overlap memory accesses of independent
+ * searches, which bound the search for ranges not fitting the cache.
+ *
+ * @param data    Sorted range.
+ * @param size    Number of elements in the range.
+ * @param values  sorted_rank_block_size values to search.
+ * @param out     Ranks of the values, see sorted_rank.
+ */
+template <bool inclusive, typename T, typename V, typename TOut>
+inline void sorted_rank_block(const T* data, size_t size, const V* values, TOut* out) {
+    if (size == 0) {
+        for (size_t i = 0; i < sorted_rank_block_size; i++) {
+            out[i] = static_cast<TOut>(0);
+        }
+        return;
+    }
+    const T* base[sorted_rank_block_size];
+    for (auto& b : base) {
+        b = data;
+    }
+    while (size > 1) {
+        const size_t half = size / 2;
+        for (size_t i = 0; i < sorted_rank_block_size; i++) {
+            base[i] = sorted_rank_before<inclusive>(base[i][half], values[i]) ? base[i] + half : base[i];
+        }
+        size -= half;
+    }
+    for (size_t i = 0; i < sorted_rank_block_size; i++) {
+        out[i] = static_cast<TOut>(static_cast<size_t>(base[i] - data) +
+                                   static_cast<size_t>(sorted_rank_before<inclusive>(*base[i], values[i])));
+    }
+}
+
+/**
+ * @brief Computes ranks of contiguous values in the same sorted range by blocks, see sorted_rank_block.
+ */
+template <bool inclusive, typename T, typename V, typename TOut>
+inline void sorted_rank_range(const T* data, size_t size, const V* values, size_t values_num, TOut* out) {
+    size_t i = 0;
+    for (; i + sorted_rank_block_size <= values_num; i += sorted_rank_block_size) {
+        sorted_rank_block<inclusive>(data, size, values + i, out + i);
+    }
+    for (; i < values_num; i++) {
+        out[i] = static_cast<TOut>(sorted_rank<inclusive>(data, size, values[i]));
+    }
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,121 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace ov {
+namespace test {
+
+#if defined(__linux__) && defined(OPENVINO_ARCH_X86_64)
+namespace {
+// resident size in kB of the mapping which contains the address
+size_t mapping_resident_kb(const void* address) {
+    const auto target = reinterpret_cast<uintptr_t>(address);
+    std::ifstream smaps("/proc/self/smaps");
+    bool found = false;
+    std::string line;
+    while (std::getline(smaps, line)) {
+        uintptr_t begin = 0;
+        uintptr_t end = 0;
+        if (std::sscanf(line.c_str(), "%" SCNxPTR "-%" SCNxPTR, &begin, &end) == 2) {
+            found = begin <= target && target < end;
+            continue;
+        }
+        size_t rss = 0;
+        if (found && std::sscanf(line.c_str(), "Rss: %zu kB", &rss) == 1) {
+            return rss;
+        }
+    }
+    return 0;
+}
+}  // namespace
+
+// Weights of an IR read with mmap are repacked by the CPU plugin, so their pages mapped from the .bin file are
+// released at compile_model, while the data stays readable from the file.
+TEST(MmapWeightsCPU, smoke_RepackedWeightsPagesAreReleased) {
+    constexpr size_t K = 1024;
+    constexpr size_t N = 512;
+    std::vector<float> weights_data(N * K);
+    for (size_t i = 0; i < weights_data.size(); i++) {
+        weights_data[i] = static_cast<float>(i % 255) / 256.0f - 0.5f;
+    }
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, K});
+    auto weights = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{N, K}, weights_data);
+    auto matmul = std::make_shared<ov::op::v0::MatMul>(param, weights, false, true);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{matmul}, ov::ParameterVector{param});
+
+    const auto prefix = ov::test::utils::generateTestFilePrefix();
+    const auto xml_path = prefix + ".xml";
+    const auto bin_path = prefix + ".bin";
+    ov::save_model(model, xml_path, false);
+
+    {
+        ov::Core core;
+        core.set_property(ov::enable_mmap(true));
+        auto read_model = core.read_model(xml_path);
+
+        std::shared_ptr<ov::op::v0::Constant> read_weights;
+        for (const auto& op : read_model->get_ordered_ops()) {
+            auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op);
+            if (constant && constant->get_shape() == ov::Shape{N, K}) {
+                read_weights = constant;
+            }
+        }
+        ASSERT_NE(read_weights, nullptr);
+        const auto* data = read_weights->get_data_ptr<float>();
+        const size_t byte_size = weights_data.size() * sizeof(float);
+
+        // pages of the weights are faulted in on the first access
+        ASSERT_EQ(0, std::memcmp(data, weights_data.data(), byte_size));
+        const auto resident_before = mapping_resident_kb(data);
+        ASSERT_GE(resident_before, byte_size / 1024);
+
+        auto compiled_model = core.compile_model(read_model,
+                                                 ov::test::utils::DEVICE_CPU,
+                                                 ov::hint::inference_precision(ov::element::f32),
+                                                 ov::num_streams(1));
+        const auto resident_after = mapping_resident_kb(data);
+        EXPECT_LT(resident_after, resident_before / 2);
+
+        // released pages are read from the file again
+        EXPECT_EQ(0, std::memcmp(data, weights_data.data(), byte_size));
+
+        auto request = compiled_model.create_infer_request();
+        auto input = request.get_input_tensor();
+        std::fill_n(input.data<float>(), K, 1.0f);
+        request.infer();
+        const auto* output = request.get_output_tensor().data<const float>();
+        for (size_t n = 0; n < N; n++) {
+            float expected = 0.0f;
+            for (size_t k = 0; k < K; k++) {
+                expected += weights_data[n * K + k];
+            }
+            EXPECT_NEAR(output[n], expected, 1e-3f * std::max(1.0f, std::fabs(expected))) << "channel " << n;
+        }
+    }
+
+    ov::test::utils::removeIRFiles(xml_path, bin_path);
+}
+#endif
+
+}  // namespace test
+}  // namespace ov
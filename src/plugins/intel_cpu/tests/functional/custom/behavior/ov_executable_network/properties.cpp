@@ -11,6 +11,7 @@
 #include "internal_properties.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/core.hpp"
+#include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/runtime/system_conf.hpp"
 #include "utils/properties_test.hpp"
@@ -41,12 +42,14 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::hint::enable_cpu_pinning.name()),
         RO_property(ov::hint::enable_cpu_reservation.name()),
         RO_property(ov::hint::scheduling_core_type.name()),
+        RO_property(ov::hint::model_priority.name()),
         RO_property(ov::hint::model_distribution_policy.name()),
         RO_property(ov::hint::enable_hyper_threading.name()),
         RO_property(ov::execution_devices.name()),
         RO_property(ov::intel_cpu::denormals_optimization.name()),
         RO_property(ov::log::level.name()),
         RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+        RO_property(ov::intel_cpu::sparse_float_weights_rate.name()),
         RO_property(ov::intel_cpu::enable_tensor_parallel.name()),
         RO_property(ov::intel_cpu::tbb_partitioner.name()),
         RO_property(ov::hint::dynamic_quantization_group_size.name()),
@@ -215,6 +218,17 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckSparseWeigthsDecompression
     OV_ASSERT_NO_THROW(ov::CompiledModel compiledModel = core.compile_model(model, deviceName));
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckSparseFloatWeightsRate) {
+    ov::Core core;
+
+    core.set_property(deviceName, ov::intel_cpu::sparse_float_weights_rate(0.8f));
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName);
+
+    float rate = 1.0f;
+    OV_ASSERT_NO_THROW(rate = compiledModel.get_property(ov::intel_cpu::sparse_float_weights_rate));
+    ASSERT_EQ(rate, 0.8f);
+}
+
 TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckDynamicQuantizationGroupSize) {
     ov::Core core;
 
@@ -226,6 +240,29 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckDynamicQuantizationGroupSi
     ASSERT_EQ(groupSize, 64);
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckModelPriority) {
+    ov::Core core;
+
+    core.set_property(deviceName, ov::internal::exclusive_async_requests(true));
+    ov::CompiledModel highPriorityModel =
+        core.compile_model(model, deviceName, ov::hint::model_priority(ov::hint::Priority::HIGH));
+    ov::CompiledModel defaultPriorityModel = core.compile_model(model, deviceName);
+
+    ov::hint::Priority priority = ov::hint::Priority::LOW;
+    OV_ASSERT_NO_THROW(priority = highPriorityModel.get_property(ov::hint::model_priority));
+    ASSERT_EQ(priority, ov::hint::Priority::HIGH);
+    OV_ASSERT_NO_THROW(priority = defaultPriorityModel.get_property(ov::hint::model_priority));
+    ASSERT_EQ(priority, ov::hint::Priority::MEDIUM);
+
+    // both models share the same queue of requests
+    auto highPriorityRequest = highPriorityModel.create_infer_request();
+    auto defaultPriorityRequest = defaultPriorityModel.create_infer_request();
+    defaultPriorityRequest.start_async();
+    highPriorityRequest.start_async();
+    OV_ASSERT_NO_THROW(defaultPriorityRequest.wait());
+    OV_ASSERT_NO_THROW(highPriorityRequest.wait());
+}
+
 TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckKVCachePrecision) {
     ov::Core core;
 
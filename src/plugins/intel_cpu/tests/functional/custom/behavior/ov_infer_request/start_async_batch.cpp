@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <vector>
+
+#include "common_test_utils/test_constants.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace ov {
+namespace test {
+
+// CPU requests keep the default pipelines, so the batch is run by a single task of the stream executor: the batch
+// callback is called before any request of the batch is completed and the callbacks of the requests are not replaced.
+TEST(StartAsyncBatchCPU, RunsRequestsInSingleTask) {
+    constexpr size_t batch_size = 4;
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 16});
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{relu}, ov::ParameterVector{param});
+
+    ov::Core core;
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_CPU, ov::num_streams(1));
+
+    std::vector<ov::InferRequest> requests;
+    std::vector<std::atomic<size_t>> request_callback_calls(batch_size);
+    for (size_t i = 0; i < batch_size; ++i) {
+        requests.push_back(compiled_model.create_infer_request());
+        auto input = requests.back().get_input_tensor();
+        auto* data = input.data<float>();
+        for (size_t j = 0; j < input.get_size(); ++j) {
+            data[j] = static_cast<float>(j) - static_cast<float>(i * 4);
+        }
+        requests.back().set_callback([&request_callback_calls, i](std::exception_ptr) {
+            ++request_callback_calls[i];
+        });
+    }
+
+    std::vector<bool> completed_before_callback(batch_size, true);
+    std::promise<std::vector<std::exception_ptr>> batch_completed;
+    ov::InferRequest::start_async_batch(requests, [&](const std::vector<std::exception_ptr>& exceptions) {
+        for (size_t i = 0; i < batch_size; ++i) {
+            completed_before_callback[i] = requests[i].wait_for(std::chrono::milliseconds{0});
+        }
+        batch_completed.set_value(exceptions);
+    });
+    const auto exceptions = batch_completed.get_future().get();
+
+    ASSERT_EQ(exceptions.size(), batch_size);
+    for (size_t i = 0; i < batch_size; ++i) {
+        requests[i].wait();
+        EXPECT_EQ(exceptions[i], nullptr);
+        EXPECT_FALSE(completed_before_callback[i]) << "request " << i << " was started by its own start_async";
+        EXPECT_EQ(request_callback_calls[i].load(), 0u);
+
+        auto output = requests[i].get_output_tensor();
+        const auto* data = output.data<const float>();
+        for (size_t j = 0; j < output.get_size(); ++j) {
+            EXPECT_EQ(data[j], std::max(0.0f, static_cast<float>(j) - static_cast<float>(i * 4)));
+        }
+    }
+
+    // the callbacks of the requests are kept for the next runs
+    for (size_t i = 0; i < batch_size; ++i) {
+        requests[i].start_async();
+        requests[i].wait();
+        EXPECT_EQ(request_callback_calls[i].load(), 1u);
+    }
+}
+
+}  // namespace test
+}  // namespace ov
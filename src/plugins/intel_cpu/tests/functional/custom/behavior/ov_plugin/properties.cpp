@@ -54,12 +54,14 @@ TEST_F(OVClassConfigTestCPU, smoke_PluginAllSupportedPropertiesAreAvailable) {
         RW_property(ov::hint::enable_cpu_pinning.name()),
         RW_property(ov::hint::enable_cpu_reservation.name()),
         RW_property(ov::hint::scheduling_core_type.name()),
+        RW_property(ov::hint::model_priority.name()),
         RW_property(ov::hint::model_distribution_policy.name()),
         RW_property(ov::hint::enable_hyper_threading.name()),
         RW_property(ov::device::id.name()),
         RW_property(ov::intel_cpu::denormals_optimization.name()),
         RW_property(ov::log::level.name()),
         RW_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+        RW_property(ov::intel_cpu::sparse_float_weights_rate.name()),
         RW_property(ov::intel_cpu::enable_tensor_parallel.name()),
         RW_property(ov::intel_cpu::tbb_partitioner.name()),
         RW_property(ov::hint::dynamic_quantization_group_size.name()),
@@ -4,6 +4,7 @@
 
 #include <common_test_utils/ov_tensor_utils.hpp>
 
+#include "shared_test_classes/base/benchmark.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "utils/cpu_test_utils.hpp"
 #include "openvino/op/bucketize.hpp"
@@ -89,6 +90,12 @@ TEST_P(BucketizeLayerCPUTest, CompareWithRefs) {
     run();
 }
 
+using BucketizeLayerCPUBenchmarkTest = BenchmarkLayerTest<BucketizeLayerCPUTest>;
+
+TEST_P(BucketizeLayerCPUBenchmarkTest, DISABLED_Benchmark) {
+    run_benchmark("Bucketize");
+}
+
 namespace {
 
 const std::vector<ov::test::InputShape> dataShapesDynamic = {
@@ -124,6 +131,27 @@ INSTANTIATE_TEST_SUITE_P(smoke_TestsBucketize_left_Dynamic,
                          test_Bucketize_left_edge_Dynamic,
                          BucketizeLayerCPUTest::getTestCaseName);
 
+// enough values for several parallel chunks of the interleaved search
+INSTANTIATE_TEST_SUITE_P(smoke_TestsBucketize_Large,
+                         BucketizeLayerCPUTest,
+                         ::testing::Combine(::testing::Values(InputShape{{}, {{4, 64, 64}}}),
+                                            ::testing::Values(InputShape{{}, {{100}}}, InputShape{{}, {{5000}}}),
+                                            ::testing::Bool(),
+                                            ::testing::Values(ov::element::f32),
+                                            ::testing::Values(ov::element::f32),
+                                            ::testing::Values(ov::element::i32)),
+                         BucketizeLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(benchmark_TestsBucketize,
+                         BucketizeLayerCPUBenchmarkTest,
+                         ::testing::Combine(::testing::Values(InputShape{{}, {{16, 256, 256}}}),
+                                            ::testing::Values(InputShape{{}, {{100}}}, InputShape{{}, {{100000}}}),
+                                            ::testing::Bool(),
+                                            ::testing::Values(ov::element::f32),
+                                            ::testing::Values(ov::element::f32),
+                                            ::testing::Values(ov::element::i32)),
+                         BucketizeLayerCPUTest::getTestCaseName);
+
 }  // namespace
 }  // namespace test
 }  // namespace ov
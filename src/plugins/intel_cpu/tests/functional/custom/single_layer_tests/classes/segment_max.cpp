@@ -116,6 +116,10 @@ TEST_P(SegmentMaxLayerCPUTest, CompareWithRefs) {
     CheckPluginRelatedResults(compiledModel, "SegmentMax");
 }
 
+TEST_P(SegmentMaxLayerCPUBenchmarkTest, DISABLED_Benchmark) {
+    run_benchmark("SegmentMax");
+}
+
 const std::vector<ov::test::utils::InputLayerType> secondaryInputTypes = {ov::test::utils::InputLayerType::CONSTANT,
                                                                           ov::test::utils::InputLayerType::PARAMETER};
 
@@ -155,6 +159,13 @@ const std::vector<SegmentMaxSpecificParams> SegmentMaxParamsVector = {
         4,
         ov::op::FillMode::ZERO
     },
+    // rows longer than a single task
+    SegmentMaxSpecificParams {
+        InputShape{{}, {{6, 1030}}},
+        std::vector<int64_t>{0, 0, 1, 3, 3, 9},
+        5,
+        ov::op::FillMode::LOWEST
+    },
     // numSegments = 0
     SegmentMaxSpecificParams {
         InputShape{{}, {{5, 7}}},
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "shared_test_classes/base/benchmark.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "common_test_utils/ov_tensor_utils.hpp"
 #include "utils/fusing_test_utils.hpp"
@@ -41,6 +42,8 @@ protected:
    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override;
 };
 
+using SegmentMaxLayerCPUBenchmarkTest = BenchmarkLayerTest<SegmentMaxLayerCPUTest>;
+
 extern const std::vector<SegmentMaxSpecificParams> SegmentMaxParamsVector;
 extern const std::vector<ov::test::utils::InputLayerType> secondaryInputTypes;
 }  // namespace SegmentMax
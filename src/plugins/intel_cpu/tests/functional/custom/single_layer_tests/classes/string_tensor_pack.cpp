@@ -123,6 +123,10 @@ const std::vector<StringTensorPackSpecificParams> StringTensorPackParamsVector =
         InputShape{{-1, -1, -1}, {{1, 1, 3}, {1, 1, 4}, {1, 3, 4}, {1, 3, 4}}},     // begins/ends shape
         InputShape{{-1}, {{9}, {0}, {108}, {0}}},                                   // utf-8 encoded symbols shape
     },
+    StringTensorPackSpecificParams{
+        InputShape{{-1, 100}, {{10, 100}, {3, 100}}},                               // begins/ends shape
+        InputShape{{-1}, {{3003}, {903}}},                                          // utf-8 encoded symbols shape
+    },
 };
 
 }  // namespace StringTensorPack
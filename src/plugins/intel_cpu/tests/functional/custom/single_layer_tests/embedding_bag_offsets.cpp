@@ -55,7 +55,7 @@ public:
         inType = _inType;
         targetDevice = _targetDevice;
         const auto& [inputShapes, indices, offsets, defaultIndex, withWeights, withDefIndex, reduction] = embParams;
-        selectedType = makeSelectedTypeStr("ref", inType);
+        selectedType = makeEmbeddingSelectedType(inType, configuration);
         targetDevice = ov::test::utils::DEVICE_CPU;
 
         init_input_shapes({inputShapes});
@@ -85,7 +85,11 @@ TEST_P(EmbeddingBagOffsetsLayerCPUTest, CompareWithRefs) {
 
 namespace {
 
-const std::vector<ElementType> netPrecisions = {ElementType::f32, ElementType::i32, ElementType::u8};
+const std::vector<ElementType> netPrecisions = {ElementType::f32,
+                                                ElementType::bf16,
+                                                ElementType::f16,
+                                                ElementType::i32,
+                                                ElementType::u8};
 
 const std::vector<ElementType> indPrecisions = {ElementType::i64, ElementType::i32};
 
@@ -107,6 +111,8 @@ const std::vector<InputShape> input_shapes = {
     {{5, 6}, {{5, 6}}},
     {{10, 35}, {{10, 35}}},
     {{5, 4, 16}, {{5, 4, 16}}},
+    // rows spanning several kernel blocks and a tail
+    {{10, 150}, {{10, 150}}},
 };
 
 const std::vector<std::vector<size_t>> indices = {{0, 1, 2, 2, 3}, {4, 4, 3, 1, 0}, {1, 2, 1, 2, 1, 2, 1, 2, 1, 2}};
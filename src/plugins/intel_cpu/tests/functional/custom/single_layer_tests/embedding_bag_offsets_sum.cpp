@@ -52,7 +52,7 @@ public:
         inType = _inType;
         targetDevice = _targetDevice;
         const auto& [inputShapes, indices, offsets, defaultIndex, withWeights, withDefIndex] = embParams;
-        selectedType = makeSelectedTypeStr("ref", inType);
+        selectedType = makeEmbeddingSelectedType(inType, configuration);
         targetDevice = ov::test::utils::DEVICE_CPU;
 
         init_input_shapes({inputShapes});
@@ -81,7 +81,11 @@ TEST_P(EmbeddingBagOffsetsSumLayerCPUTest, CompareWithRefs) {
 
 namespace {
 
-const std::vector<ElementType> netPrecisions = {ElementType::f32, ElementType::i32, ElementType::u8};
+const std::vector<ElementType> netPrecisions = {ElementType::f32,
+                                                ElementType::bf16,
+                                                ElementType::f16,
+                                                ElementType::i32,
+                                                ElementType::u8};
 
 const std::vector<ElementType> indPrecisions = {ElementType::i64, ElementType::i32};
 
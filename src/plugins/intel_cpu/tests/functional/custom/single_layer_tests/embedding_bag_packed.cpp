@@ -51,7 +51,7 @@ protected:
         inType = _inType;
         targetDevice = _targetDevice;
         const auto& [inputShapes, indices, withWeights, reduction] = embParams;
-        selectedType = makeSelectedTypeStr("ref", inType);
+        selectedType = makeEmbeddingSelectedType(inType, configuration);
         targetDevice = ov::test::utils::DEVICE_CPU;
 
         init_input_shapes({inputShapes});
@@ -78,7 +78,11 @@ TEST_P(EmbeddingBagPackedLayerCPUTest, CompareWithRefs) {
 
 namespace {
 
-const std::vector<ElementType> netPrecisions = {ElementType::f32, ElementType::i32, ElementType::u8};
+const std::vector<ElementType> netPrecisions = {ElementType::f32,
+                                                ElementType::bf16,
+                                                ElementType::f16,
+                                                ElementType::i32,
+                                                ElementType::u8};
 
 const std::vector<ElementType> indPrecisions = {ElementType::i64, ElementType::i32};
 
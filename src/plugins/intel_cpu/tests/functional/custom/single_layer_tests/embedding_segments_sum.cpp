@@ -56,7 +56,7 @@ protected:
         targetDevice = _targetDevice;
         const auto& [inputShapes, indices, segmentIds, numSegments, defaultIndex, withWeights, withDefIndex] =
             embParams;
-        selectedType = makeSelectedTypeStr("ref", inType);
+        selectedType = makeEmbeddingSelectedType(inType, configuration);
         targetDevice = ov::test::utils::DEVICE_CPU;
 
         init_input_shapes({inputShapes});
@@ -85,7 +85,11 @@ TEST_P(EmbeddingSegmentsSumLayerCPUTest, CompareWithRefs) {
 }
 
 namespace {
-const std::vector<ElementType> netPrecisions = {ElementType::f32, ElementType::i32, ElementType::u8};
+const std::vector<ElementType> netPrecisions = {ElementType::f32,
+                                                ElementType::bf16,
+                                                ElementType::f16,
+                                                ElementType::i32,
+                                                ElementType::u8};
 
 const std::vector<ElementType> indPrecisions = {ElementType::i64, ElementType::i32};
 
@@ -43,6 +43,45 @@ INSTANTIATE_TEST_SUITE_P(smoke_SegmentMaxLayoutTestUI8, SegmentMaxLayerCPUTest,
                         ::testing::Values(ov::test::utils::DEVICE_CPU)),
                 ::testing::Values(CPUSpecificParams{{}, {}, {}, "ref_i8"})),
                 SegmentMaxLayerCPUTest::getTestCaseName);
+
+namespace {
+std::vector<int64_t> sortedSegmentIds(size_t rows, size_t rowsPerSegment) {
+    std::vector<int64_t> segmentIds(rows);
+    for (size_t i = 0; i < rows; i++) {
+        segmentIds[i] = static_cast<int64_t>(i / rowsPerSegment);
+    }
+    return segmentIds;
+}
+}  // namespace
+
+// rows wide enough to be split into several column chunks
+INSTANTIATE_TEST_SUITE_P(smoke_SegmentMaxLarge, SegmentMaxLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Combine(
+                        ::testing::Values(SegmentMaxSpecificParams{InputShape{{}, {{64, 4096}}},
+                                                                   sortedSegmentIds(64, 4),
+                                                                   16,
+                                                                   ov::op::FillMode::ZERO}),
+                        ::testing::Values(ElementType::f32),
+                        ::testing::Values(false),
+                        ::testing::Values(ov::test::utils::InputLayerType::CONSTANT),
+                        ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                ::testing::Values(CPUSpecificParams{{}, {}, {}, "ref_f32"})),
+                SegmentMaxLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(benchmark_SegmentMax, SegmentMaxLayerCPUBenchmarkTest,
+        ::testing::Combine(
+                ::testing::Combine(
+                        ::testing::Values(SegmentMaxSpecificParams{InputShape{{}, {{64, 65536}}},
+                                                                   sortedSegmentIds(64, 4),
+                                                                   16,
+                                                                   ov::op::FillMode::ZERO}),
+                        ::testing::Values(ElementType::f32),
+                        ::testing::Values(false),
+                        ::testing::Values(ov::test::utils::InputLayerType::CONSTANT),
+                        ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                ::testing::Values(CPUSpecificParams{{}, {}, {}, "ref_f32"})),
+                SegmentMaxLayerCPUTest::getTestCaseName);
 }  // namespace SegmentMax
 }  // namespace test
 }  // namespace ov
@@ -9,6 +9,7 @@
 #include "openvino/op/add.hpp"
 #include "openvino/op/broadcast.hpp"
 #include "openvino/op/concat.hpp"
+#include "openvino/op/convert.hpp"
 #include "openvino/op/less.hpp"
 #include "openvino/op/loop.hpp"
 #include "openvino/op/slice.hpp"
@@ -356,6 +357,90 @@ protected:
     }
 };
 
+using LoopCurrentIterationParams = std::tuple<int64_t,  // TripCount
+                                              bool>;    // Body condition depends on the current iteration
+
+// body:
+// Y = X[i] + i
+// continue while (i < 3) or always
+class LoopCurrentIterationCPUTest : public testing::WithParamInterface<LoopCurrentIterationParams>,
+                                    virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<LoopCurrentIterationParams>& obj) {
+        const auto& [trip_count, iteration_condition] = obj.param;
+        std::ostringstream result;
+        result << "trip_count=" << trip_count << "_";
+        result << "iteration_condition=" << iteration_condition;
+        return result.str();
+    }
+
+protected:
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        for (size_t i = 0; i < funcInputs.size(); ++i) {
+            const auto& funcInput = funcInputs[i];
+            ov::Tensor tensor;
+            if (funcInput.get_element_type() == ov::element::boolean) {
+                tensor = ov::Tensor(funcInput.get_element_type(), targetInputStaticShapes[i]);
+                *tensor.data<bool>() = true;
+            } else {
+                ov::test::utils::InputGenerateData in_data;
+                in_data.start_from = 0;
+                in_data.range = 15;
+                in_data.resolution = 32768;
+                tensor = ov::test::utils::create_and_fill_tensor(funcInput.get_element_type(),
+                                                                 targetInputStaticShapes[i],
+                                                                 in_data);
+            }
+            inputs.insert({funcInput.get_node_shared_ptr(), tensor});
+        }
+    }
+
+    void SetUp() override {
+        const auto& [trip_count, iteration_condition] = this->GetParam();
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const ov::Shape input_shape{static_cast<size_t>(trip_count), 4, 16};
+        init_input_shapes({{input_shape, {input_shape}}, {{1}, {{1}}}});
+
+        ov::ParameterVector params;
+        params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]));
+        // exec_condition
+        params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::boolean, inputDynamicShapes[1]));
+
+        auto trip_count_input = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{1}, trip_count);
+
+        // Body parameters
+        auto body_x = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 4, 16});
+        auto body_iter = std::make_shared<ov::op::v0::Parameter>(ov::element::i64, ov::Shape{1});
+
+        // Body
+        auto iter_f32 = std::make_shared<ov::op::v0::Convert>(body_iter, ov::element::f32);
+        auto body_y = std::make_shared<ov::op::v1::Add>(body_x, iter_f32);
+        std::shared_ptr<ov::Node> body_condition;
+        if (iteration_condition) {
+            auto limit = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{1}, 3);
+            body_condition = std::make_shared<ov::op::v1::Less>(body_iter, limit);
+        } else {
+            body_condition = std::make_shared<ov::op::v0::Constant>(ov::element::boolean, ov::Shape{1}, true);
+        }
+        auto body = std::make_shared<ov::Model>(ov::OutputVector{body_condition, body_y},
+                                                ov::ParameterVector{body_x, body_iter});
+
+        auto loop = std::make_shared<ov::op::v5::Loop>(trip_count_input, params[1]);
+        loop->set_function(body);
+        loop->set_special_body_ports(ov::op::v5::Loop::SpecialBodyPorts{1, 0});
+        loop->set_sliced_input(body_x, params[0], 0, 1, 1, -1, 0);
+
+        auto out0 = loop->get_iter_value(body_y, -1);
+        auto out1 = loop->get_concatenated_slices(body_y, 0, 1, 1, -1, 0);
+
+        auto result0 = std::make_shared<ov::op::v0::Result>(out0);
+        auto result1 = std::make_shared<ov::op::v0::Result>(out1);
+        function = std::make_shared<ov::Model>(ov::ResultVector{result0, result1}, params, "loop");
+    }
+};
+
 class StaticLoopDynamicSubgraphCPUTest : public SubgraphBaseTest {
     void SetUp() override {
         InputShape input_shape = {{25, 1, 1}, {{25, 1, 1}, {25, 1, 1}}};  // infer more than once
@@ -435,6 +520,10 @@ TEST_P(LoopForConcatLayerCPUTest, CompareWithRefs) {
     run();
 }
 
+TEST_P(LoopCurrentIterationCPUTest, CompareWithRefs) {
+    run();
+}
+
 TEST_F(StaticLoopDynamicSubgraphCPUTest, smoke_StaticLoopWithDynSubgraph) {
     run();
 }
@@ -652,6 +741,15 @@ INSTANTIATE_TEST_SUITE_P(smoke_LoopForConcat, LoopForConcatLayerCPUTest,
                                  ::testing::ValuesIn(inputPrecisions)),
                          LoopLayerCPUTest::getTestCaseName);
 
+// the body without the iteration condition is static and its iterations run in parallel
+std::vector<int64_t> trip_count_current_iteration { 1, 6, 20 };
+
+INSTANTIATE_TEST_SUITE_P(smoke_LoopCurrentIteration, LoopCurrentIterationCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(trip_count_current_iteration),
+                                 ::testing::Bool()),
+                         LoopCurrentIterationCPUTest::getTestCaseName);
+
 }  // namespace
 }  // namespace test
 }  // namespace ov
@@ -449,6 +449,31 @@ INSTANTIATE_TEST_SUITE_P(nightly_dynamic_bf16_BatchSizeOne, LSTMSequenceCPUTest,
                                ::testing::Values(false)),
             LSTMSequenceCPUTest::getTestCaseName);
 
+// Sequence lengths other than a power of two are executed by chunks of power of two lengths
+std::vector<InputShape> nonPowerOfTwoSeqLengths {
+    {{ -1, -1, 10 },                                                  // Dynamic shape 0
+     { {3, 13, 10}, {3, 7, 10}, {3, 3, 10}, {3, 13, 10} } },          // Target shapes
+    {{ -1, 1, 10 },                                                   // Dynamic shape 1
+     { {3, 1, 10}, {3, 1, 10}, {3, 1, 10}, {3, 1, 10} } },            // Target shapes
+    {{ -1, 1, 10 },                                                   // Dynamic shape 2
+     { {3, 1, 10}, {3, 1, 10}, {3, 1, 10}, {3, 1, 10} } },            // Target shapes
+    {{ -1 },                                                          // Dynamic shape 3
+     { {3}, {3}, {3}, {3} } }                                         // Target shapes
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_dynamic_nonPowerOfTwoSeqLengths, LSTMSequenceCPUTest,
+            ::testing::Combine(::testing::Values(nonPowerOfTwoSeqLengths),
+                               ::testing::ValuesIn(mode),
+                               ::testing::ValuesIn(activations),
+                               ::testing::ValuesIn(clip),
+                               ::testing::Values(ov::op::RecurrentSequenceDirection::FORWARD,
+                                                 ov::op::RecurrentSequenceDirection::REVERSE),
+                               ::testing::ValuesIn(netPrecisions),
+                               ::testing::Values(cpuParams),
+                               ::testing::Values(ov::AnyMap{}),
+                               ::testing::Values(false)),
+            LSTMSequenceCPUTest::getTestCaseName);
+
 // Odd but valid use case
 std::vector<InputShape> mixedDynamicStaticBatch {
     {{ {2, 3}, 5, 10},                         // Dynamic shape 0
@@ -4,6 +4,7 @@
 
 #include "common_test_utils/node_builders/constant.hpp"
 #include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "ov_ops/type_relaxed.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
@@ -162,7 +163,7 @@ protected:
         configuration.insert(additionalConfig.begin(), additionalConfig.end());
 
         cpuNodeType = "FullyConnected";
-        selectedType = makeSelectedTypeStr(selectedType, element::i8);
+        selectedType = makeSelectedTypeStr(selectedType, inType == ElementType::f32 ? element::f32 : element::i8);
 
         ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(inType, inShapeA)};
 
@@ -187,6 +188,24 @@ TEST_P(MatMulSparseCPUTest, CompareWithRefs) {
     CheckPluginRelatedResults(compiledModel, cpuNodeType);
 }
 
+// batches larger than the sparse f32 implementation handles are executed by the dense implementations
+using MatMulSparseFallbackCPUTest = MatMulSparseCPUTest;
+
+TEST_P(MatMulSparseFallbackCPUTest, CompareWithRefs) {
+    run();
+    size_t fcCount = 0;
+    for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        if (rtInfo.at(ov::exec_model_info::LAYER_TYPE).as<std::string>() != cpuNodeType) {
+            continue;
+        }
+        fcCount++;
+        const auto primType = rtInfo.at(ov::exec_model_info::IMPL_TYPE).as<std::string>();
+        EXPECT_EQ(primType.find("sparse"), std::string::npos) << "Unexpected implementation type: " << primType;
+    }
+    ASSERT_EQ(1u, fcCount);
+}
+
 namespace {
 
 /* ============= Common params ============= */
@@ -308,6 +327,71 @@ const auto testParams3D_i8_sparse_smoke = ::testing::Combine(::testing::ValuesIn
 INSTANTIATE_TEST_SUITE_P(smoke_FC_3D_I8_sparse, MatMulSparseCPUTest, testParams3D_i8_sparse_smoke,
     MatMulSparseCPUTest::getTestCaseName);
 
+const ov::AnyMap SparseFloatRate50 = {{ov::intel_cpu::sparse_float_weights_rate(0.5)}};
+
+const std::vector<ShapeRelatedParams> IS_f32_sparse_smoke = {
+    {static_shapes_to_test_representation({{1, 128}, {128, 64}}), {false, true}},
+    {static_shapes_to_test_representation({{3, 128}, {128, 64}}), {false, true}},
+    {static_shapes_to_test_representation({{3, 5, 128}, {128, 71}}), {false, true}},
+    {static_shapes_to_test_representation({{64, 64}, {64, 64}}), {false, true}},
+
+    {
+        {
+            {{-1, -1}, {{20, 64}, {1, 64}, {9, 64}}},
+            {{64, 128}, {{64, 128}, {64, 128}, {64, 128}}}
+        },
+        {false, true}
+    },
+    // the batch of 100 rows is executed by a dense implementation
+    {
+        {
+            {{-1, -1}, {{20, 64}, {100, 64}, {9, 64}}},
+            {{64, 128}, {{64, 128}, {64, 128}, {64, 128}}}
+        },
+        {false, true}
+    },
+};
+
+const auto testParams_f32_sparse_smoke = ::testing::Combine(::testing::ValuesIn(IS_f32_sparse_smoke),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(emptyFusingSpec),
+                                                   ::testing::Values(CPUSpecificParams{{}, {}, {}, "gemm_sparse"}),
+                                                   ::testing::Values(SparseFloatRate50),
+                                                   ::testing::Values(0.7));
+
+INSTANTIATE_TEST_SUITE_P(smoke_FC_F32_sparse, MatMulSparseCPUTest, testParams_f32_sparse_smoke,
+    MatMulSparseCPUTest::getTestCaseName);
+
+// the rate of int8 sparse weights decompression doesn't enable the sparse f32 implementation
+INSTANTIATE_TEST_SUITE_P(smoke_FC_F32_sparse_int8_rate, MatMulSparseFallbackCPUTest,
+    ::testing::Combine(::testing::Values(IS_f32_sparse_smoke[0]),
+                       ::testing::Values(ElementType::f32),
+                       ::testing::Values(ElementType::f32),
+                       ::testing::Values(ElementType::f32),
+                       ::testing::Values(emptyFusingSpec),
+                       ::testing::Values(CPUSpecificParams{}),
+                       ::testing::Values(SparseRate50),
+                       ::testing::Values(0.7)),
+    MatMulSparseCPUTest::getTestCaseName);
+
+const std::vector<ShapeRelatedParams> IS_f32_sparse_large_batch_smoke = {
+    {static_shapes_to_test_representation({{100, 128}, {128, 64}}), {false, true}},
+    {static_shapes_to_test_representation({{2, 40, 128}, {128, 71}}), {false, true}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FC_F32_sparse_large_batch, MatMulSparseFallbackCPUTest,
+    ::testing::Combine(::testing::ValuesIn(IS_f32_sparse_large_batch_smoke),
+                       ::testing::Values(ElementType::f32),
+                       ::testing::Values(ElementType::f32),
+                       ::testing::Values(ElementType::f32),
+                       ::testing::Values(emptyFusingSpec),
+                       ::testing::Values(CPUSpecificParams{}),
+                       ::testing::Values(SparseFloatRate50),
+                       ::testing::Values(0.7)),
+    MatMulSparseCPUTest::getTestCaseName);
+
 } // namespace fullyConnected
 
 } // namespace
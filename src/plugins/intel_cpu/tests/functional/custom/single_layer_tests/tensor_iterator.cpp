@@ -130,4 +130,17 @@ INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorSimple,
                                             ::testing::ValuesIn(inputPrecisions)),
                          TensorIteratorCPUTest::getTestCaseName);
 
+// static body without back edges executes iterations in parallel
+std::vector<std::vector<InputShape>> staticInputs = {{
+    {{4, 16, 24}, {{4, 16, 24}}},
+    {{1, 16, 1}, {{1, 16, 1}}},
+}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorStatic,
+                         TensorIteratorCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(staticInputs),
+                                            ::testing::ValuesIn(direction),
+                                            ::testing::ValuesIn(inputPrecisions)),
+                         TensorIteratorCPUTest::getTestCaseName);
+
 }  // namespace
@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <limits>
+
 #include "common_test_utils/ov_tensor_utils.hpp"
+#include "shared_test_classes/base/benchmark.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "utils/cpu_test_utils.hpp"
 #include "utils/general_utils.h"
@@ -127,6 +130,31 @@ TEST_P(UniqueLayerTestCPU, CompareWithRefs) {
     CheckPluginRelatedResults(compiledModel, "Unique");
 }
 
+using UniqueLayerBenchmarkTestCPU = BenchmarkLayerTest<UniqueLayerTestCPU>;
+
+TEST_P(UniqueLayerBenchmarkTestCPU, DISABLED_Benchmark) {
+    run_benchmark("Unique");
+}
+
+// NaN is not equal to anything, so every NaN is a separate unique element
+class UniqueNaNLayerTestCPU : public UniqueLayerTestCPU {
+protected:
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        UniqueLayerTestCPU::generate_inputs(targetInputStaticShapes);
+        for (auto& [param, tensor] : inputs) {
+            auto* data = tensor.data<float>();
+            for (size_t i = 0; i < tensor.get_size(); i += 3) {
+                data[i] = std::numeric_limits<float>::quiet_NaN();
+            }
+        }
+    }
+};
+
+TEST_P(UniqueNaNLayerTestCPU, CompareWithRefs) {
+    run();
+    CheckPluginRelatedResults(compiledModel, "Unique");
+}
+
 namespace {
 
 const std::vector<ElementType> dataPrecisionSmoke = {ElementType::f32, ElementType::i32};
@@ -263,6 +291,40 @@ INSTANTIATE_TEST_SUITE_P(nightly_dynamic,
                                             ::testing::ValuesIn(getCPUInfo()),
                                             ::testing::Values(additionalConfig[0])),
                          UniqueLayerTestCPU::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_flattened_nan,
+                         UniqueNaNLayerTestCPU,
+                         ::testing::Combine(::testing::Values(std::vector<InputShape>{{{}, {{99}}}},
+                                                              std::vector<InputShape>{{{}, {{8192}}}}),
+                                            ::testing::Values(std::tuple<bool, int>{true, 0}),
+                                            ::testing::Values(false),
+                                            ::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(getCPUInfo()),
+                                            ::testing::Values(additionalConfig[0])),
+                         UniqueLayerTestCPU::getTestCaseName);
+
+// enough elements for the parallel sort and the parallel pass over the runs
+INSTANTIATE_TEST_SUITE_P(smoke_flattened_large,
+                         UniqueLayerTestCPU,
+                         ::testing::Combine(::testing::Values(std::vector<InputShape>{{{}, {{8192}}}},
+                                                              std::vector<InputShape>{{{}, {{4, 32, 64}}}}),
+                                            ::testing::Values(std::tuple<bool, int>{true, 0}),
+                                            ::testing::ValuesIn(sorted),
+                                            ::testing::ValuesIn(dataPrecisionSmoke),
+                                            ::testing::ValuesIn(getCPUInfo()),
+                                            ::testing::Values(additionalConfig[0])),
+                         UniqueLayerTestCPU::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(benchmark_flattened,
+                         UniqueLayerBenchmarkTestCPU,
+                         ::testing::Combine(::testing::Values(std::vector<InputShape>{{{}, {{1000000}}}},
+                                                              std::vector<InputShape>{{{}, {{64, 128, 128}}}}),
+                                            ::testing::Values(std::tuple<bool, int>{true, 0}),
+                                            ::testing::ValuesIn(sorted),
+                                            ::testing::ValuesIn(dataPrecisionSmoke),
+                                            ::testing::ValuesIn(getCPUInfo()),
+                                            ::testing::Values(additionalConfig[0])),
+                         UniqueLayerTestCPU::getTestCaseName);
 }  // namespace
 }  // namespace test
 }  // namespace ov
@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+#include "openvino/op/non_max_suppression.hpp"
+#include "openvino/op/sigmoid.hpp"
+
+namespace ov {
+namespace test {
+
+/*
+    boxes [2, 500, 4]   scores [2, 8, 500]
+          \                  |
+           \              Sigmoid
+            \                |
+             NonMaxSuppression
+           /        |         \
+       Result     Result     Result
+
+    Sigmoid is fused into NonMaxSuppression, which activates only the scores passing the threshold. A static Sigmoid
+    must not be tokenized into a Subgraph either. The outputs are compared with the reference of the unfused model.
+*/
+
+using NmsSigmoidScoresParams = std::vector<InputShape>;  // boxes and scores shapes
+
+class NmsSigmoidScoresTest : public testing::WithParamInterface<NmsSigmoidScoresParams>, public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<NmsSigmoidScoresParams>& obj) {
+        std::ostringstream result;
+        result << "IS=";
+        for (const auto& shape : obj.param) {
+            result << ov::test::utils::partialShape2str({shape.first}) << "_";
+        }
+        result << "TS=";
+        for (const auto& shape : obj.param) {
+            for (const auto& item : shape.second) {
+                result << ov::test::utils::vec2str(item) << "_";
+            }
+        }
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        init_input_shapes(GetParam());
+        ov::ParameterVector inputParams;
+        for (auto&& shape : inputDynamicShapes) {
+            inputParams.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape));
+        }
+        auto sigmoid = std::make_shared<ov::op::v0::Sigmoid>(inputParams[1]);
+        auto maxOutputBoxes = ov::op::v0::Constant::create(element::i32, ov::Shape{1}, {20});
+        auto iouThreshold = ov::op::v0::Constant::create(element::f32, ov::Shape{1}, {0.5F});
+        auto scoreThreshold = ov::op::v0::Constant::create(element::f32, ov::Shape{1}, {0.9F});
+        auto nms = std::make_shared<ov::op::v9::NonMaxSuppression>(inputParams[0],
+                                                                   sigmoid,
+                                                                   maxOutputBoxes,
+                                                                   iouThreshold,
+                                                                   scoreThreshold,
+                                                                   ov::op::v9::NonMaxSuppression::BoxEncodingType::CORNER,
+                                                                   true,
+                                                                   element::i32);
+        function = std::make_shared<ov::Model>(nms->outputs(), inputParams, "NmsSigmoidScores");
+    }
+};
+
+TEST_P(NmsSigmoidScoresTest, CompareWithRefs) {
+    run();
+    CPUTestUtils::CheckNumberOfNodesWithTypes(compiledModel, {"Eltwise", "Subgraph"}, 0);
+}
+
+namespace {
+
+const std::vector<NmsSigmoidScoresParams> shapes = {
+    // dynamic
+    {{{-1, -1, 4}, {{2, 500, 4}, {1, 50, 4}}}, {{-1, -1, -1}, {{2, 8, 500}, {1, 3, 50}}}},
+    // static
+    {{{2, 500, 4}, {{2, 500, 4}}}, {{2, 8, 500}, {{2, 8, 500}}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_NmsSigmoidScores,
+                         NmsSigmoidScoresTest,
+                         ::testing::ValuesIn(shapes),
+                         NmsSigmoidScoresTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,101 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/relu.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+namespace ov {
+namespace test {
+
+/*  The output of Relu is consumed both by the model output and by another node:
+ *
+ *        Param
+ *          |
+ *         Relu
+ *        /    \
+ *   Result   Multiply
+ *               |
+ *             Result
+ *
+ *  User output tensors with a dense layout must be written directly by the graph, so the Result nodes are not
+ *  executed. A strided (ROI) user tensor still requires a residual copy which is reported by the Result node.
+ */
+class OutputZeroCopyTest : virtual public SubgraphBaseStaticTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert(ov::intel_cpu::snippets_mode(ov::intel_cpu::SnippetsMode::DISABLE));
+        configuration.insert(ov::enable_profiling(true));
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputShape);
+        auto relu = std::make_shared<ov::op::v0::Relu>(param);
+        auto scale = ov::test::utils::make_constant(ov::element::f32, ov::Shape{});
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(relu, scale);
+        auto relu_result = std::make_shared<ov::op::v0::Result>(relu);
+        auto multiply_result = std::make_shared<ov::op::v0::Result>(multiply);
+        relu_result->set_friendly_name("relu_result");
+        multiply_result->set_friendly_name("multiply_result");
+        function = std::make_shared<ov::Model>(ov::ResultVector{relu_result, multiply_result},
+                                               ov::ParameterVector{param},
+                                               "OutputZeroCopy");
+    }
+
+    ov::ProfilingInfo::Status get_status(const std::string& node_name) {
+        for (const auto& info : inferRequest.get_profiling_info()) {
+            if (info.node_name == node_name) {
+                return info.status;
+            }
+        }
+        OPENVINO_THROW("Profiling info for ", node_name, " is not found");
+    }
+
+    const ov::Shape inputShape{1, 32, 64, 64};
+};
+
+TEST_F(OutputZeroCopyTest, smoke_OutputZeroCopy_SharedProducer) {
+    compile_model();
+    inferRequest = compiledModel.create_infer_request();
+    generate_inputs({inputShape});
+    for (const auto& input : inputs) {
+        inferRequest.set_tensor(input.first, input.second);
+    }
+
+    std::vector<ov::Tensor> outputs;
+    for (const auto& output : compiledModel.outputs()) {
+        outputs.emplace_back(output.get_element_type(), output.get_shape());
+        inferRequest.set_tensor(output, outputs.back());
+    }
+    inferRequest.infer();
+
+    compare(calculate_refs(), outputs);
+    EXPECT_EQ(get_status("relu_result"), ov::ProfilingInfo::Status::NOT_RUN);
+    EXPECT_EQ(get_status("multiply_result"), ov::ProfilingInfo::Status::NOT_RUN);
+}
+
+TEST_F(OutputZeroCopyTest, smoke_OutputZeroCopy_StridedTensorIsCopied) {
+    compile_model();
+    inferRequest = compiledModel.create_infer_request();
+    generate_inputs({inputShape});
+    for (const auto& input : inputs) {
+        inferRequest.set_tensor(input.first, input.second);
+    }
+
+    const auto& output = compiledModel.output(0);
+    ov::Tensor parent(output.get_element_type(), ov::Shape{1, 32, 64, 128});
+    ov::Tensor roi(parent, ov::Coordinate{0, 0, 0, 0}, ov::Coordinate{1, 32, 64, 64});
+    inferRequest.set_tensor(output, roi);
+    inferRequest.infer();
+
+    const auto& expected = calculate_refs();
+    ov::Tensor actual(output.get_element_type(), output.get_shape());
+    roi.copy_to(actual);
+    compare({expected.front()}, {actual});
+    EXPECT_EQ(get_status("relu_result"), ov::ProfilingInfo::Status::EXECUTED);
+}
+
+}  // namespace test
+}  // namespace ov
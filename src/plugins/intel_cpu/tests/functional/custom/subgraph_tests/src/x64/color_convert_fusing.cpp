@@ -0,0 +1,125 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/i420_to_rgb.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/nv12_to_bgr.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+using ColorConvertFusingParams = std::tuple<ov::Shape,  // NHWC output shape
+                                            bool,       // true - NV12, false - I420
+                                            bool,       // true - Convert before the color conversion
+                                            bool>;      // with mean / scale
+
+/*  Typical preprocessing subgraph, Convert and per channel mean / scale are fused into ColorConvert:
+ *
+ *     Parameter(u8, single plane)                   Parameter(u8, single plane)
+ *              |                                              |
+ *     NV12toBGR / I420toRGB                               Convert(f32)
+ *              |                             or               |
+ *        Convert(f32)                                NV12toBGR / I420toRGB
+ *              |                                              |
+ *       [Subtract(mean)]                                [Subtract(mean)]
+ *              |                                              |
+ *       [Multiply(scale)]                               [Multiply(scale)]
+ *              |                                              |
+ *           Result                                         Result
+ */
+class ColorConvertFusingTest : public testing::WithParamInterface<ColorConvertFusingParams>,
+                               virtual public SubgraphBaseStaticTest,
+                               public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ColorConvertFusingParams>& obj) {
+        const auto& [shape, isNV12, convertFirst, withMeanScale] = obj.param;
+        std::ostringstream result;
+        result << "OS=" << shape << "_";
+        result << (isNV12 ? "NV12" : "I420") << "_";
+        result << "ConvertFirst=" << convertFirst << "_";
+        result << "MeanScale=" << withMeanScale;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto& [shape, isNV12, convertFirst, withMeanScale] = this->GetParam();
+
+        const ov::Shape inputShape{shape[0], shape[1] * 3 / 2, shape[2], 1};
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::u8, inputShape);
+        std::shared_ptr<ov::Node> out = param;
+        if (convertFirst) {
+            out = std::make_shared<ov::op::v0::Convert>(out, ov::element::f32);
+        }
+        if (isNV12) {
+            out = std::make_shared<ov::op::v8::NV12toBGR>(out);
+        } else {
+            out = std::make_shared<ov::op::v8::I420toRGB>(out);
+        }
+        if (!convertFirst) {
+            out = std::make_shared<ov::op::v0::Convert>(out, ov::element::f32);
+        }
+        if (withMeanScale) {
+            auto mean = ov::op::v0::Constant::create(ov::element::f32, {1, 1, 1, 3}, {103.94f, 116.78f, 123.68f});
+            auto scale = ov::op::v0::Constant::create(ov::element::f32, {1, 1, 1, 3}, {0.017f, 0.0175f, 0.0171f});
+            out = std::make_shared<ov::op::v1::Subtract>(out, mean);
+            out->set_friendly_name("mean");
+            out = std::make_shared<ov::op::v1::Multiply>(out, scale);
+            out->set_friendly_name("scale");
+        }
+        function = std::make_shared<ov::Model>(ov::OutputVector{out}, ov::ParameterVector{param}, "ColorConvertFusing");
+    }
+
+    void checkFusedMeanScale() const {
+        const auto& [shape, isNV12, convertFirst, withMeanScale] = this->GetParam();
+        if (!withMeanScale) {
+            return;
+        }
+        bool found = false;
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            if (rtInfo.at(ov::exec_model_info::LAYER_TYPE).as<std::string>() != "ColorConvert") {
+                continue;
+            }
+            found = true;
+            const auto names = rtInfo.at(ov::exec_model_info::ORIGINAL_NAMES).as<std::string>();
+            EXPECT_NE(names.find("mean"), std::string::npos) << "mean is not fused into ColorConvert: " << names;
+            EXPECT_NE(names.find("scale"), std::string::npos) << "scale is not fused into ColorConvert: " << names;
+        }
+        EXPECT_TRUE(found) << "ColorConvert is not found";
+    }
+};
+
+TEST_P(ColorConvertFusingTest, CompareWithRefs) {
+    run();
+    const auto& [shape, isNV12, convertFirst, withMeanScale] = this->GetParam();
+    if (convertFirst) {
+        // Convert before the color conversion stays a separate node
+        CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+    } else {
+        CheckNumberOfNodesWithTypes(compiledModel, {"Convert", "Eltwise", "Subgraph"}, 0);
+    }
+    checkFusedMeanScale();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ColorConvertFusing,
+                         ColorConvertFusingTest,
+                         ::testing::Combine(::testing::Values(ov::Shape{1, 16, 16, 3},
+                                                              ov::Shape{2, 10, 14, 3}),
+                                            ::testing::Bool(),
+                                            ::testing::Bool(),
+                                            ::testing::Bool()),
+                         ColorConvertFusingTest::getTestCaseName);
+
+}  // namespace test
+}  // namespace ov
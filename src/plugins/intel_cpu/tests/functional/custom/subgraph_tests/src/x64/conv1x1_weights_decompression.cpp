@@ -0,0 +1,205 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/convolution.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+enum class Conv1x1Layout {
+    NHWC,          // NHWC -> Transpose -> Convolution -> Transpose -> NHWC
+    UNIT_SPATIAL,  // NCHW with H = W = 1
+    NCHW,          // NCHW -> Convolution -> NCHW
+    NHWC_BIAS      // NHWC -> Transpose -> Convolution -> Add(bias) -> Transpose -> NHWC
+};
+
+using Conv1x1WeightsDecompressionParams = std::tuple<InputShape,     // input shape
+                                                     Conv1x1Layout,  // layout around the convolution
+                                                     ElementType>;   // weights precision
+
+/*  1x1 Convolution with compressed weights is executed as FullyConnected only when no layout transposes are added,
+ *  the reference model is the same Convolution with the weights decompressed to f32 in advance:
+ *
+ *        Weights(u8/i8/u4/i4)
+ *                |
+ *           Convert(f32)   ZeroPoints
+ *                  \        /
+ *                  Subtract   Scales
+ *                       \     /
+ *            Input      Multiply
+ *               \        /
+ *              Convolution 1x1
+ */
+class Conv1x1WeightsDecompression : public testing::WithParamInterface<Conv1x1WeightsDecompressionParams>,
+                                    virtual public SubgraphBaseTest,
+                                    public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<Conv1x1WeightsDecompressionParams>& obj) {
+        const auto& [inputShape, layout, weightsPrecision] = obj.param;
+        std::ostringstream result;
+        result << "IS=" << inputShape << "_";
+        result << "layout=";
+        switch (layout) {
+        case Conv1x1Layout::NHWC:
+            result << "NHWC";
+            break;
+        case Conv1x1Layout::UNIT_SPATIAL:
+            result << "UNIT_SPATIAL";
+            break;
+        case Conv1x1Layout::NCHW:
+            result << "NCHW";
+            break;
+        case Conv1x1Layout::NHWC_BIAS:
+            result << "NHWC_BIAS";
+            break;
+        }
+        result << "_WP=" << weightsPrecision;
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t outChannels = 48;
+
+    static std::shared_ptr<ov::Model> makeModel(const ov::PartialShape& inputShape,
+                                                Conv1x1Layout layout,
+                                                const std::shared_ptr<ov::Node>& weights) {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputShape);
+        const bool nhwc = layout == Conv1x1Layout::NHWC || layout == Conv1x1Layout::NHWC_BIAS;
+        std::shared_ptr<ov::Node> out = param;
+        if (nhwc) {
+            auto toNCHW = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{4}, {0, 3, 1, 2});
+            out = std::make_shared<ov::op::v1::Transpose>(out, toNCHW);
+        }
+        out = std::make_shared<ov::op::v1::Convolution>(out,
+                                                        weights,
+                                                        ov::Strides{1, 1},
+                                                        ov::CoordinateDiff{0, 0},
+                                                        ov::CoordinateDiff{0, 0},
+                                                        ov::Strides{1, 1});
+        if (layout == Conv1x1Layout::NHWC_BIAS) {
+            auto bias = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, outChannels, 1, 1}, {0.5f});
+            out = std::make_shared<ov::op::v1::Add>(out, bias);
+        }
+        if (nhwc) {
+            auto toNHWC = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{4}, {0, 2, 3, 1});
+            out = std::make_shared<ov::op::v1::Transpose>(out, toNHWC);
+        }
+        return std::make_shared<ov::Model>(ov::OutputVector{out}, ov::ParameterVector{param}, "Conv1x1Decompression");
+    }
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto& [inputShape, layout, weightsPrecision] = this->GetParam();
+        init_input_shapes({inputShape});
+        // activations are kept in f32 to compare the decompressed weights only
+        configuration.insert({ov::hint::dynamic_quantization_group_size(0)});
+
+        const bool nhwc = layout == Conv1x1Layout::NHWC || layout == Conv1x1Layout::NHWC_BIAS;
+        const auto inChannels = static_cast<size_t>(inputDynamicShapes[0][nhwc ? 3 : 1].get_length());
+        const ov::Shape weightsShape{outChannels, inChannels, 1, 1};
+        const ov::Shape decompressionShape{outChannels, 1, 1, 1};
+
+        const int minValue = weightsPrecision.is_signed() ? -8 : 0;
+        std::vector<int> weightsData(ov::shape_size(weightsShape));
+        for (size_t i = 0; i < weightsData.size(); i++) {
+            weightsData[i] = minValue + static_cast<int>((i * 7) % 16);
+        }
+        std::vector<int> zeroPoints(outChannels);
+        std::vector<float> scales(outChannels);
+        for (size_t oc = 0; oc < outChannels; oc++) {
+            zeroPoints[oc] = minValue + static_cast<int>(oc % 5);
+            scales[oc] = 0.01f * static_cast<float>(oc % 7 + 1);
+        }
+
+        auto weights = ov::op::v0::Constant::create(weightsPrecision, weightsShape, weightsData);
+        auto convert = std::make_shared<ov::op::v0::Convert>(weights, ov::element::f32);
+        auto zeroPoint = ov::op::v0::Constant::create(weightsPrecision, decompressionShape, zeroPoints);
+        auto zeroPointConvert = std::make_shared<ov::op::v0::Convert>(zeroPoint, ov::element::f32);
+        auto subtract = std::make_shared<ov::op::v1::Subtract>(convert, zeroPointConvert);
+        auto scale = ov::op::v0::Constant::create(ov::element::f32, decompressionShape, scales);
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(subtract, scale);
+        function = makeModel(inputDynamicShapes[0], layout, multiply);
+
+        std::vector<float> decompressedData(weightsData.size());
+        for (size_t i = 0; i < decompressedData.size(); i++) {
+            const size_t oc = i / inChannels;
+            decompressedData[i] = static_cast<float>(weightsData[i] - zeroPoints[oc]) * scales[oc];
+        }
+        auto decompressed = ov::op::v0::Constant::create(ov::element::f32, weightsShape, decompressedData);
+        functionRefs = makeModel(inputDynamicShapes[0], layout, decompressed);
+    }
+
+    void checkExecutedAsFullyConnected() const {
+        const auto& [inputShape, layout, weightsPrecision] = this->GetParam();
+        const bool converted = layout == Conv1x1Layout::NHWC || layout == Conv1x1Layout::UNIT_SPATIAL;
+        CheckNumberOfNodesWithType(compiledModel, "FullyConnected", converted ? 1 : 0);
+        CheckNumberOfNodesWithType(compiledModel, "Convolution", converted ? 0 : 1);
+        if (layout == Conv1x1Layout::NHWC) {
+            CheckNumberOfNodesWithType(compiledModel, "Transpose", 0);
+        }
+    }
+};
+
+TEST_P(Conv1x1WeightsDecompression, CompareWithRefs) {
+    run();
+    checkExecutedAsFullyConnected();
+}
+
+namespace {
+
+const std::vector<ElementType> weightsPrecisions = {ov::element::u8,
+                                                    ov::element::i8,
+                                                    ov::element::u4,
+                                                    ov::element::i4};
+
+const std::vector<InputShape> inputShapesNHWC = {
+    {{}, {{1, 7, 9, 32}}},
+    {{-1, -1, -1, 64}, {{1, 4, 4, 64}, {2, 3, 5, 64}, {1, 4, 4, 64}}},
+};
+
+const std::vector<InputShape> inputShapesUnitSpatial = {
+    {{}, {{3, 32, 1, 1}}},
+    {{-1, 64, 1, 1}, {{1, 64, 1, 1}, {5, 64, 1, 1}}},
+};
+
+const std::vector<InputShape> inputShapesNCHW = {
+    {{}, {{1, 32, 8, 8}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Conv1x1CompressedWeights_NHWC,
+                         Conv1x1WeightsDecompression,
+                         ::testing::Combine(::testing::ValuesIn(inputShapesNHWC),
+                                            ::testing::Values(Conv1x1Layout::NHWC, Conv1x1Layout::NHWC_BIAS),
+                                            ::testing::ValuesIn(weightsPrecisions)),
+                         Conv1x1WeightsDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Conv1x1CompressedWeights_UnitSpatial,
+                         Conv1x1WeightsDecompression,
+                         ::testing::Combine(::testing::ValuesIn(inputShapesUnitSpatial),
+                                            ::testing::Values(Conv1x1Layout::UNIT_SPATIAL),
+                                            ::testing::ValuesIn(weightsPrecisions)),
+                         Conv1x1WeightsDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Conv1x1CompressedWeights_NCHW,
+                         Conv1x1WeightsDecompression,
+                         ::testing::Combine(::testing::ValuesIn(inputShapesNCHW),
+                                            ::testing::Values(Conv1x1Layout::NCHW),
+                                            ::testing::ValuesIn(weightsPrecisions)),
+                         Conv1x1WeightsDecompression::getTestCaseName);
+
+}  // namespace
+
+}  // namespace test
+}  // namespace ov
@@ -12,7 +12,8 @@ using ov::test::MulticlassNmsLayerTest8;
 /* input format #1 with 2 inputs: bboxes N, M, 4, scores N, C, M */
 const std::vector<std::vector<ov::Shape>> inStaticShapeParams1 = {
     {{3, 100, 4}, {3,   1, 100}},
-    {{1, 10,  4}, {1, 100, 10 }}
+    {{1, 10,  4}, {1, 100, 10 }},
+    {{2, 1000, 4}, {2, 20, 1000}}
 };
 
 const std::vector<std::vector<ov::test::InputShape>> inDynamicShapeParams1 = {
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include "shared_test_classes/base/benchmark.hpp"
 #include "single_op_tests/search_sorted.hpp"
 
 namespace ov {
@@ -14,5 +15,37 @@ INSTANTIATE_TEST_SUITE_P(smoke_SearchSortedTest,
                                             testing::Values(ov::test::utils::DEVICE_CPU)),
                          SearchSortedLayerTest::getTestCaseName);
 
+INSTANTIATE_TEST_SUITE_P(
+    smoke_SearchSortedTest_Large,
+    SearchSortedLayerTest,
+    ::testing::Combine(::testing::Values(SearchSortedSpecificParams{InputShape{{}, {{5000}}},
+                                                                    InputShape{{}, {{4, 4096}}},
+                                                                    false},
+                                         SearchSortedSpecificParams{InputShape{{}, {{8, 1000}}},
+                                                                    InputShape{{}, {{8, 2048}}},
+                                                                    true}),
+                       testing::Values(ElementType::f32),
+                       testing::Values(ov::test::utils::DEVICE_CPU)),
+    SearchSortedLayerTest::getTestCaseName);
+
+using SearchSortedLayerBenchmarkTest = BenchmarkLayerTest<SearchSortedLayerTest>;
+
+TEST_P(SearchSortedLayerBenchmarkTest, DISABLED_Benchmark) {
+    run_benchmark("SearchSorted");
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    benchmark_SearchSortedTest,
+    SearchSortedLayerBenchmarkTest,
+    ::testing::Combine(::testing::Values(SearchSortedSpecificParams{InputShape{{}, {{100000}}},
+                                                                    InputShape{{}, {{16, 65536}}},
+                                                                    false},
+                                         SearchSortedSpecificParams{InputShape{{}, {{64, 4096}}},
+                                                                    InputShape{{}, {{64, 16384}}},
+                                                                    true}),
+                       testing::Values(ElementType::f32),
+                       testing::Values(ov::test::utils::DEVICE_CPU)),
+    SearchSortedLayerTest::getTestCaseName);
+
 }  // namespace test
 }  // namespace ov
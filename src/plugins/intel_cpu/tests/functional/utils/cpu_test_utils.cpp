@@ -406,6 +406,17 @@ std::string CPUTestsBase::makeSelectedTypeStr(std::string implString, ov::elemen
     return implString;
 }
 
+std::string CPUTestsBase::makeEmbeddingSelectedType(const ov::element::Type& tablePrecision,
+                                                    const ov::AnyMap& config) const {
+    auto rtPrecision = deduce_expected_precision(tablePrecision, config);
+    const bool isJit = rtPrecision.is_real() && ov::with_cpu_x86_avx2();
+    if (rtPrecision.is_real() && !isJit) {
+        // the reference implementation reduces bf16 and f16 tables in f32
+        rtPrecision = ov::element::f32;
+    }
+    return makeSelectedTypeStr(isJit ? getPrimitiveType() : "ref", rtPrecision);
+}
+
 void CPUTestsBase::updateSelectedType(const std::string& primitiveType,
                                       const ov::element::Type netType,
                                       const ov::AnyMap& config) {
@@ -172,6 +172,13 @@ protected:
 protected:
     std::string getPrimitiveType() const;
     std::string getISA(bool skip_amx) const;
+    /**
+     * @brief Expected selected type of the EmbeddingBag* and EmbeddingSegmentsSum nodes: floating point tables are
+     * reduced by the jit kernel on AVX2 and newer, other tables by the reference implementation.
+     * @param tablePrecision Precision of the embedding table.
+     * @param config Plugin configuration the model is compiled with.
+     */
+    std::string makeEmbeddingSelectedType(const ov::element::Type& tablePrecision, const ov::AnyMap& config) const;
     std::vector<cpu_memory_format_t> inFmts, outFmts;
     std::vector<std::string> priority;
     std::string selectedType;
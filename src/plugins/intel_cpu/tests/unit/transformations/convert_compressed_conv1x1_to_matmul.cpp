@@ -0,0 +1,121 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/convolution.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/op/transpose.hpp"
+#include "transformations/cpu_opset/common/pass/convert_compressed_conv1x1_to_matmul.hpp"
+
+using namespace testing;
+
+namespace {
+const ov::element::TypeVector activation_types{ov::element::f32};
+const ov::element::TypeVector weights_types{ov::element::u8, ov::element::i8, ov::element::u4, ov::element::i4};
+
+std::shared_ptr<ov::Node> decompressed_weights(const ov::Shape& weights_shape, const ov::Shape& decompression_shape) {
+    auto weights = ov::op::v0::Constant::create(ov::element::u8, weights_shape, {3});
+    auto convert = std::make_shared<ov::op::v0::Convert>(weights, ov::element::f32);
+    auto zero_point = ov::op::v0::Constant::create(ov::element::u8, decompression_shape, {1});
+    auto zero_point_convert = std::make_shared<ov::op::v0::Convert>(zero_point, ov::element::f32);
+    auto subtract = std::make_shared<ov::op::v1::Subtract>(convert, zero_point_convert);
+    auto scale = ov::op::v0::Constant::create(ov::element::f32, decompression_shape, {0.5f});
+    return std::make_shared<ov::op::v1::Multiply>(subtract, scale);
+}
+
+std::shared_ptr<ov::Node> transpose(const ov::Output<ov::Node>& input, const std::vector<int32_t>& order) {
+    auto order_const = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{order.size()}, order);
+    return std::make_shared<ov::op::v1::Transpose>(input, order_const);
+}
+
+std::shared_ptr<ov::Node> conv(const ov::Output<ov::Node>& input, const ov::Shape& kernel, const ov::Strides& strides) {
+    auto weights = decompressed_weights(ov::Shape{64, 32, kernel[0], kernel[1]}, ov::Shape{64, 1, 1, 1});
+    return std::make_shared<ov::op::v1::Convolution>(input,
+                                                     weights,
+                                                     strides,
+                                                     ov::CoordinateDiff{0, 0},
+                                                     ov::CoordinateDiff{0, 0},
+                                                     ov::Strides{1, 1});
+}
+
+// NHWC -> Transpose -> Convolution -> Transpose -> NHWC
+std::shared_ptr<ov::Model> nhwc_conv_model(const ov::Shape& kernel, const ov::Strides& strides) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, -1, -1, 32});
+    auto conv_node = conv(transpose(input, {0, 3, 1, 2}), kernel, strides);
+    auto result = transpose(conv_node, {0, 2, 3, 1});
+    return std::make_shared<ov::Model>(ov::OutputVector{result}, ov::ParameterVector{input});
+}
+
+std::shared_ptr<ov::Model> nchw_conv_model(const ov::PartialShape& input_shape) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, input_shape);
+    auto conv_node = conv(input, ov::Shape{1, 1}, ov::Strides{1, 1});
+    return std::make_shared<ov::Model>(ov::OutputVector{conv_node}, ov::ParameterVector{input});
+}
+}  // namespace
+
+TEST_F(TransformationTestsF, ConvertCompressedConv1x1ToMatMul) {
+    {
+        model = nhwc_conv_model(ov::Shape{1, 1}, ov::Strides{1, 1});
+        manager.register_pass<ov::intel_cpu::ConvertCompressedConv1x1ToMatMul>(activation_types, weights_types);
+    }
+    {
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, -1, -1, 32});
+        auto weights = decompressed_weights(ov::Shape{64, 32}, ov::Shape{64, 1});
+        auto matmul = std::make_shared<ov::op::v0::MatMul>(input, weights, false, true);
+        model_ref = std::make_shared<ov::Model>(ov::OutputVector{matmul}, ov::ParameterVector{input});
+    }
+}
+
+TEST_F(TransformationTestsF, ConvertCompressedConv1x1ToMatMul_UnitSpatial) {
+    {
+        model = nchw_conv_model(ov::PartialShape{-1, 32, 1, 1});
+        manager.register_pass<ov::intel_cpu::ConvertCompressedConv1x1ToMatMul>(activation_types, weights_types);
+    }
+    {
+        auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 32, 1, 1});
+        auto weights = decompressed_weights(ov::Shape{64, 32}, ov::Shape{64, 1});
+        auto to_nhwc = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{4}, {0, 1, 1, -1});
+        auto reshape_in = std::make_shared<ov::op::v1::Reshape>(input, to_nhwc, true);
+        auto matmul = std::make_shared<ov::op::v0::MatMul>(reshape_in, weights, false, true);
+        auto to_nchw = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{4}, {0, -1, 1, 1});
+        auto reshape_out = std::make_shared<ov::op::v1::Reshape>(matmul, to_nchw, true);
+        model_ref = std::make_shared<ov::Model>(ov::OutputVector{reshape_out}, ov::ParameterVector{input});
+    }
+}
+
+// the transposes of the MatMul wouldn't cancel with anything in the NCHW model
+TEST_F(TransformationTestsF, ConvertCompressedConv1x1ToMatMul_NCHW) {
+    model = nchw_conv_model(ov::PartialShape{-1, 32, -1, -1});
+    manager.register_pass<ov::intel_cpu::ConvertCompressedConv1x1ToMatMul>(activation_types, weights_types);
+}
+
+// the output transpose doesn't cancel the MatMul one across the bias Add
+TEST_F(TransformationTestsF, ConvertCompressedConv1x1ToMatMul_BiasBeforeTranspose) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, -1, -1, 32});
+    auto conv_node = conv(transpose(input, {0, 3, 1, 2}), ov::Shape{1, 1}, ov::Strides{1, 1});
+    auto bias = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 64, 1, 1}, {1.f});
+    auto add = std::make_shared<ov::op::v1::Add>(conv_node, bias);
+    auto result = transpose(add, {0, 2, 3, 1});
+    model = std::make_shared<ov::Model>(ov::OutputVector{result}, ov::ParameterVector{input});
+    manager.register_pass<ov::intel_cpu::ConvertCompressedConv1x1ToMatMul>(activation_types, weights_types);
+}
+
+TEST_F(TransformationTestsF, ConvertCompressedConv1x1ToMatMul_Kernel3x3) {
+    model = nhwc_conv_model(ov::Shape{3, 3}, ov::Strides{1, 1});
+    manager.register_pass<ov::intel_cpu::ConvertCompressedConv1x1ToMatMul>(activation_types, weights_types);
+}
+
+TEST_F(TransformationTestsF, ConvertCompressedConv1x1ToMatMul_Strided) {
+    model = nhwc_conv_model(ov::Shape{1, 1}, ov::Strides{2, 2});
+    manager.register_pass<ov::intel_cpu::ConvertCompressedConv1x1ToMatMul>(activation_types, weights_types);
+}
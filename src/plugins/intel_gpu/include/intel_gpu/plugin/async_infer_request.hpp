@@ -21,6 +21,9 @@ public:
 
     void start_async() override;
 
+protected:
+    bool is_batch_startable() const override;
+
 private:
     std::shared_ptr<SyncInferRequest> m_infer_request;
     std::shared_ptr<ov::threading::ITaskExecutor> m_wait_executor;
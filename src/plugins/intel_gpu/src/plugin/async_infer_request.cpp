@@ -33,6 +33,11 @@ void AsyncInferRequest::start_async() {
     Parent::start_async();
 }
 
+bool AsyncInferRequest::is_batch_startable() const {
+    // the external queue is set up by start_async and waited by the custom pipeline
+    return !m_infer_request->use_external_queue();
+}
+
 AsyncInferRequest::~AsyncInferRequest() {
     stop_and_wait();
 }
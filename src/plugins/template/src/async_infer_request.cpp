@@ -61,3 +61,8 @@ void ov::template_plugin::AsyncInferRequest::cancel() {
     m_cancel_callback();
 }
 // ! [async_infer_request:cancel]
+
+bool ov::template_plugin::AsyncInferRequest::is_batch_startable() const {
+    // the synchronous pipeline is the default one, so the requests can be run in a single task
+    return true;
+}
@@ -24,6 +24,9 @@ public:
     ~AsyncInferRequest();
     void cancel() override;
 
+protected:
+    bool is_batch_startable() const override;
+
 private:
     std::function<void()> m_cancel_callback;
     std::shared_ptr<ov::threading::ITaskExecutor> m_wait_executor;
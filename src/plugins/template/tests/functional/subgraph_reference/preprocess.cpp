@@ -1062,6 +1062,32 @@ static RefPreprocessParams preprocess_crop_2axis_dynamic() {
     return res;
 }
 
+static RefPreprocessParams preprocess_crop_and_resize() {
+    RefPreprocessParams res("preprocess_crop_and_resize");
+    res.function = []() {
+        auto f = create_simple_function(element::f32, PartialShape{-1, 2, 2, 2});
+        auto p = PrePostProcessor(f);
+        p.input().tensor().set_shape({1, 2, 4, 6}).set_layout("NCHW");
+        p.input().preprocess().crop_and_resize("rois", 2, 2);
+        p.build();
+        return f;
+    };
+    auto input_shape = Shape{1, 2, 4, 6};
+    std::vector<float> input_values(shape_size(input_shape));
+    for (size_t i = 0; i < input_values.size(); i++) {
+        input_values[i] = static_cast<float>(i * 7 % 11);
+    }
+    res.inputs.emplace_back(element::f32, input_shape, input_values);
+    // [batch_index, x_1, y_1, x_2, y_2]: the whole image and its right 4x4 part
+    res.inputs.emplace_back(element::f32, Shape{2, 5}, std::vector<float>{0, 0, 0, 6, 4, 0, 2, 0, 6, 4});
+    // crops resized with bilinear interpolation and half pixel coordinates
+    res.expected.emplace_back(
+        Shape{2, 2, 2, 2},
+        element::f32,
+        std::vector<float>{6, 5, 2, 1, 9, 8, 5, 4, 5.5f, 3, 7, 4.5f, 3, 6, 4.5f, 4.75f});
+    return res;
+}
+
 static RefPreprocessParams postprocess_2_inputs_basic() {
     RefPreprocessParams res("postprocess_2_inputs_basic");
     res.function = []() {
@@ -1412,6 +1438,7 @@ std::vector<RefPreprocessParams> allPreprocessTests() {
                                             convert_color_i420_to_bgr_three_planes(),
                                             convert_color_i420_single_plane(),
                                             preprocess_crop_basic(),
+                                            preprocess_crop_and_resize(),
                                             preprocess_crop_2axis_dynamic(),
                                             set_shape_custom_crop(),
                                             set_shape_with_resize(),